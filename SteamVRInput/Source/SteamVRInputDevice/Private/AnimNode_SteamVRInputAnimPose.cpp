@@ -86,6 +86,45 @@ void FAnimNode_SteamVRInputAnimPose::Initialize_AnyThread(const FAnimationInitia
 
 void FAnimNode_SteamVRInputAnimPose::CacheBones_AnyThread(const FAnimationCacheBonesContext & Context)
 {
+	BuildRetargetPlan(Context.AnimInstanceProxy->GetRequiredBones());
+}
+
+void FAnimNode_SteamVRInputAnimPose::BuildRetargetPlan(const FBoneContainer& RequiredBones)
+{
+	// SteamVR hand skeleton bones are copied straight into the pose
+	for (int32 BoneIndex = 0; BoneIndex < STEAMVR_SKELETON_BONE_COUNT; ++BoneIndex)
+	{
+		RetargetPlan.SteamVRCompactIndices[BoneIndex] = RequiredBones.MakeCompactPoseIndex(FMeshPoseBoneIndex(BoneIndex)).GetInt();
+	}
+
+	// UE4 hand skeleton bones are retargetted against their reference pose
+	const FVector FingerForwardDefault_UE4(-1.f, 0.f, 0.f);
+	for (int32 BoneIndex = 0; BoneIndex < EUE4HandBone_Count; ++BoneIndex)
+	{
+		const FCompactPoseBoneIndex BoneIndexCompact = RequiredBones.MakeCompactPoseIndex(FMeshPoseBoneIndex(BoneIndex));
+		RetargetPlan.UE4CompactIndices[BoneIndex] = BoneIndexCompact.GetInt();
+		RetargetPlan.UE4ParentIndices[BoneIndex] = UE4HandSkeleton::GetParentIndex(BoneIndex);
+		RetargetPlan.UE4RefRotations[BoneIndex] = (BoneIndexCompact != INDEX_NONE) ? RequiredBones.GetRefPoseTransform(BoneIndexCompact).GetRotation() : FQuat::Identity;
+
+		// Determine which direction is "forward" in the bone's local space by looking at the direction to its child
+		FVector FingerForwardLS_UE4 = FingerForwardDefault_UE4;
+		if (UE4HandSkeleton::GetChildCount(BoneIndex) > 0)
+		{
+			const FCompactPoseBoneIndex ChildBoneIndexCompact = RequiredBones.MakeCompactPoseIndex(FMeshPoseBoneIndex(UE4HandSkeleton::GetChildIndex(BoneIndex, 0)));
+			if (ChildBoneIndexCompact != INDEX_NONE)
+			{
+				FingerForwardLS_UE4 = RequiredBones.GetRefPoseTransform(ChildBoneIndexCompact).GetTranslation();
+				FingerForwardLS_UE4.Normalize();
+			}
+		}
+		RetargetPlan.UE4ForwardsLS[BoneIndex] = FingerForwardLS_UE4;
+
+		const int32 BoneIndex_SteamVR = kUE4BoneToSteamVRBone[BoneIndex];
+		RetargetPlan.SteamVRBoneIndices[BoneIndex] = BoneIndex_SteamVR;
+		RetargetPlan.SteamVRChildIndices[BoneIndex] = (SteamVRSkeleton::GetChildCount(BoneIndex_SteamVR) > 0) ? SteamVRSkeleton::GetChildIndex(BoneIndex_SteamVR, 0) : -1;
+	}
+
+	RetargetPlan.bIsValid = true;
 }
 
 void FAnimNode_SteamVRInputAnimPose::Update_AnyThread(const FAnimationUpdateContext & Context)
@@ -102,24 +141,30 @@ void FAnimNode_SteamVRInputAnimPose::Evaluate_AnyThread(FPoseContext& Output)
 	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
 	if (SteamVRInputDevice != nullptr)
 	{
-		// Attempt to read the current skeletal pose from SteamVR.  The data returned will be the bone transforms of the SteamVR hand skeleton,
-		// transformed into the UE4 coordinate system
+		// Attempt to read the current skeletal pose from the input snapshot published by the game thread.  The data returned will be the 
+		// bone transforms of the SteamVR hand skeleton, transformed into the UE4 coordinate system
 
 		FTransform BoneTransforms[STEAMVR_SKELETON_BONE_COUNT];
 		EVRSkeletalMotionRange SteamVRMotionRange = (MotionRange == EMotionRange::VR_WithController) ? VRSkeletalMotionRange_WithController : VRSkeletalMotionRange_WithoutController;
 		bool bIsLeftHand = (Hand == EHand::VR_LeftHand);
 		
-		if (SteamVRInputDevice->GetSkeletalData(bIsLeftHand, Mirror, SteamVRMotionRange, BoneTransforms, STEAMVR_SKELETON_BONE_COUNT))
+		if (SteamVRInputDevice->GetSkeletalDataSnapshot(bIsLeftHand, Mirror, SteamVRMotionRange, BoneTransforms, STEAMVR_SKELETON_BONE_COUNT))
 		{
+			// Bone lookups are normally compiled in CacheBones_AnyThread, build them here if that has not happened yet
+			if (!RetargetPlan.bIsValid)
+			{
+				BuildRetargetPlan(Output.Pose.GetBoneContainer());
+			}
+
 			// If the target hand skeleton is the SteamVR skeleton, then we can just copy the transforms directly into the pose
 			if (HandSkeleton == EHandSkeleton::VR_SteamVRHandSkeleton)
 			{
 				for (int32 SrcBoneindex = 0; SrcBoneindex < STEAMVR_SKELETON_BONE_COUNT; ++SrcBoneindex)
 				{
-					FCompactPoseBoneIndex TargetBoneIndex = Output.Pose.GetBoneContainer().MakeCompactPoseIndex(FMeshPoseBoneIndex(SrcBoneindex));
+					const int32 TargetBoneIndex = RetargetPlan.SteamVRCompactIndices[SrcBoneindex];
 					if (TargetBoneIndex != INDEX_NONE)
 					{
-						Output.Pose[TargetBoneIndex] = BoneTransforms[SrcBoneindex];
+						Output.Pose[FCompactPoseBoneIndex(TargetBoneIndex)] = BoneTransforms[SrcBoneindex];
 					}
 				}
 			}
@@ -152,18 +197,7 @@ void FAnimNode_SteamVRInputAnimPose::PoseUE4HandSkeleton(FCompactPose& Pose, con
 	// It is easier to do the retargetting in model space, so calculate the model space transforms for the SteamVR skeleton
 	// from the given local space transforms
 	FTransform BoneTransformsMS[STEAMVR_SKELETON_BONE_COUNT];
-	for ( int32 BoneIndex = 0; BoneIndex < SteamVRSkeleton::GetBoneCount(); ++BoneIndex)
-	{
-		int32 ParentIndex = SteamVRSkeleton::GetParentIndex(BoneIndex);
-		if (ParentIndex != -1)
-		{
-			BoneTransformsMS[BoneIndex] = BoneTransformsLS[BoneIndex] * BoneTransformsMS[ParentIndex];
-		}
-		else
-		{
-			BoneTransformsMS[BoneIndex] = BoneTransformsLS[BoneIndex];
-		}
-	}
+	SteamVRSkeleton::CalcComponentSpaceTransforms(BoneTransformsLS, SteamVRSkeleton::GetParentIndices(), STEAMVR_SKELETON_BONE_COUNT, BoneTransformsMS);
 
 	// Remove any scale, as its now baked into the position
 	for (int32 BoneIndex = 0; BoneIndex < SteamVRSkeleton::GetBoneCount(); ++BoneIndex)
@@ -179,18 +213,30 @@ void FAnimNode_SteamVRInputAnimPose::PoseUE4HandSkeleton(FCompactPose& Pose, con
 		// Determine which hand we're working with
 		UE4RetargettingRefs.bIsRightHanded = (Hand == EHand::VR_RightHand && !Mirror) || (Hand == EHand::VR_LeftHand && Mirror);
 
+		// Calculate the model space transforms of the UE4 hand skeleton in one sweep, bones missing from the pose keep their identity transform
+		FTransform PoseTransformsLS_UE4[EUE4HandBone_Count];
+		for (int32 BoneIndex = 0; BoneIndex < EUE4HandBone_Count; ++BoneIndex)
+		{
+			const int32 BoneIndexCompact = RetargetPlan.UE4CompactIndices[BoneIndex];
+			if (BoneIndexCompact != INDEX_NONE)
+			{
+				PoseTransformsLS_UE4[BoneIndex] = Pose[FCompactPoseBoneIndex(BoneIndexCompact)];
+			}
+		}
+
+		FTransform PoseTransformsMS_UE4[EUE4HandBone_Count];
+		SteamVRSkeleton::CalcComponentSpaceTransforms(PoseTransformsLS_UE4, UE4HandSkeleton::GetParentIndices(), EUE4HandBone_Count, PoseTransformsMS_UE4);
+
 		// Calculate the average position of the UE4 knuckles bones and add it to the cache
 		for (int32 KnuckleIndex = 0; KnuckleIndex < 4; ++KnuckleIndex)
 		{
-			const FCompactPoseBoneIndex BoneIndex_UE4 = FCompactPoseBoneIndex(kUE4KnuckleBones[KnuckleIndex]);
-			UE4RetargettingRefs.KnuckleAverageMS_UE4 += CalcModelSpaceTransform(Pose, BoneIndex_UE4).GetTranslation();
+			UE4RetargettingRefs.KnuckleAverageMS_UE4 += PoseTransformsMS_UE4[kUE4KnuckleBones[KnuckleIndex]].GetTranslation();
 		}
 
 		UE4RetargettingRefs.KnuckleAverageMS_UE4 /= 4.f;
 
 		// Obtain the UE4 wrist Side & Forward directions from first animation frame and place in cache 
-		FCompactPoseBoneIndex WristBoneIndexCompact = Pose.GetBoneContainer().MakeCompactPoseIndex(FMeshPoseBoneIndex(EUE4HandBone_Wrist));
-		FTransform WristTransform_UE4 = Pose[WristBoneIndexCompact];
+		FTransform WristTransform_UE4 = Pose[FCompactPoseBoneIndex(RetargetPlan.UE4CompactIndices[EUE4HandBone_Wrist])];
 		FVector ToKnuckleAverageMS_UE4 = UE4RetargettingRefs.KnuckleAverageMS_UE4 - WristTransform_UE4.GetTranslation();
 		ToKnuckleAverageMS_UE4.Normalize();
 
@@ -240,41 +286,27 @@ void FAnimNode_SteamVRInputAnimPose::PoseUE4HandSkeleton(FCompactPose& Pose, con
 		TargetBoneRotationsMS[EUE4HandBone_Wrist] = TwistRotation * AlignmentRot;
 	}
 
-	// For all the remaining bones, use their child bone as a reference to calculate their orientation
+	// For all the remaining bones, use their child bone as a reference to calculate their orientation.
+	// The forward direction of each UE4 bone and the bone lookups are precompiled in the retarget plan
 	const FVector FingerForwardDefault_SteamVR(-1.f, 0.f, 0.f);
-	const FVector FingerForwardDefault_UE4(-1.f, 0.f, 0.f);
-	for ( int32 BoneIndex = EUE4HandBone_Wrist+1; BoneIndex < Pose.GetNumBones(); ++BoneIndex)
+	for ( int32 BoneIndex = EUE4HandBone_Wrist+1; BoneIndex < EUE4HandBone_Count; ++BoneIndex)
 	{
-		// Determine which direction is "forward" in the bone's local space by looking at the direction
-		// to its child
-		FVector FingerForwardLS_UE4 = FingerForwardDefault_UE4;
-		if (UE4HandSkeleton::GetChildCount(BoneIndex) > 0)
-		{
-			int32 ChildBoneIndex = UE4HandSkeleton::GetChildIndex(BoneIndex, 0);
-			FCompactPoseBoneIndex ChildBoneIndexCompact = Pose.GetBoneContainer().MakeCompactPoseIndex(FMeshPoseBoneIndex(ChildBoneIndex));
-			FingerForwardLS_UE4 = Pose[ChildBoneIndexCompact].GetTranslation();
-			FingerForwardLS_UE4.Normalize();
-		}
-
-		int32 ParentBoneIndex = UE4HandSkeleton::GetParentIndex(BoneIndex);
+		int32 ParentBoneIndex = RetargetPlan.UE4ParentIndices[BoneIndex];
 		check(ParentBoneIndex != -1);
 
-		FQuat StartingTransformMS = TargetBoneRotationsMS[ParentBoneIndex];
-
 		// Include the default orientation of the bone, so that it is used as the starting point for the adjustment rotation
-		FCompactPoseBoneIndex BoneIndexCompact = Pose.GetBoneContainer().MakeCompactPoseIndex(FMeshPoseBoneIndex(BoneIndex));
-		StartingTransformMS = StartingTransformMS * Pose[BoneIndexCompact].GetRotation();
+		FQuat StartingTransformMS = TargetBoneRotationsMS[ParentBoneIndex] * RetargetPlan.UE4RefRotations[BoneIndex];
 
 		// Convert the bone's forward direction to model space
-		FVector FingerForwardMS_UE4 = StartingTransformMS.RotateVector(FingerForwardLS_UE4);
+		FVector FingerForwardMS_UE4 = StartingTransformMS.RotateVector(RetargetPlan.UE4ForwardsLS[BoneIndex]);
 		
 		// Calculate the direction that the bone's forward vector should be pointing
-		const int32 BoneIndex_SteamVR = kUE4BoneToSteamVRBone[BoneIndex];
+		const int32 BoneIndex_SteamVR = RetargetPlan.SteamVRBoneIndices[BoneIndex];
+		const int32 ChildIndex_SteamVR = RetargetPlan.SteamVRChildIndices[BoneIndex];
 		FVector FingerForwardMS_SteamVR = FingerForwardDefault_SteamVR;
-		if (SteamVRSkeleton::GetChildCount(BoneIndex_SteamVR) > 0)
+		if (ChildIndex_SteamVR != -1)
 		{
-			int32 ChildIndex = SteamVRSkeleton::GetChildIndex(BoneIndex_SteamVR, 0);
-			FingerForwardMS_SteamVR = BoneTransformsMS[ChildIndex].GetTranslation() - BoneTransformsMS[BoneIndex_SteamVR].GetTranslation();
+			FingerForwardMS_SteamVR = BoneTransformsMS[ChildIndex_SteamVR].GetTranslation() - BoneTransformsMS[BoneIndex_SteamVR].GetTranslation();
 			FingerForwardMS_SteamVR.Normalize();
 		}
 
@@ -285,27 +317,26 @@ void FAnimNode_SteamVRInputAnimPose::PoseUE4HandSkeleton(FCompactPose& Pose, con
 	}
 
 	// Convert the target rotations from model-space to local-space and apply them on the output pose
-	for (int32 BoneIndex = 0; BoneIndex < Pose.GetNumBones(); ++BoneIndex)
+	for (int32 BoneIndex = 0; BoneIndex < EUE4HandBone_Count; ++BoneIndex)
 	{
-		FCompactPoseBoneIndex TargetBoneIndex = Pose.GetBoneContainer().MakeCompactPoseIndex(FMeshPoseBoneIndex(BoneIndex));
+		const int32 TargetBoneIndex = RetargetPlan.UE4CompactIndices[BoneIndex];
 		if (TargetBoneIndex != INDEX_NONE)
 		{
 			FQuat BoneRotation = TargetBoneRotationsMS[BoneIndex];
 
-			int32 ParentIndex = UE4HandSkeleton::GetParentIndex(BoneIndex);
+			int32 ParentIndex = RetargetPlan.UE4ParentIndices[BoneIndex];
 			if (ParentIndex != -1)
 			{
 				BoneRotation = TargetBoneRotationsMS[ParentIndex].Inverse() * BoneRotation;
 			}
 
-			Pose[TargetBoneIndex].SetRotation(BoneRotation);
+			Pose[FCompactPoseBoneIndex(TargetBoneIndex)].SetRotation(BoneRotation);
 		}
 	}
 
 	// Set the wrist bone position
 	{
-		FCompactPoseBoneIndex WristBoneIndex = Pose.GetBoneContainer().MakeCompactPoseIndex(FMeshPoseBoneIndex(EUE4HandBone_Wrist));
-		Pose[WristBoneIndex].SetTranslation(BoneTransformsMS[ESteamVRBone_Wrist].GetTranslation());
+		Pose[FCompactPoseBoneIndex(RetargetPlan.UE4CompactIndices[EUE4HandBone_Wrist])].SetTranslation(BoneTransformsMS[ESteamVRBone_Wrist].GetTranslation());
 	}
 }
 
@@ -324,15 +355,13 @@ FSteamVRInputDevice* FAnimNode_SteamVRInputAnimPose::GetSteamVRInputDevice()
 	return nullptr;
 }
 
-
 FTransform FAnimNode_SteamVRInputAnimPose::CalcModelSpaceTransform(const FCompactPose& Pose, FCompactPoseBoneIndex BoneIndex)
 {
+	// Walk up to the root once instead of recursing
 	FTransform BoneTransform = Pose[BoneIndex];
-
-	FCompactPoseBoneIndex ParentIndex = Pose.GetParentBoneIndex(BoneIndex);
-	if (ParentIndex != INDEX_NONE)
+	for (FCompactPoseBoneIndex ParentIndex = Pose.GetParentBoneIndex(BoneIndex); ParentIndex != INDEX_NONE; ParentIndex = Pose.GetParentBoneIndex(ParentIndex))
 	{
-		BoneTransform = BoneTransform * CalcModelSpaceTransform(Pose, ParentIndex);
+		BoneTransform = BoneTransform * Pose[ParentIndex];
 	}
 
 	return BoneTransform;
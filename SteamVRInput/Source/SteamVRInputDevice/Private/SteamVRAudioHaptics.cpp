@@ -0,0 +1,353 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "SteamVRAudioHaptics.h"
+#include "SteamVRHapticScheduler.h"
+#include "Async/Async.h"
+#include "Audio.h"
+#include "AudioDevice.h"
+#include "AudioThread.h"
+#include "Engine/Engine.h"
+#include "Sound/SoundWave.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSteamVRAudioHaptics, Log, All);
+
+/** Copy the 16-bit PCM data of a sound wave, from its decompressed data or else from its editor source data. Game thread only */
+static bool CopySoundWavePCM(USoundWave* SoundWave, TArray<int16>& OutSamples, int32& OutNumChannels, int32& OutSampleRate)
+{
+	if (SoundWave->RawPCMData != nullptr && SoundWave->RawPCMDataSize > 0)
+	{
+		OutSamples.SetNumUninitialized(SoundWave->RawPCMDataSize / sizeof(int16));
+		FMemory::Memcpy(OutSamples.GetData(), SoundWave->RawPCMData, OutSamples.Num() * sizeof(int16));
+		OutNumChannels = SoundWave->NumChannels;
+		OutSampleRate = (int32)SoundWave->GetSampleRateForCurrentPlatform();
+		return OutNumChannels > 0 && OutSampleRate > 0;
+	}
+
+#if WITH_EDITORONLY_DATA
+	bool bHasSourceData = false;
+	uint8* RawWaveData = (uint8*)SoundWave->RawData.Lock(LOCK_READ_ONLY);
+	FWaveModInfo WaveInfo;
+	if (RawWaveData != nullptr && WaveInfo.ReadWaveInfo(RawWaveData, SoundWave->RawData.GetBulkDataSize()))
+	{
+		OutSamples.SetNumUninitialized(WaveInfo.SampleDataSize / sizeof(int16));
+		FMemory::Memcpy(OutSamples.GetData(), WaveInfo.SampleDataStart, OutSamples.Num() * sizeof(int16));
+		OutNumChannels = *WaveInfo.pChannels;
+		OutSampleRate = *WaveInfo.pSamplesPerSec;
+		bHasSourceData = OutNumChannels > 0 && OutSampleRate > 0;
+	}
+	SoundWave->RawData.Unlock();
+
+	if (bHasSourceData)
+	{
+		return true;
+	}
+#endif
+
+	return false;
+}
+
+FSteamVRAudioHaptics::FSteamVRAudioHaptics()
+	: SharedState(MakeShared<FSharedState, ESPMode::ThreadSafe>())
+{
+}
+
+FSteamVRAudioHaptics::~FSteamVRAudioHaptics()
+{
+	StopSubmixStream();
+}
+
+void FSteamVRAudioHaptics::ExtractEnvelope(const float* Samples, int32 NumFrames, int32 NumChannels, int32 SampleRate, float Gain, TArray<FSteamVRHapticSegment>& OutSegments)
+{
+	if (Samples == nullptr || NumFrames <= 0 || NumChannels <= 0 || SampleRate <= 0)
+	{
+		return;
+	}
+
+	const int32 WindowFrames = FMath::Max(1, FMath::RoundToInt(SampleRate * HAPTIC_AUDIO_WINDOW));
+	for (int32 WindowStart = 0; WindowStart < NumFrames; WindowStart += WindowFrames)
+	{
+		const int32 WindowEnd = FMath::Min(WindowStart + WindowFrames, NumFrames);
+
+		// Windowed RMS of the mono downmix, and its zero crossings as an estimate of the dominant frequency
+		double SumOfSquares = 0.0;
+		int32 ZeroCrossings = 0;
+		bool bWasPositive = true;
+		for (int32 Frame = WindowStart; Frame < WindowEnd; ++Frame)
+		{
+			float Sample = 0.f;
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Sample += Samples[Frame * NumChannels + Channel];
+			}
+			Sample /= NumChannels;
+
+			SumOfSquares += Sample * Sample;
+
+			const bool bIsPositive = Sample >= 0.f;
+			if (Frame > WindowStart && bIsPositive != bWasPositive)
+			{
+				ZeroCrossings++;
+			}
+			bWasPositive = bIsPositive;
+		}
+
+		const int32 WindowFrameCount = WindowEnd - WindowStart;
+		const float Duration = (float)WindowFrameCount / SampleRate;
+
+		// Quantize so that sustained sounds merge into a few long vibrations
+		float Amplitude = FMath::Clamp(FMath::Sqrt((float)(SumOfSquares / WindowFrameCount)) * Gain, 0.f, 1.f);
+		Amplitude = Amplitude < HAPTIC_AUDIO_NOISE_FLOOR ? 0.f : FMath::RoundToFloat(Amplitude * HAPTIC_AUDIO_AMPLITUDE_STEPS) / HAPTIC_AUDIO_AMPLITUDE_STEPS;
+
+		float Frequency = FMath::Clamp(ZeroCrossings / (2.f * Duration), HAPTIC_AUDIO_FREQUENCY_MIN, HAPTIC_AUDIO_FREQUENCY_MAX);
+		Frequency = FMath::RoundToFloat(Frequency / HAPTIC_AUDIO_FREQUENCY_STEP) * HAPTIC_AUDIO_FREQUENCY_STEP;
+
+		if (OutSegments.Num() > 0 && OutSegments.Last().StartAmplitude == Amplitude && (Amplitude == 0.f || OutSegments.Last().StartFrequency == Frequency))
+		{
+			OutSegments.Last().Duration += Duration;
+		}
+		else
+		{
+			OutSegments.Add(FSteamVRHapticSegment(Duration, Frequency, Amplitude));
+		}
+	}
+}
+
+bool FSteamVRAudioHaptics::PlaySoundWave(int32 HandMask, USoundWave* SoundWave, float Gain, double StartTime)
+{
+	if (SoundWave == nullptr || HandMask == 0)
+	{
+		return false;
+	}
+
+	FPendingSoundWave PendingSoundWave;
+	PendingSoundWave.SoundWave = SoundWave;
+	PendingSoundWave.HandMask = HandMask;
+	PendingSoundWave.Gain = Gain;
+	PendingSoundWave.StartTime = StartTime;
+
+	// Already extracted, or being extracted, envelopes are played on the next tick
+	if (CachedEnvelopes.Contains(PendingSoundWave.SoundWave) || ExtractingSoundWaves.Contains(PendingSoundWave.SoundWave))
+	{
+		PendingSoundWaves.Add(PendingSoundWave);
+		return true;
+	}
+
+	TArray<int16> PCMSamples;
+	int32 NumChannels = 0;
+	int32 SampleRate = 0;
+	if (!CopySoundWavePCM(SoundWave, PCMSamples, NumChannels, SampleRate))
+	{
+		UE_LOG(LogSteamVRAudioHaptics, Warning, TEXT("[STEAMVR INPUT] Unable to play %s as haptics, it has no decompressed audio data"), *SoundWave->GetName());
+		return false;
+	}
+
+	// Forget the envelopes of sound waves that were unloaded, so the cache only grows with the sounds that are still around
+	for (auto CachedEnvelope = CachedEnvelopes.CreateIterator(); CachedEnvelope; ++CachedEnvelope)
+	{
+		if (CachedEnvelope.Key().IsStale())
+		{
+			CachedEnvelope.RemoveCurrent();
+		}
+	}
+
+	ExtractingSoundWaves.Add(PendingSoundWave.SoundWave);
+	PendingSoundWaves.Add(PendingSoundWave);
+
+	// Extract the envelope on a worker thread, the result is picked up on the next tick after it completes
+	TSharedRef<FSharedState, ESPMode::ThreadSafe> WorkerSharedState = SharedState;
+	TWeakObjectPtr<USoundWave> WorkerSoundWave = PendingSoundWave.SoundWave;
+	Async(EAsyncExecution::ThreadPool, [WorkerSharedState, WorkerSoundWave, PCMSamples = MoveTemp(PCMSamples), NumChannels, SampleRate]()
+	{
+		TArray<float> Samples;
+		Samples.SetNumUninitialized(PCMSamples.Num());
+		for (int32 SampleIndex = 0; SampleIndex < PCMSamples.Num(); ++SampleIndex)
+		{
+			Samples[SampleIndex] = PCMSamples[SampleIndex] / 32768.f;
+		}
+
+		FExtractedEnvelope ExtractedEnvelope;
+		ExtractedEnvelope.SoundWave = WorkerSoundWave;
+		ExtractEnvelope(Samples.GetData(), Samples.Num() / NumChannels, NumChannels, SampleRate, 1.f, ExtractedEnvelope.Segments);
+		WorkerSharedState->ExtractedEnvelopes.Enqueue(MoveTemp(ExtractedEnvelope));
+	});
+
+	return true;
+}
+
+bool FSteamVRAudioHaptics::StartSubmixStream(int32 HandMask, USoundSubmix* Submix, float Gain)
+{
+	StopSubmixStream();
+
+	FAudioDevice* AudioDevice = GEngine ? GEngine->GetMainAudioDevice() : nullptr;
+	if (AudioDevice == nullptr || HandMask == 0)
+	{
+		return false;
+	}
+
+	StreamSubmix = Submix;
+	StreamHandMask = HandMask;
+	StreamGain = Gain;
+	bIsStreaming = true;
+
+	// Only the audio mixer calls submix buffer listeners
+	AudioDevice->RegisterSubmixBufferListener(this, Submix);
+	return true;
+}
+
+void FSteamVRAudioHaptics::StopSubmixStream()
+{
+	if (!bIsStreaming)
+	{
+		return;
+	}
+
+	bIsStreaming = false;
+
+	FAudioDevice* AudioDevice = GEngine ? GEngine->GetMainAudioDevice() : nullptr;
+	if (AudioDevice != nullptr)
+	{
+		AudioDevice->UnregisterSubmixBufferListener(this, StreamSubmix.Get());
+
+		// The listener is removed on the audio thread, until then the audio render thread may still call OnNewSubmixBuffer
+		FAudioCommandFence UnregisterFence;
+		UnregisterFence.BeginFence();
+		UnregisterFence.Wait();
+	}
+
+	StreamSubmix.Reset();
+	StreamedEnvelopes.Empty();
+	StreamEndTime[0] = StreamEndTime[1] = 0.0;
+}
+
+void FSteamVRAudioHaptics::OnNewSubmixBuffer(const USoundSubmix* OwningSubmix, float* AudioData, int32 NumSamples, int32 NumChannels, const int32 SampleRate, double AudioClock)
+{
+	if (!bIsStreaming || NumChannels <= 0)
+	{
+		return;
+	}
+
+	TArray<FSteamVRHapticSegment> Segments;
+	ExtractEnvelope(AudioData, NumSamples / NumChannels, NumChannels, SampleRate, StreamGain.Load(), Segments);
+	StreamedEnvelopes.Enqueue(MoveTemp(Segments));
+}
+
+void FSteamVRAudioHaptics::PlayEnvelope(FSteamVRHapticScheduler& Scheduler, int32 HandMask, const TArray<FSteamVRHapticSegment>& Segments, float Gain, double StartTime, double Now) const
+{
+	// Skip what should already have played, the envelope only holds constant segments
+	TArray<FSteamVRHapticSegment> ScaledSegments;
+	ScaledSegments.Reserve(Segments.Num());
+	double SegmentStartTime = StartTime;
+	for (const FSteamVRHapticSegment& Segment : Segments)
+	{
+		const double SegmentEndTime = SegmentStartTime + Segment.Duration;
+		if (SegmentEndTime > Now)
+		{
+			FSteamVRHapticSegment& ScaledSegment = ScaledSegments.Add_GetRef(Segment);
+			ScaledSegment.Duration = (float)(SegmentEndTime - FMath::Max(SegmentStartTime, Now));
+			ScaledSegment.StartAmplitude = ScaledSegment.EndAmplitude = FMath::Clamp(Segment.StartAmplitude * Gain, 0.f, 1.f);
+		}
+		SegmentStartTime = SegmentEndTime;
+	}
+
+	for (int32 HandIndex = 0; HandIndex < 2; ++HandIndex)
+	{
+		if (HandMask & (1 << HandIndex))
+		{
+			Scheduler.Play(HandIndex, ScaledSegments, FMath::Max(StartTime, Now));
+		}
+	}
+}
+
+void FSteamVRAudioHaptics::Tick(FSteamVRHapticScheduler& Scheduler, double Now)
+{
+	// Cache the envelopes the worker threads finished
+	FExtractedEnvelope ExtractedEnvelope;
+	while (SharedState->ExtractedEnvelopes.Dequeue(ExtractedEnvelope))
+	{
+		ExtractingSoundWaves.Remove(ExtractedEnvelope.SoundWave);
+		if (ExtractedEnvelope.SoundWave.IsValid())
+		{
+			CachedEnvelopes.Add(ExtractedEnvelope.SoundWave, MoveTemp(ExtractedEnvelope.Segments));
+		}
+	}
+
+	for (int32 PendingIndex = 0; PendingIndex < PendingSoundWaves.Num();)
+	{
+		const FPendingSoundWave& PendingSoundWave = PendingSoundWaves[PendingIndex];
+		if (const TArray<FSteamVRHapticSegment>* Envelope = CachedEnvelopes.Find(PendingSoundWave.SoundWave))
+		{
+			PlayEnvelope(Scheduler, PendingSoundWave.HandMask, *Envelope, PendingSoundWave.Gain, PendingSoundWave.StartTime, Now);
+			PendingSoundWaves.RemoveAt(PendingIndex);
+		}
+		else if (!ExtractingSoundWaves.Contains(PendingSoundWave.SoundWave))
+		{
+			// The sound wave was unloaded before its envelope was extracted
+			PendingSoundWaves.RemoveAt(PendingIndex);
+		}
+		else
+		{
+			++PendingIndex;
+		}
+	}
+
+	// Schedule submix envelopes back to back, a little ahead of now to hide the time it takes to send them to SteamVR
+	TArray<FSteamVRHapticSegment> StreamedSegments;
+	while (StreamedEnvelopes.Dequeue(StreamedSegments))
+	{
+		float StreamedDuration = 0.f;
+		bool bIsSilent = true;
+		for (const FSteamVRHapticSegment& Segment : StreamedSegments)
+		{
+			StreamedDuration += Segment.Duration;
+			bIsSilent &= Segment.StartAmplitude == 0.f;
+		}
+
+		for (int32 HandIndex = 0; HandIndex < 2; ++HandIndex)
+		{
+			if (!(StreamHandMask & (1 << HandIndex)))
+			{
+				continue;
+			}
+
+			// Start over if the audio fell behind, or ran too far ahead of, the haptics
+			double& EndTime = StreamEndTime[HandIndex];
+			if (EndTime < Now || EndTime > Now + 4.0 * HAPTIC_AUDIO_LOOKAHEAD)
+			{
+				EndTime = Now + HAPTIC_AUDIO_LOOKAHEAD;
+			}
+
+			if (!bIsSilent)
+			{
+				Scheduler.Play(HandIndex, StreamedSegments, EndTime);
+			}
+			EndTime += StreamedDuration;
+		}
+	}
+}
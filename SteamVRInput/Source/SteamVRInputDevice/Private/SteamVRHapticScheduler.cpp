@@ -0,0 +1,310 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "SteamVRHapticScheduler.h"
+#include "SteamVRInputTrace.h"
+
+int32 FSteamVRHapticScheduler::Play(int32 HandIndex, const TArray<FSteamVRHapticSegment>& Segments, double StartTime)
+{
+	if (HandIndex < 0 || HandIndex > 1)
+	{
+		return INDEX_NONE;
+	}
+
+	FPattern Pattern;
+	Pattern.StartTime = StartTime;
+	Pattern.EndTime = StartTime;
+	for (const FSteamVRHapticSegment& Segment : Segments)
+	{
+		if (Segment.Duration < 0.f)
+		{
+			continue;
+		}
+
+		// SteamVR plays a vibration of 0 seconds as its shortest pulse, which the timeline needs a length for
+		FSteamVRHapticSegment& ValidSegment = Pattern.Segments.Add_GetRef(Segment);
+		if (ValidSegment.Duration == 0.f)
+		{
+			ValidSegment.Duration = HAPTIC_MIN_PULSE_DURATION;
+		}
+		ValidSegment.StartAmplitude = FMath::Clamp(ValidSegment.StartAmplitude, 0.f, 1.f);
+		ValidSegment.EndAmplitude = FMath::Clamp(ValidSegment.EndAmplitude, 0.f, 1.f);
+		ValidSegment.StartFrequency = FMath::Max(ValidSegment.StartFrequency, 0.f);
+		ValidSegment.EndFrequency = FMath::Max(ValidSegment.EndFrequency, 0.f);
+		Pattern.EndTime += ValidSegment.Duration;
+	}
+
+	if (Pattern.Segments.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Patterns that start after what was already sent are picked up by the next flush as is
+	FHandTimeline& Timeline = Hands[HandIndex];
+	if (Pattern.StartTime < Timeline.ScheduledUntil)
+	{
+		Timeline.bDirty = true;
+	}
+
+	Pattern.Id = NextPatternId++;
+	Timeline.Patterns.Add(MoveTemp(Pattern));
+	return NextPatternId - 1;
+}
+
+bool FSteamVRHapticScheduler::Stop(int32 PatternId)
+{
+	for (FHandTimeline& Timeline : Hands)
+	{
+		const int32 PatternIndex = Timeline.Patterns.IndexOfByPredicate([PatternId](const FPattern& Pattern) { return Pattern.Id == PatternId; });
+		if (PatternIndex != INDEX_NONE)
+		{
+			Timeline.Patterns.RemoveAt(PatternIndex);
+			Timeline.bDirty = true;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FSteamVRHapticScheduler::StopAll(int32 HandIndex)
+{
+	if (HandIndex >= 0 && HandIndex <= 1 && Hands[HandIndex].Patterns.Num() > 0)
+	{
+		Hands[HandIndex].Patterns.Empty();
+		Hands[HandIndex].bDirty = true;
+	}
+}
+
+bool FSteamVRHapticScheduler::IsPlaying(int32 HandIndex) const
+{
+	return HandIndex >= 0 && HandIndex <= 1 && Hands[HandIndex].Patterns.Num() > 0;
+}
+
+void FSteamVRHapticScheduler::SetContinuous(int32 HandIndex, float Amplitude, float Frequency, double Now, float HoldSeconds)
+{
+	if (HandIndex < 0 || HandIndex > 1)
+	{
+		return;
+	}
+
+	FHandTimeline& Timeline = Hands[HandIndex];
+	Amplitude = FMath::Clamp(Amplitude, 0.f, 1.f);
+	Frequency = FMath::Max(Frequency, 0.f);
+
+	const int32 ContinuousPatternId = Timeline.ContinuousPatternId;
+	const int32 PatternIndex = Timeline.Patterns.IndexOfByPredicate([ContinuousPatternId](const FPattern& Pattern) { return Pattern.Id == ContinuousPatternId; });
+	if (PatternIndex != INDEX_NONE)
+	{
+		FPattern& Continuous = Timeline.Patterns[PatternIndex];
+		if (Continuous.EndTime >= Now && Continuous.Segments[0].StartAmplitude == Amplitude && Continuous.Segments[0].StartFrequency == Frequency)
+		{
+			// Unchanged, so only extend it. What already played is dropped to keep the segment short
+			const double EndTime = Now + HoldSeconds;
+			if (EndTime > Continuous.EndTime)
+			{
+				// Segment durations are floats, so what was sent may end a hair after the pattern without anything past it having been sent
+				if (Continuous.EndTime < Timeline.ScheduledUntil - KINDA_SMALL_NUMBER)
+				{
+					Timeline.bDirty = true;
+				}
+
+				Continuous.StartTime = FMath::Max(Continuous.StartTime, Now);
+				Continuous.EndTime = EndTime;
+				Continuous.Segments[0].Duration = (float)(Continuous.EndTime - Continuous.StartTime);
+			}
+			return;
+		}
+
+		Timeline.Patterns.RemoveAt(PatternIndex);
+		Timeline.bDirty = true;
+	}
+
+	Timeline.ContinuousPatternId = INDEX_NONE;
+	if (Amplitude > 0.f && HoldSeconds > 0.f)
+	{
+		TArray<FSteamVRHapticSegment> Segments;
+		Segments.Add(FSteamVRHapticSegment(HoldSeconds, Frequency, Amplitude));
+		Timeline.ContinuousPatternId = Play(HandIndex, Segments, Now);
+	}
+}
+
+void FSteamVRHapticScheduler::SetMixMode(EHapticMixMode InMixMode)
+{
+	if (MixMode != InMixMode)
+	{
+		MixMode = InMixMode;
+		Hands[0].bDirty = Hands[1].bDirty = true;
+	}
+}
+
+bool FSteamVRHapticScheduler::Sample(const FHandTimeline& Timeline, double Time, float& OutAmplitude, float& OutFrequency) const
+{
+	bool bIsPlaying = false;
+	float LoudestAmplitude = 0.f;
+	OutAmplitude = 0.f;
+	OutFrequency = 0.f;
+
+	for (const FPattern& Pattern : Timeline.Patterns)
+	{
+		if (Time < Pattern.StartTime || Time >= Pattern.EndTime)
+		{
+			continue;
+		}
+
+		double SegmentStartTime = Pattern.StartTime;
+		for (const FSteamVRHapticSegment& Segment : Pattern.Segments)
+		{
+			const double SegmentEndTime = SegmentStartTime + Segment.Duration;
+			if (Time < SegmentEndTime)
+			{
+				const float Alpha = (float)((Time - SegmentStartTime) / Segment.Duration);
+				const float Amplitude = FMath::Lerp(Segment.StartAmplitude, Segment.EndAmplitude, Alpha);
+
+				// The loudest pattern sets the frequency, and its amplitude unless amplitudes are summed
+				if (!bIsPlaying || Amplitude > LoudestAmplitude)
+				{
+					LoudestAmplitude = Amplitude;
+					OutFrequency = FMath::Lerp(Segment.StartFrequency, Segment.EndFrequency, Alpha);
+				}
+				OutAmplitude = MixMode == HapticMix_Sum ? FMath::Min(OutAmplitude + Amplitude, 1.f) : LoudestAmplitude;
+				bIsPlaying = true;
+				break;
+			}
+			SegmentStartTime = SegmentEndTime;
+		}
+	}
+
+	return bIsPlaying;
+}
+
+double FSteamVRHapticScheduler::NextChangeTime(const FHandTimeline& Timeline, double Time)
+{
+	double NextTime = TNumericLimits<double>::Max();
+
+	for (const FPattern& Pattern : Timeline.Patterns)
+	{
+		if (Time < Pattern.StartTime)
+		{
+			NextTime = FMath::Min(NextTime, Pattern.StartTime);
+			continue;
+		}
+
+		double SegmentStartTime = Pattern.StartTime;
+		for (const FSteamVRHapticSegment& Segment : Pattern.Segments)
+		{
+			const double SegmentEndTime = SegmentStartTime + Segment.Duration;
+			if (Time < SegmentEndTime)
+			{
+				// Ramps are sent as a staircase of short vibrations
+				NextTime = FMath::Min(NextTime, Segment.IsRamp() ? FMath::Min(Time + HAPTIC_SCHEDULE_RAMP_STEP, SegmentEndTime) : SegmentEndTime);
+				break;
+			}
+			SegmentStartTime = SegmentEndTime;
+		}
+	}
+
+	return NextTime;
+}
+
+int32 FSteamVRHapticScheduler::Flush(IVRInput* VRInputInterface, const VRActionHandle_t (&VibrationActions)[2], double Now, float Lookahead)
+{
+	int32 VibrationCount = 0;
+
+	for (int32 HandIndex = 0; HandIndex < 2; ++HandIndex)
+	{
+		FHandTimeline& Timeline = Hands[HandIndex];
+
+		// Drop patterns that already ended
+		Timeline.Patterns.RemoveAll([Now](const FPattern& Pattern) { return Pattern.EndTime <= Now; });
+
+		if (VRInputInterface == nullptr || VibrationActions[HandIndex] == k_ulInvalidActionHandle)
+		{
+			continue;
+		}
+
+		// A new vibration replaces the one playing, so changes to the patterns are sent again from now on
+		double Time = Timeline.bDirty ? Now : FMath::Max(Now, Timeline.ScheduledUntil);
+		Timeline.bDirty = false;
+
+		const double LookaheadEndTime = Now + Lookahead;
+		while (Time < LookaheadEndTime)
+		{
+			float Amplitude, Frequency;
+			Sample(Timeline, Time, Amplitude, Frequency);
+
+			// Extend this vibration over every change point that leaves the merged output as is
+			double NextTime = NextChangeTime(Timeline, Time);
+			while (NextTime < TNumericLimits<double>::Max())
+			{
+				float NextAmplitude, NextFrequency;
+				Sample(Timeline, NextTime, NextAmplitude, NextFrequency);
+				if (!FMath::IsNearlyEqual(NextAmplitude, Amplitude) || (Amplitude > 0.f && !FMath::IsNearlyEqual(NextFrequency, Frequency)))
+				{
+					break;
+				}
+				NextTime = NextChangeTime(Timeline, NextTime);
+			}
+
+			if (Amplitude > 0.f)
+			{
+				VRInputInterface->TriggerHapticVibrationAction(VibrationActions[HandIndex], (float)(Time - Now), (float)(NextTime - Time), Frequency, Amplitude, k_ulInvalidInputValueHandle);
+				if (FSteamVRInputTrace::IsEnabled())
+				{
+					FSteamVRInputTrace::TraceHaptic(HandIndex, (float)(Time - Now), (float)(NextTime - Time), Frequency, Amplitude);
+				}
+				Timeline.CommittedUntil = FMath::Max(Timeline.CommittedUntil, NextTime);
+				VibrationCount++;
+			}
+			else if (Time < Timeline.CommittedUntil)
+			{
+				// Silence what is left of a vibration that was sent before its pattern stopped
+				NextTime = FMath::Min(NextTime, Timeline.CommittedUntil);
+				VRInputInterface->TriggerHapticVibrationAction(VibrationActions[HandIndex], (float)(Time - Now), (float)(NextTime - Time), 0.f, 0.f, k_ulInvalidInputValueHandle);
+				if (FSteamVRInputTrace::IsEnabled())
+				{
+					FSteamVRInputTrace::TraceHaptic(HandIndex, (float)(Time - Now), (float)(NextTime - Time), 0.f, 0.f);
+				}
+				VibrationCount++;
+			}
+
+			if (NextTime == TNumericLimits<double>::Max())
+			{
+				// Nothing left to play on this hand
+				Time = LookaheadEndTime;
+				break;
+			}
+			Time = NextTime;
+		}
+
+		Timeline.ScheduledUntil = Time;
+	}
+
+	return VibrationCount;
+}
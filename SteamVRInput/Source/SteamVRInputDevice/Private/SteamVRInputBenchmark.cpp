@@ -0,0 +1,473 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "SteamVRInputBenchmark.h"
+#include "SteamVRInputDevice.h"
+#include "SteamVRInputDeviceFunctionLibrary.h"
+#include "SteamVRInputRuntime.h"
+#include "SteamVRInputStats.h"
+#include "Misc/ConfigCacheIni.h"
+
+/** Budget of each input path per frame in microseconds, unless configured otherwise */
+static const float DefaultBudgetMicroseconds[BenchmarkPath_Count] =
+{
+	1000.f,		// SendControllerEvents, every action read and dispatched
+	800.f,		// ProcessActionEvents, every action read and dispatched
+	250.f,		// GetControllerOrientationAndPosition, every motion source
+	100.f,		// GetControllerTrackingStatus, every motion source
+	200.f,		// GetSkeletalData, both hands
+	200.f		// GetFingerCurlsAndSplays, both hands
+};
+
+/** Action counts scaled with the fewest trackers, then tracker counts scaled with the fewest actions */
+static const int32 BenchmarkActionCounts[] = { 10, 100, 1000 };
+static const int32 BenchmarkTrackerCounts[] = { 2, 8, 64 };
+
+static double SecondsSince(uint64 StartCycles)
+{
+	return FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+}
+
+FSteamVRInputBenchmarkBudgets::FSteamVRInputBenchmarkBudgets()
+{
+	for (int32 PathIndex = 0; PathIndex < BenchmarkPath_Count; ++PathIndex)
+	{
+		Microseconds[PathIndex] = DefaultBudgetMicroseconds[PathIndex];
+		if (GConfig != nullptr)
+		{
+			const FString BudgetKey = FString::Printf(TEXT("BenchmarkBudget%s"), FSteamVRInputBenchmark::GetPathName((ESteamVRBenchmarkPath)PathIndex));
+			GConfig->GetFloat(TEXT(INPUT_CONFIG_SECTION), *BudgetKey, Microseconds[PathIndex], GGameIni);
+		}
+	}
+}
+
+/** Whether a call of the path reads every action, so costs more as actions are added */
+static bool ScalesWithActionCount(ESteamVRBenchmarkPath Path)
+{
+	return Path == BenchmarkPath_SendControllerEvents || Path == BenchmarkPath_ProcessActionEvents;
+}
+
+TUniquePtr<FSteamVRInputDevice> FSteamVRInputBenchmark::MakeIsolatedDevice()
+{
+	// Input is still sent, so paid for, but not to the game
+	return TUniquePtr<FSteamVRInputDevice>(new FSteamVRInputDevice(MakeShareable(new FGenericApplicationMessageHandler()), true));
+}
+
+FSteamVRInputBenchmark::FSteamVRInputBenchmark(FSteamVRInputDevice& InEngineDevice)
+	: EngineDevice(InEngineDevice)
+{
+}
+
+const TCHAR* FSteamVRInputBenchmark::GetPathName(ESteamVRBenchmarkPath Path)
+{
+	switch (Path)
+	{
+	case BenchmarkPath_SendControllerEvents:				return TEXT("SendControllerEvents");
+	case BenchmarkPath_ProcessActionEvents:					return TEXT("ProcessActionEvents");
+	case BenchmarkPath_GetControllerOrientationAndPosition:	return TEXT("GetControllerOrientationAndPosition");
+	case BenchmarkPath_GetControllerTrackingStatus:			return TEXT("GetControllerTrackingStatus");
+	case BenchmarkPath_GetSkeletalData:						return TEXT("GetSkeletalData");
+	case BenchmarkPath_GetFingerCurlsAndSplays:				return TEXT("GetFingerCurlsAndSplays");
+	default:												return TEXT("Unknown");
+	}
+}
+
+bool FSteamVRInputBenchmark::Run(FOutputDevice& Ar, int32 FrameCount)
+{
+	if (!RunScenarios(FrameCount))
+	{
+		Ar.Logf(ELogVerbosity::Warning, TEXT("[STEAMVR INPUT] Unable to run the input benchmark while input is being recorded or replayed"));
+		return false;
+	}
+
+	bool bIsWithinBudget = Results.Num() > 0;
+	Ar.Logf(TEXT("[STEAMVR INPUT] Input benchmark, %d frames per scenario"), FMath::Max(FrameCount, 1));
+	for (const FSteamVRInputBenchmarkResult& Result : Results)
+	{
+		bIsWithinBudget &= Result.IsWithinBudget();
+		Ar.Logf(Result.IsWithinBudget() ? ELogVerbosity::Display : ELogVerbosity::Error, TEXT("%-36s actions %4d trackers %2d calls %2d %9.2f us/call %9.2f us/frame %9.2f us max, budget %9.2f us %s"),
+			GetPathName(Result.Path), Result.ActionCount, Result.TrackerCount, Result.CallsPerFrame, Result.MicrosecondsPerCall,
+			Result.MicrosecondsPerFrame, Result.MaxMicrosecondsPerFrame, Result.BudgetMicroseconds, Result.IsWithinBudget() ? TEXT("ok") : TEXT("OVER BUDGET"));
+	}
+
+	if (Results.Num() == 0)
+	{
+		Ar.Logf(ELogVerbosity::Warning, TEXT("[STEAMVR INPUT] The input benchmark did not run, the mock runtime could not be started"));
+	}
+
+	for (const FSteamVRInputBenchmarkScaling& PathScaling : Scaling)
+	{
+		bIsWithinBudget &= PathScaling.IsWithinTolerance();
+		Ar.Logf(PathScaling.IsWithinTolerance() ? ELogVerbosity::Display : ELogVerbosity::Error, TEXT("%-36s %s %4d to %4d %9.2f to %9.2f us/call (%.2fx, expected up to %.2fx) %s"),
+			GetPathName(PathScaling.Path), PathScaling.bScalesWithActions ? TEXT("actions ") : TEXT("trackers"), PathScaling.BaseCount, PathScaling.ScaledCount,
+			PathScaling.BaseMicroseconds, PathScaling.ScaledMicroseconds, PathScaling.GetRatio(), PathScaling.ExpectedRatio * BENCHMARK_SCALING_TOLERANCE,
+			PathScaling.IsWithinTolerance() ? TEXT("ok") : TEXT("SCALES WORSE THAN EXPECTED"));
+	}
+
+	const bool bIsSnapshotIdle = (IdleSkeletalCallCount == 0);
+	bIsWithinBudget &= bIsSnapshotIdle;
+	Ar.Logf(bIsSnapshotIdle ? ELogVerbosity::Display : ELogVerbosity::Error, TEXT("%-36s %d skeletal calls into SteamVR with no snapshot reader %s"),
+		TEXT("PublishInputSnapshot"), IdleSkeletalCallCount, bIsSnapshotIdle ? TEXT("ok") : TEXT("UNREAD DATA PUBLISHED"));
+
+	bIsWithinBudget &= RunSkeletonConversion(Ar);
+	return bIsWithinBudget;
+}
+
+bool FSteamVRInputBenchmark::RunScenarios(int32 FrameCount)
+{
+	Results.Reset();
+	Scaling.Reset();
+	IdleSkeletalCallCount = INDEX_NONE;
+	if (EngineDevice.IsRecordingInput() || EngineDevice.IsReplayingInput())
+	{
+		return false;
+	}
+
+	// The worker registering the startup action manifest calls into the runtime each scenario switches
+	EngineDevice.FinishAsyncInitialization(true);
+
+	// The polling thread of the engine device would read the mock runtime of each scenario with its own handles
+	const float EnginePollingRate = EngineDevice.GetInputPollingRate();
+	EngineDevice.SetInputPollingRate(0.f);
+
+	FrameCount = FMath::Max(FrameCount, 1);
+	for (int32 ActionCount : BenchmarkActionCounts)
+	{
+		RunScenario(ActionCount, BenchmarkTrackerCounts[0], FrameCount);
+	}
+	for (int32 TrackerIndex = 1; TrackerIndex < ARRAY_COUNT(BenchmarkTrackerCounts); ++TrackerIndex)
+	{
+		RunScenario(BenchmarkActionCounts[0], BenchmarkTrackerCounts[TrackerIndex], FrameCount);
+	}
+	RunIdleSnapshot(FrameCount);
+
+	EngineDevice.SetInputPollingRate(EnginePollingRate);
+
+	ComputeScaling();
+	return true;
+}
+
+const FSteamVRInputBenchmarkResult* FSteamVRInputBenchmark::FindResult(ESteamVRBenchmarkPath Path, int32 ActionCount, int32 TrackerCount) const
+{
+	return Results.FindByPredicate([Path, ActionCount, TrackerCount](const FSteamVRInputBenchmarkResult& Result)
+	{
+		return Result.Path == Path && Result.ActionCount == ActionCount && Result.TrackerCount == TrackerCount;
+	});
+}
+
+void FSteamVRInputBenchmark::ComputeScaling()
+{
+	const int32 MinActionCount = BenchmarkActionCounts[0];
+	const int32 MaxActionCount = BenchmarkActionCounts[ARRAY_COUNT(BenchmarkActionCounts) - 1];
+	const int32 MinTrackerCount = BenchmarkTrackerCounts[0];
+	const int32 MaxTrackerCount = BenchmarkTrackerCounts[ARRAY_COUNT(BenchmarkTrackerCounts) - 1];
+
+	for (int32 ScaleIndex = 0; ScaleIndex < 2; ++ScaleIndex)
+	{
+		const bool bScalesWithActions = (ScaleIndex == 0);
+		for (int32 PathIndex = 0; PathIndex < BenchmarkPath_Count; ++PathIndex)
+		{
+			const ESteamVRBenchmarkPath Path = (ESteamVRBenchmarkPath)PathIndex;
+			const FSteamVRInputBenchmarkResult* BaseResult = FindResult(Path, MinActionCount, MinTrackerCount);
+			const FSteamVRInputBenchmarkResult* ScaledResult = bScalesWithActions ? FindResult(Path, MaxActionCount, MinTrackerCount) : FindResult(Path, MinActionCount, MaxTrackerCount);
+			if (BaseResult == nullptr || ScaledResult == nullptr)
+			{
+				continue;
+			}
+
+			// Per call, a path costs the same however many trackers there are, and grows at most linearly with the actions it reads
+			FSteamVRInputBenchmarkScaling& PathScaling = Scaling.AddDefaulted_GetRef();
+			PathScaling.Path = Path;
+			PathScaling.bScalesWithActions = bScalesWithActions;
+			PathScaling.BaseCount = bScalesWithActions ? MinActionCount : MinTrackerCount;
+			PathScaling.ScaledCount = bScalesWithActions ? MaxActionCount : MaxTrackerCount;
+			PathScaling.BaseMicroseconds = BaseResult->MicrosecondsPerCall;
+			PathScaling.ScaledMicroseconds = ScaledResult->MicrosecondsPerCall;
+			PathScaling.ExpectedRatio = (bScalesWithActions && ScalesWithActionCount(Path)) ? (double)MaxActionCount / MinActionCount : 1.0;
+		}
+	}
+}
+
+bool FSteamVRInputBenchmark::RunSkeletonConversion(FOutputDevice& Ar, int32 IterationCount)
+{
+	IterationCount = FMath::Max(IterationCount, 1);
+	SkeletonConversionResult = FSteamVRSkeletonConversionResult();
+
+	// Random but repeatable parent space bones, as SteamVR reports them
+	FRandomStream RandomStream(STEAMVR_SKELETON_BONE_COUNT);
+	VRBoneTransform_t SteamVRBoneTransforms[STEAMVR_SKELETON_BONE_COUNT];
+	for (VRBoneTransform_t& SteamVRBoneTransform : SteamVRBoneTransforms)
+	{
+		const FQuat Rotation(RandomStream.GetUnitVector(), RandomStream.FRandRange(-PI, PI));
+		SteamVRBoneTransform.orientation.w = Rotation.W;
+		SteamVRBoneTransform.orientation.x = Rotation.X;
+		SteamVRBoneTransform.orientation.y = Rotation.Y;
+		SteamVRBoneTransform.orientation.z = Rotation.Z;
+		SteamVRBoneTransform.position.v[0] = RandomStream.FRandRange(-0.1f, 0.1f);
+		SteamVRBoneTransform.position.v[1] = RandomStream.FRandRange(-0.1f, 0.1f);
+		SteamVRBoneTransform.position.v[2] = RandomStream.FRandRange(-0.1f, 0.1f);
+		SteamVRBoneTransform.position.v[3] = 1.f;
+	}
+
+	// Converting only reads the bone conversions every device builds
+	TUniquePtr<FSteamVRInputDevice> Device = MakeIsolatedDevice();
+	FTransform VectorizedTransforms[STEAMVR_SKELETON_BONE_COUNT];
+	FTransform ScalarTransforms[STEAMVR_SKELETON_BONE_COUNT];
+	double VectorizedSeconds = 0.0;
+	double ScalarSeconds = 0.0;
+
+	for (int32 MirrorIndex = 0; MirrorIndex < 2; ++MirrorIndex)
+	{
+		const bool bMirror = (MirrorIndex == 1);
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+			{
+				Device->ConvertSteamVRSkeleton(SteamVRBoneTransforms, bMirror, VectorizedTransforms);
+			}
+			VectorizedSeconds += SecondsSince(StartCycles);
+		}
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+			{
+				Device->ConvertSteamVRSkeletonScalar(SteamVRBoneTransforms, bMirror, ScalarTransforms);
+			}
+			ScalarSeconds += SecondsSince(StartCycles);
+		}
+
+		for (int32 BoneIndex = 0; BoneIndex < STEAMVR_SKELETON_BONE_COUNT; ++BoneIndex)
+		{
+			const FQuat RotationError = VectorizedTransforms[BoneIndex].GetRotation() - ScalarTransforms[BoneIndex].GetRotation();
+			const FVector TranslationError = VectorizedTransforms[BoneIndex].GetTranslation() - ScalarTransforms[BoneIndex].GetTranslation();
+			SkeletonConversionResult.MaxError = FMath::Max(SkeletonConversionResult.MaxError, FMath::Max3(FMath::Abs(RotationError.X), FMath::Abs(RotationError.Y), FMath::Abs(RotationError.Z)));
+			SkeletonConversionResult.MaxError = FMath::Max(SkeletonConversionResult.MaxError, FMath::Abs(RotationError.W));
+			SkeletonConversionResult.MaxError = FMath::Max(SkeletonConversionResult.MaxError, TranslationError.GetAbsMax());
+		}
+	}
+
+	SkeletonConversionResult.VectorizedMicroseconds = VectorizedSeconds * 1000000.0 / (2 * IterationCount);
+	SkeletonConversionResult.ScalarMicroseconds = ScalarSeconds * 1000000.0 / (2 * IterationCount);
+
+	const bool bIsMatching = SkeletonConversionResult.IsMatching();
+	Ar.Logf(bIsMatching ? ELogVerbosity::Display : ELogVerbosity::Error, TEXT("%-36s %9.3f us/skeleton, scalar path %9.3f us/skeleton (%.2fx), max difference %g %s"),
+		TEXT("ConvertSteamVRSkeleton"), SkeletonConversionResult.VectorizedMicroseconds, SkeletonConversionResult.ScalarMicroseconds,
+		SkeletonConversionResult.ScalarMicroseconds / FMath::Max(SkeletonConversionResult.VectorizedMicroseconds, DOUBLE_SMALL_NUMBER),
+		SkeletonConversionResult.MaxError, bIsMatching ? TEXT("ok") : TEXT("MISMATCH"));
+
+	return bIsMatching;
+}
+
+void FSteamVRInputBenchmark::RunScenario(int32 ActionCount, int32 TrackerCount, int32 FrameCount)
+{
+	// Mock runtimes stack, the runtime the engine device reads is back once the scenario stops its own
+	TUniquePtr<FSteamVRInputDevice> IsolatedDevice = MakeIsolatedDevice();
+	FSteamVRInputDevice& Device = *IsolatedDevice;
+
+	FSteamVRMockRuntimeSettings Settings;
+	Settings.TrackerCount = TrackerCount;
+	if (!Device.StartMockRuntime(Settings))
+	{
+		return;
+	}
+
+	AddBenchmarkActions(Device, ActionCount);
+
+	TArray<FMotionControllerSource> Sources;
+	Device.EnumerateSources(Sources);
+
+	int32 CallsPerFrame[BenchmarkPath_Count] = {};
+	CallsPerFrame[BenchmarkPath_SendControllerEvents] = 1;
+	CallsPerFrame[BenchmarkPath_ProcessActionEvents] = 1;
+	CallsPerFrame[BenchmarkPath_GetControllerOrientationAndPosition] = Sources.Num();
+	CallsPerFrame[BenchmarkPath_GetControllerTrackingStatus] = Sources.Num();
+	CallsPerFrame[BenchmarkPath_GetSkeletalData] = 2;
+	CallsPerFrame[BenchmarkPath_GetFingerCurlsAndSplays] = 2;
+
+	double TotalSeconds[BenchmarkPath_Count] = {};
+	double MaxSeconds[BenchmarkPath_Count] = {};
+	FTransform BoneTransforms[STEAMVR_SKELETON_BONE_COUNT];
+	FSteamVRFingerCurls FingerCurls;
+	FSteamVRFingerSplays FingerSplays;
+
+	for (int32 FrameIndex = 0; FrameIndex < FrameCount; ++FrameIndex)
+	{
+		double FrameSeconds[BenchmarkPath_Count] = {};
+
+		// Action sets are processed on their own, then again as part of a whole frame, each after the simulation moved on
+		Device.MockRuntime->Tick(0.5f * BENCHMARK_FRAME_SECONDS);
+		{
+			FScopeLock ActionStateScopeLock(&Device.ActionStateLock);
+			FSteamVRInputRuntime::VRInput()->UpdateActionState(Device.ActiveActionSets, sizeof(VRActiveActionSet_t), Device.ActiveActionSetCount);
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (const FSteamVRInputActionSet& SteamVRInputActionSet : Device.SteamVRInputActionSets)
+			{
+				if (SteamVRInputActionSet.bIsActive)
+				{
+					Device.ProcessActionEvents(SteamVRInputActionSet);
+				}
+			}
+			FrameSeconds[BenchmarkPath_ProcessActionEvents] = SecondsSince(StartCycles);
+		}
+
+		Device.MockRuntime->Tick(0.5f * BENCHMARK_FRAME_SECONDS);
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Device.SendControllerEvents();
+			FrameSeconds[BenchmarkPath_SendControllerEvents] = SecondsSince(StartCycles);
+		}
+
+		// Poses are cached per frame, as a new frame would
+		Device.PoseCache.Reset();
+		{
+			FRotator Orientation;
+			FVector Position;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (const FMotionControllerSource& Source : Sources)
+			{
+				Device.GetControllerOrientationAndPosition(0, Source.SourceName, Orientation, Position, 100.f);
+			}
+			FrameSeconds[BenchmarkPath_GetControllerOrientationAndPosition] = SecondsSince(StartCycles);
+		}
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (const FMotionControllerSource& Source : Sources)
+			{
+				Device.GetControllerTrackingStatus(0, Source.SourceName);
+			}
+			FrameSeconds[BenchmarkPath_GetControllerTrackingStatus] = SecondsSince(StartCycles);
+		}
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Device.GetSkeletalData(true, false, VRSkeletalMotionRange_WithController, BoneTransforms, STEAMVR_SKELETON_BONE_COUNT);
+			Device.GetSkeletalData(false, false, VRSkeletalMotionRange_WithController, BoneTransforms, STEAMVR_SKELETON_BONE_COUNT);
+			FrameSeconds[BenchmarkPath_GetSkeletalData] = SecondsSince(StartCycles);
+		}
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			USteamVRInputDeviceFunctionLibrary::GetDeviceFingerCurlsAndSplays(&Device, EHand::VR_LeftHand, FingerCurls, FingerSplays);
+			USteamVRInputDeviceFunctionLibrary::GetDeviceFingerCurlsAndSplays(&Device, EHand::VR_RightHand, FingerCurls, FingerSplays);
+			FrameSeconds[BenchmarkPath_GetFingerCurlsAndSplays] = SecondsSince(StartCycles);
+		}
+
+		for (int32 PathIndex = 0; PathIndex < BenchmarkPath_Count; ++PathIndex)
+		{
+			TotalSeconds[PathIndex] += FrameSeconds[PathIndex];
+			MaxSeconds[PathIndex] = FMath::Max(MaxSeconds[PathIndex], FrameSeconds[PathIndex]);
+		}
+	}
+
+	for (int32 PathIndex = 0; PathIndex < BenchmarkPath_Count; ++PathIndex)
+	{
+		FSteamVRInputBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+		Result.Path = (ESteamVRBenchmarkPath)PathIndex;
+		Result.ActionCount = ActionCount;
+		Result.TrackerCount = TrackerCount;
+		Result.CallsPerFrame = CallsPerFrame[PathIndex];
+		Result.MicrosecondsPerFrame = TotalSeconds[PathIndex] * 1000000.0 / FrameCount;
+		Result.MicrosecondsPerCall = Result.CallsPerFrame > 0 ? Result.MicrosecondsPerFrame / Result.CallsPerFrame : 0.0;
+		Result.MaxMicrosecondsPerFrame = MaxSeconds[PathIndex] * 1000000.0;
+		Result.BudgetMicroseconds = Budgets.Microseconds[PathIndex];
+	}
+
+	Device.StopMockRuntime();
+}
+
+void FSteamVRInputBenchmark::RunIdleSnapshot(int32 FrameCount)
+{
+	TUniquePtr<FSteamVRInputDevice> IsolatedDevice = MakeIsolatedDevice();
+	FSteamVRInputDevice& Device = *IsolatedDevice;
+
+	FSteamVRMockRuntimeSettings Settings;
+	if (!Device.StartMockRuntime(Settings))
+	{
+		return;
+	}
+
+	// Count only the frames sent below, the counts of the engine's last frame are flushed first
+	const bool bWasCounting = FSteamVRInputCallCounter::IsEnabled();
+	FSteamVRInputCallCounter::SetEnabled(true);
+	FSteamVRInputCallCounter::EndFrame();
+
+	for (int32 FrameIndex = 0; FrameIndex < FrameCount; ++FrameIndex)
+	{
+		Device.MockRuntime->Tick(BENCHMARK_FRAME_SECONDS);
+		Device.SendControllerEvents();
+	}
+
+	FSteamVRInputCallCounter::EndFrame();
+	FSteamVRInputCallCounter::SetEnabled(bWasCounting);
+
+	IdleSkeletalCallCount = 0;
+	for (int32 MethodIndex = 0; MethodIndex < FSteamVRInputCallCounter::GetMethodCount(VRInterface_Input); ++MethodIndex)
+	{
+		if (FCString::Strncmp(FSteamVRInputCallCounter::GetMethodName(VRInterface_Input, MethodIndex), TEXT("GetSkeletal"), 11) == 0)
+		{
+			IdleSkeletalCallCount += FSteamVRInputCallCounter::GetFrameCallCount(VRInterface_Input, MethodIndex);
+		}
+	}
+
+	Device.StopMockRuntime();
+}
+
+void FSteamVRInputBenchmark::AddBenchmarkActions(FSteamVRInputDevice& Device, int32 ActionCount)
+{
+	FScopeLock ActionStateScopeLock(&Device.ActionStateLock);
+	if (Device.SteamVRInputActionSets.Num() == 0)
+	{
+		return;
+	}
+
+	// A third each of digital, 1D and 2D analog actions, sent on keys of their own
+	static const EActionType ActionTypes[] = { Boolean, Vector1, Vector2 };
+	static const EActionDispatchKind DispatchKinds[] = { ActionDispatch_Digital, ActionDispatch_Analog1D, ActionDispatch_Analog2D };
+	for (int32 ActionIndex = 0; ActionIndex < ActionCount; ++ActionIndex)
+	{
+		const FString ActionName = FString::Printf(TEXT("Benchmark%d"), ActionIndex);
+		const FString ActionPath = FString(TEXT(ACTION_PATH_IN)) / ActionName.ToLower();
+
+		VRActionHandle_t ActionHandle = k_ulInvalidActionHandle;
+		if (FSteamVRInputRuntime::VRInput()->GetActionHandle(TCHAR_TO_UTF8(*ActionPath), &ActionHandle) != VRInputError_None)
+		{
+			continue;
+		}
+
+		FSteamVRInputAction& Action = Device.ActionEvents.Add_GetRef(FSteamVRInputAction(ActionPath, ActionTypes[ActionIndex % 3], false, FName(*ActionName), FString()));
+		Action.Handle = ActionHandle;
+		Action.bState = false;
+		Action.TemporaryKeyX = FName(*(ActionName + TEXT("_X")));
+		Action.TemporaryKeyY = FName(*(ActionName + TEXT("_Y")));
+
+		Device.ActionDispatchList.Add(FSteamVRActionDispatch(ActionHandle, Device.ActionEvents.Num() - 1, DispatchKinds[ActionIndex % 3]));
+		Device.SteamVRInputActionSets[0].DispatchIndices.Add(Device.ActionDispatchList.Num() - 1);
+	}
+
+	Device.ResetPolledDigitalStates();
+}
@@ -33,6 +33,12 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "Runtime/ApplicationCore/Public/GenericPlatform/IInputInterface.h"
 #include "HAL/FileManagerGeneric.h"
 #include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Parse.h"
+#include "Misc/CommandLine.h"
+#include "Async/Async.h"
+#include "Misc/Paths.h"
+#include "RenderingThread.h"
 #include "GameFramework/PlayerInput.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
@@ -43,6 +49,10 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "IMotionController.h"
 #include "Runtime/HeadMountedDisplay/Public/IXRTrackingSystem.h"
 #include "SteamVRSkeletonDefinition.h"
+#include "SteamVRInputRuntime.h"
+#include "SteamVRInputBenchmark.h"
+#include "SteamVRInputStats.h"
+#include "SteamVRInputTrace.h"
 
 #if PLATFORM_WINDOWS
 #include "Windows/WindowsHWrapper.h"
@@ -100,15 +110,35 @@ static const int32 kMirrorTranslationOnlyBones[] = {
 
 
 FSteamVRInputDevice::FSteamVRInputDevice(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler)
-	: MessageHandler(InMessageHandler)
+	: FSteamVRInputDevice(InMessageHandler, false)
 {
+}
+
+FSteamVRInputDevice::FSteamVRInputDevice(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler, bool bInIsIsolated)
+	: bIsIsolated(bInIsIsolated)
+	, MessageHandler(InMessageHandler)
+{
+	// An isolated device only ever runs against a mock runtime, and stays out of the engine's keys, config and modular features
+	if (bIsIsolated)
+	{
+		ConnectionState = SteamVRConnection_Dormant;
+		InitBoneConversions();
+		InitControllerMappings();
+		return;
+	}
+
+	// SteamVR is never probed in sessions without a headset, only a mock runtime or input replay can stand in for it
+	if (FParse::Param(FCommandLine::Get(), TEXT("nohmd")))
+	{
+		ConnectionState = SteamVRConnection_Dormant;
+	}
+
 	// Initializations
-	InitSteamVRSystem();
+	InitBoneConversions();
 	InitControllerMappings();
 	InitControllerKeys();
 
 #if WITH_EDITOR
-	GenerateActionManifest();
 	// TODO: Auto-enable SteamVR Input Developer Mode (reload hmd module)
 	//if (VRSettings() != nullptr)
 	//{
@@ -125,58 +155,306 @@ FSteamVRInputDevice::FSteamVRInputDevice(const TSharedRef<FGenericApplicationMes
 	//}
 #endif
 
+	// Optionally read digital actions on a dedicated thread, independently of the frame rate
+	float ConfiguredPollingRate = 0.f;
+	if (GConfig != nullptr && GConfig->GetFloat(TEXT(INPUT_CONFIG_SECTION), TEXT("InputPollingRate"), ConfiguredPollingRate, GGameIni))
+	{
+		SetInputPollingRate(ConfiguredPollingRate);
+	}
+
+	// Haptic requests that overlap on a hand play the loudest by default, or add up
+	FString ConfiguredHapticMixMode;
+	if (GConfig != nullptr && GConfig->GetString(TEXT(INPUT_CONFIG_SECTION), TEXT("HapticMixMode"), ConfiguredHapticMixMode, GGameIni))
+	{
+		SetHapticMixMode(ConfiguredHapticMixMode.Equals(TEXT("Sum"), ESearchCase::IgnoreCase) ? HapticMix_Sum : HapticMix_Max);
+	}
+
+	// Analog values are only sent when they move by default, or every frame
+	bool bConfiguredSendAnalogChangesOnly = true;
+	if (GConfig != nullptr && GConfig->GetBool(TEXT(INPUT_CONFIG_SECTION), TEXT("SendAnalogChangesOnly"), bConfiguredSendAnalogChangesOnly, GGameIni))
+	{
+		SetSendAnalogChangesOnly(bConfiguredSendAnalogChangesOnly);
+	}
+
+	// Simulate SteamVR on machines without a headset, before any recording so the simulation can be recorded. Its handles are resolved below
+	if (FParse::Param(FCommandLine::Get(), TEXT("SteamVRInputMock")))
+	{
+		FSteamVRMockRuntimeSettings MockSettings;
+		FParse::Value(FCommandLine::Get(), TEXT("SteamVRInputMockTrackers="), MockSettings.TrackerCount);
+		FParse::Value(FCommandLine::Get(), TEXT("SteamVRInputMockFixedStep="), MockSettings.FixedDeltaTime);
+		InstallMockRuntime(MockSettings);
+	}
+
+	// Count calls into SteamVR per frame for stats and CSV profiles, unless turned off
+	bool bCountOpenVRCalls = (STATS || CSV_PROFILER);
+	if (GConfig != nullptr)
+	{
+		GConfig->GetBool(TEXT(INPUT_CONFIG_SECTION), TEXT("bCountOpenVRCalls"), bCountOpenVRCalls, GGameIni);
+	}
+	FSteamVRInputCallCounter::SetEnabled(bCountOpenVRCalls);
+
+	// Measure the input paths once the engine is up, then exit with whether they stayed within budget
+	bRunBenchmarkOnTick = FParse::Param(FCommandLine::Get(), TEXT("SteamVRInputBenchmark"));
+
+	// Replay recorded input instead of reading SteamVR (e.g. benchmarks on machines without a headset), or record it
+	FString CommandLineRecordingPath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("SteamVRInputReplay="), CommandLineRecordingPath))
+	{
+		StartInputReplay(CommandLineRecordingPath);
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("SteamVRInputRecord="), CommandLineRecordingPath))
+	{
+		StartInputRecording(CommandLineRecordingPath);
+	}
+
+	// Write and register the action manifest and resolve its handles in the background, input comes online when that completes.
+	// Starting a recording or a replay above already registered it
+	if (!InputRecorder.IsValid() && !InputReplay.IsValid())
+	{
+		if (ConnectionState != SteamVRConnection_Dormant)
+		{
+			BeginAsyncInitialization();
+		}
+		else if (MockRuntime.IsValid())
+		{
+			InitSteamVRSystem();
+		}
+	}
+
 	IModularFeatures::Get().RegisterModularFeature(GetModularFeatureName(), this);
 }
 
 FSteamVRInputDevice::~FSteamVRInputDevice()
 {
-	IModularFeatures::Get().UnregisterModularFeature(GetModularFeatureName(), this);
+	// The worker registering the startup action manifest calls into this device
+	if (AsyncInitialization.IsValid())
+	{
+		AsyncInitialization.Wait();
+		AsyncInitialization = TFuture<void>();
+	}
+
+	// Stop the polling thread before anything it reads goes away
+	InputPoller.Reset();
+
+	// Write any input recording, and stop serving OpenVR calls from objects about to be destroyed
+	StopInputRecording();
+	if (InputReplay.IsValid())
+	{
+		FSteamVRInputRuntime::ClearOverride();
+		InputReplay.Reset();
+	}
+	MockRuntime.Reset();
+
+	if (!bIsIsolated)
+	{
+		IModularFeatures::Get().UnregisterModularFeature(GetModularFeatureName(), this);
+	}
 }
 
-void FSteamVRInputDevice::InitSteamVRSystem()
+bool FSteamVRInputDevice::InitSteamVRSystem()
 {
 	//UE_LOG(LogTemp, Warning, TEXT("Attempting to load steam VR System..."));
 
+	// The interfaces can't be reloaded under the worker registering the startup action manifest
+	FinishAsyncInitialization(true);
+
+	// Dormant sessions only come online through a mock runtime or input replay
+	if (ConnectionState == SteamVRConnection_Dormant && !FSteamVRInputRuntime::IsOverridden())
+	{
+		return false;
+	}
+
+	// Keep the polling thread out of SteamVR while the interfaces are reloaded
+	FScopeLock ActionStateScopeLock(&ActionStateLock);
+	FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+
 	// Clear out pointers as we aren't calling Init with the new OpenVR header
 	OpenVRInternal_ModuleContext().Clear();
 
-	if (VRSystem() && VRInput() && IsInGameThread())
+	const bool bIsConnected = FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput() && IsInGameThread();
+	if (bIsConnected)
 	{
 		UE_LOG(LogSteamVRInputDevice, Display, TEXT("SteamVR runtime %u.%u.%u loaded."), k_nSteamVRVersionMajor, k_nSteamVRVersionMinor, k_nSteamVRVersionBuild);
-		
-		// Set Skeletal Handles
-		bIsSkeletalControllerLeftPresent = SetSkeletalHandle(TCHAR_TO_UTF8(*FString(TEXT(ACTION_PATH_SKELETON_LEFT))), VRSkeletalHandleLeft);
-		bIsSkeletalControllerRightPresent = SetSkeletalHandle(TCHAR_TO_UTF8(*FString(TEXT(ACTION_PATH_SKELETON_RIGHT))), VRSkeletalHandleRight);
 
-		// (Re)Load Action Manifest
+		// (Re)Load Action Manifest, this also sets the skeletal and haptic handles
 		GenerateActionManifest(false, false, true, false);
 
-		// Set haptic handles
-		LastInputError = VRInput()->GetActionHandle(TCHAR_TO_UTF8(*FString(TEXT(ACTION_PATH_VIBRATE_LEFT))), &VRVibrationLeft);
-		if (LastInputError != VRInputError_None || VRVibrationLeft == k_ulInvalidActionHandle)
+		DeviceSignature = 2019;
+	}
+
+	if (ConnectionState != SteamVRConnection_Dormant)
+	{
+		SetConnectionResult(bIsConnected);
+	}
+	return bIsConnected;
+}
+
+void FSteamVRInputDevice::SetConnectionResult(bool bIsConnected)
+{
+	if (bIsConnected)
+	{
+		ConnectionState = SteamVRConnection_Connected;
+		ConnectedInitToken = VR_GetInitToken();
+		ReconnectInterval = RECONNECT_INTERVAL_MIN;
+	}
+	else
+	{
+		// Back off so a machine without SteamVR running isn't probed every frame
+		ConnectionState = SteamVRConnection_Disconnected;
+		NextReconnectTime = FPlatformTime::Seconds() + ReconnectInterval;
+		ReconnectInterval = FMath::Min(ReconnectInterval * 2.0, RECONNECT_INTERVAL_MAX);
+	}
+}
+
+void FSteamVRInputDevice::UpdateConnection()
+{
+	switch (ConnectionState)
+	{
+	case SteamVRConnection_Connected:
+		// The HMD module shuts OpenVR down when SteamVR quits and reinitializes it when SteamVR comes back, both change the init token
+		if (!FSteamVRInputRuntime::IsOverridden() && VR_GetInitToken() != ConnectedInitToken)
 		{
-			VRVibrationLeft = k_ulInvalidActionHandle;
+			UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] SteamVR shut down or restarted, reconnecting"));
+			ReconnectInterval = RECONNECT_INTERVAL_MIN;
+			InitSteamVRSystem();
 		}
+		break;
 
-		LastInputError = VRInput()->GetActionHandle(TCHAR_TO_UTF8(*FString(TEXT(ACTION_PATH_VIBRATE_RIGHT))), &VRVibrationRight);
-		if (LastInputError != VRInputError_None || VRVibrationRight == k_ulInvalidActionHandle)
+	case SteamVRConnection_Disconnected:
+		if (FPlatformTime::Seconds() >= NextReconnectTime)
 		{
-			VRVibrationRight = k_ulInvalidActionHandle;
+			InitSteamVRSystem();
 		}
+		break;
+
+	default:
+		break;
+	}
+}
 
+bool FSteamVRInputDevice::IsSteamVRActive() const
+{
+	return ConnectionState == SteamVRConnection_Connected || FSteamVRInputRuntime::IsOverridden();
+}
+
+void FSteamVRInputDevice::BeginAsyncInitialization()
+{
+	// Clear out pointers as we aren't calling Init with the new OpenVR header
+	OpenVRInternal_ModuleContext().Clear();
+
+	// The connection is only set once the handles are resolved, in FinishAsyncInitialization
+	const bool bIsSteamVRAvailable = FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput();
+	if (bIsSteamVRAvailable)
+	{
+		UE_LOG(LogSteamVRInputDevice, Display, TEXT("SteamVR runtime %u.%u.%u loaded."), k_nSteamVRVersionMajor, k_nSteamVRVersionMinor, k_nSteamVRVersionBuild);
 		DeviceSignature = 2019;
 	}
+
+#if WITH_EDITOR
+	// The editor keeps the action manifest and controller bindings up to date, with or without SteamVR
+	AsyncManifestBuild = MakeShared<FSteamVRActionManifestBuild, ESPMode::ThreadSafe>(true, true, true, false, false);
+#else
+	if (!bIsSteamVRAvailable)
+	{
+		SetConnectionResult(false);
+		return;
+	}
+	AsyncManifestBuild = MakeShared<FSteamVRActionManifestBuild, ESPMode::ThreadSafe>(false, false, true, false, false);
+#endif
+
+	// Reading the input settings and registering temporary keys has to happen on the game thread
+	GatherActionManifest(*AsyncManifestBuild);
+
+	// Binding files, the manifest and SteamVR are only touched by the worker until the build is applied in Tick.
+	// Everything the worker produces goes to the shared build. It captures this device only for members the game thread leaves alone
+	// until the build is applied, like GameFileName. The destructor, and everything that rebuilds the manifest or swaps the runtime,
+	// waits for the worker first, so the device outlives it
+	TSharedRef<FSteamVRActionManifestBuild, ESPMode::ThreadSafe> WorkerBuild = AsyncManifestBuild.ToSharedRef();
+	AsyncInitialization = Async(EAsyncExecution::ThreadPool, [this, WorkerBuild]()
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SteamVRInput_ActionManifest);
+		CSV_SCOPED_TIMING_STAT(SteamVRInput, ActionManifest);
+
+		if (WriteActionManifest(*WorkerBuild) && WorkerBuild->bRegisterApp)
+		{
+			RegisterApplication(*WorkerBuild);
+		}
+	});
+}
+
+bool FSteamVRInputDevice::FinishAsyncInitialization(bool bWait)
+{
+	// Applying the build rebuilds what the game thread reads without a lock, and registers temporary keys
+	check(IsInGameThread());
+
+	if (!AsyncInitialization.IsValid())
+	{
+		return true;
+	}
+
+	if (!bWait && !AsyncInitialization.IsReady())
+	{
+		return false;
+	}
+
+	AsyncInitialization.Wait();
+	AsyncInitialization = TFuture<void>();
+
+	ApplyActionManifest(*AsyncManifestBuild);
+
+	// Input comes online only now that the handles are in place, a failed registration is retried with backoff
+	if (ConnectionState != SteamVRConnection_Dormant)
+	{
+		SetConnectionResult(AsyncManifestBuild->bIsRegistered);
+	}
+	AsyncManifestBuild.Reset();
+
+	UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Input is online with %d action events"), ActionEvents.Num());
+	return true;
 }
 
 void FSteamVRInputDevice::Tick(float DeltaTime)
 {
-	// Place current delta time in buffer for use in determining haptic duration
-	CurrentDeltaTime = DeltaTime;
+	// Calls into SteamVR since the last Tick make up a frame
+	if (FSteamVRInputCallCounter::IsEnabled())
+	{
+		FSteamVRInputCallCounter::EndFrame();
+	}
 
-	// Watch for SteamVR availability & restarts
-	if (!VRSystem())
+	if (bRunBenchmarkOnTick)
 	{
-		InitSteamVRSystem();
+		bRunBenchmarkOnTick = false;
+		FSteamVRInputBenchmark Benchmark(*this);
+		const bool bIsWithinBudget = Benchmark.Run(*GLog);
+		FPlatformMisc::RequestExitWithStatus(false, bIsWithinBudget ? 0 : 1);
+	}
+
+	// Advance the simulation, then start recording or serving this frame's input before any of it is read
+	if (MockRuntime.IsValid())
+	{
+		MockRuntime->Tick(DeltaTime);
+	}
+
+	if (InputRecorder.IsValid())
+	{
+		InputRecorder->BeginFrame();
+	}
+	else if (InputReplay.IsValid() && !InputReplay->BeginFrame() && !bInputReplayEnded)
+	{
+		UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Input replay ended after %d frames, the last frame keeps being replayed"), InputReplay->GetFrameCount());
+		bInputReplayEnded = true;
+	}
+
+	// Bring input online once the startup action manifest is registered, then watch for SteamVR availability & restarts
+	if (FinishAsyncInitialization(false))
+	{
+		UpdateConnection();
+	}
+
+	// Tracking space only changes on user request, so read it once per frame for all pose queries
+	if (IsSteamVRActive() && FSteamVRInputRuntime::VRCompositor())
+	{
+		CachedTrackingSpace = FSteamVRInputRuntime::VRCompositor()->GetTrackingSpace();
 	}
 
 	// Cache the controller transform to ensure ResetOrientationAndPosition gets the correct values (Valid for UE4.18 upwards)
@@ -191,6 +469,26 @@ void FSteamVRInputDevice::Tick(float DeltaTime)
 		CachedBaseOrientation = FQuat::Identity;
 		CachedBasePosition = FVector::ZeroVector;
 	}
+
+	// Turn this frame's mixed haptic requests into seamless continuous vibrations
+	const double HapticTime = FPlatformTime::Seconds();
+	for (int32 HandIndex = 0; HandIndex < 2; ++HandIndex)
+	{
+		FSteamVRHapticFrameRequest& HapticFrameRequest = HapticFrameRequests[HandIndex];
+		if (HapticFrameRequest.bIsSet)
+		{
+			HapticScheduler.SetContinuous(HandIndex, HapticFrameRequest.Amplitude, HapticFrameRequest.Frequency, HapticTime);
+			HapticFrameRequest = FSteamVRHapticFrameRequest();
+		}
+	}
+
+	// Send the haptic patterns due within the lookahead, including those converted from audio
+	AudioHaptics.Tick(HapticScheduler, HapticTime);
+	if (IsSteamVRActive() && FSteamVRInputRuntime::VRInput())
+	{
+		const VRActionHandle_t VibrationActions[2] = { VRVibrationLeft, VRVibrationRight };
+		HapticScheduler.Flush(FSteamVRInputRuntime::VRInput(), VibrationActions, HapticTime);
+	}
 }
 
 void FSteamVRInputDevice::FindAxisMappings(const UInputSettings* InputSettings, const FName InAxisName, TArray<FInputAxisKeyMapping>& OutMappings) const
@@ -239,624 +537,963 @@ FString FSteamVRInputDevice::SanitizeString(FString& InString)
 	return SanitizedString;
 }
 
-FTransform CalcModelSpaceTransform(const FTransform* OutBoneTransform, int32 BoneIndex)
+// Retrieve the action path that a generated controller binding source outputs to
+static FString GetBindingSourceOutputPath(const TSharedPtr<FJsonValue>& SourceJsonValue)
 {
-	FTransform BoneTransformMS = OutBoneTransform[BoneIndex];
-
-	while (BoneIndex != -1)
+	const TSharedPtr<FJsonObject>* SourceJsonObject = nullptr;
+	const TSharedPtr<FJsonObject>* InputsJsonObject = nullptr;
+	if (SourceJsonValue.IsValid() && SourceJsonValue->TryGetObject(SourceJsonObject)
+		&& (*SourceJsonObject)->TryGetObjectField(TEXT("inputs"), InputsJsonObject))
 	{
-		int32 parentIndex = SteamVRSkeleton::GetParentIndex(BoneIndex);
-		if (parentIndex != -1)
+		for (const auto& Input : (*InputsJsonObject)->Values)
 		{
-			BoneTransformMS = BoneTransformMS * OutBoneTransform[parentIndex];
-			BoneIndex = parentIndex;
-		}
-		else
-		{
-			break;
+			const TSharedPtr<FJsonObject>* InputJsonObject = nullptr;
+			FString OutputPath;
+			if (Input.Value.IsValid() && Input.Value->TryGetObject(InputJsonObject) && (*InputJsonObject)->TryGetStringField(TEXT("output"), OutputPath))
+			{
+				return OutputPath;
+			}
 		}
 	}
 
-	return BoneTransformMS;
+	return FString();
 }
 
-bool FSteamVRInputDevice::GetSkeletalData(bool bLeftHand, bool bMirror, EVRSkeletalMotionRange MotionRange, FTransform* OutBoneTransform, int32 OutBoneTransformCount)
+// Convert a controller hand to the mask of hands haptics are played on: left (1), right (2), any for both (3)
+static int32 GetHapticHandMask(EControllerHand Hand)
 {
-	// Check that the size of the buffer we will be writing into is big enough to hold all the bone transforms
-	if (OutBoneTransformCount < STEAMVR_SKELETON_BONE_COUNT)
+	switch (Hand)
 	{
-		return false;
+	case EControllerHand::Left:
+		return 1;
+	case EControllerHand::Right:
+		return 2;
+	case EControllerHand::AnyHand:
+		return 3;
+	default:
+		return 0;
 	}
+}
 
-	if (VRSystem() && VRInput())
+// Classify how an action event is read from SteamVR and sent to the engine each frame
+static EActionDispatchKind ClassifyActionDispatch(const FSteamVRInputAction& Action)
+{
+	switch (Action.Type)
 	{
-		// Get the handle for the skeletal action.  If its invalid (the necessary skeletal action is not in the manifest) then return false
-		vr::VRActionHandle_t ActionHandle = (bLeftHand) ? VRSkeletalHandleLeft : VRSkeletalHandleRight;
-		if (ActionHandle == k_ulInvalidActionHandle)
-		{
-			return false;
-		}
+	case EActionType::Boolean:
+		// Boolean actions that back an axis are not dispatched as buttons
+		return (Action.Path.Contains(TEXT(" axis")) || Action.Path.Contains(TEXT("_axis"))) ? ActionDispatch_None : ActionDispatch_Digital;
+	case EActionType::Vector1:
+		return ActionDispatch_Analog1D;
+	case EActionType::Vector2:
+	case EActionType::Vector3:
+		return ActionDispatch_Analog2D;
+	case EActionType::Pose:
+		return ActionDispatch_Pose;
+	case EActionType::Skeleton:
+		return ActionDispatch_Skeletal;
+	case EActionType::Vibration:
+		return ActionDispatch_Vibration;
+	default:
+		return ActionDispatch_None;
+	}
+}
 
-		// Get skeletal data
-		VRBoneTransform_t SteamVRBoneTransforms[STEAMVR_SKELETON_BONE_COUNT];
-		EVRInputError Err = VRInput()->GetSkeletalBoneData(ActionHandle, vr::EVRSkeletalTransformSpace::VRSkeletalTransformSpace_Parent, MotionRange, SteamVRBoneTransforms, STEAMVR_SKELETON_BONE_COUNT);
-		
-		if (Err != VRInputError_None)
-		{
-			return false;
-		}
+// Convert bone transforms from SteamVR's coordinate system to UE4's coordinate system, one bone and component at a time.
+// Used as the reference for building the per-bone conversions of FSteamVRInputDevice::ConvertSteamVRSkeleton
+static void ConvertSteamVRBoneTransforms(const VRBoneTransform_t* SteamVRBoneTransforms, FTransform* OutBoneTransform)
+{
+	// GetSkeletalBoneData returns bone transforms are in SteamVR's coordinate system, so
+	// we need to convert them to UE4's coordinate system.  
+	// SteamVR coords:	X=right,	Y=up,		Z=backwards,	right-handed,	scale is meters
+	// UE4 coords:		X=forward,	Y=right,	Z=up,			left-handed,	scale is centimeters
+
+	// The root is positioned at the controller's anchor position with zero rotation.  
+	// However because of the conversion from SteamVR coordinates to Unreal coordinates the root bone is scaled
+	// to the new coordinate system
+	FTransform& RootTransform = OutBoneTransform[ESteamVRBone_Root];
+	RootTransform.SetComponents(FQuat::Identity, FVector::ZeroVector, FVector(100.f, 100.f, 100.f));
+
+	// Transform all the non-root bones to the new coordinate system
+	for (int32 BoneIndex = ESteamVRBone_Root + 1; BoneIndex < STEAMVR_SKELETON_BONE_COUNT; ++BoneIndex)
+	{
+		const VRBoneTransform_t& SrcTransform = SteamVRBoneTransforms[BoneIndex];
+
+		FQuat NewRotation(
+			SrcTransform.orientation.z,
+			-SrcTransform.orientation.x,
+			SrcTransform.orientation.y,
+			-SrcTransform.orientation.w
+		);
+
+		FVector NewTranslation(
+			SrcTransform.position.v[2],
+			-SrcTransform.position.v[0],
+			SrcTransform.position.v[1]
+		);
+
+		FTransform& DstTransform = OutBoneTransform[BoneIndex];
+		DstTransform.SetRotation(NewRotation);
+		DstTransform.SetTranslation(NewTranslation);
+	}
 
-		// Optionally mirror the pose to the opposite hand
-		if (bMirror)
-		{
-			MirrorSteamVRSkeleton(SteamVRBoneTransforms, STEAMVR_SKELETON_BONE_COUNT);
-		}
+	// Apply an extra transformation to the children of the root bone to compensate for the changes made to the root
+	// to make it fit the new coordinate system even though it has zero rotation
+	FQuat FixupRotation(FVector(0.f, 0.f, 1.f), PI);
+
+	for (int32 ChildIndex = 0; ChildIndex < SteamVRSkeleton::GetChildCount(ESteamVRBone_Root); ++ChildIndex)
+	{
+		int32 BoneIndex = SteamVRSkeleton::GetChildIndex(ESteamVRBone_Root, ChildIndex);
+
+		FTransform& DstTransform = OutBoneTransform[BoneIndex];
 
-		// GetSkeletalBoneData returns bone transforms are in SteamVR's coordinate system, so
-		// we need to convert them to UE4's coordinate system.  
-		// SteamVR coords:	X=right,	Y=up,		Z=backwards,	right-handed,	scale is meters
-		// UE4 coords:		X=forward,	Y=right,	Z=up,			left-handed,	scale is centimeters
+		FVector NewTranslation = DstTransform.GetTranslation() * FVector(-1.f, -1.f, 1.f);
+		FQuat NewRotation = FixupRotation * DstTransform.GetRotation();
 
-		// The root is positioned at the controller's anchor position with zero rotation.  
-		// However because of the conversion from SteamVR coordinates to Unreal coordinates the root bone is scaled
-		// to the new coordinate system
-		FTransform& RootTransform = OutBoneTransform[ESteamVRBone_Root];
-		RootTransform.SetComponents(FQuat::Identity, FVector::ZeroVector, FVector(100.f, 100.f, 100.f));
+		DstTransform.SetRotation(NewRotation);
+		DstTransform.SetTranslation(NewTranslation);
+	}
+}
 
-		// Transform all the non-root bones to the new coordinate system
-		for (int32 BoneIndex = ESteamVRBone_Root + 1; BoneIndex < STEAMVR_SKELETON_BONE_COUNT; ++BoneIndex)
+void FSteamVRInputDevice::InitBoneConversions()
+{
+	// Every step of turning a SteamVR bone into a UE4 bone (mirroring, axis swizzle, sign flips and the root children fixup) only
+	// moves and negates components. Push each basis component through the scalar path once to find where it lands for every bone
+	for (int32 MirrorIndex = 0; MirrorIndex < 2; ++MirrorIndex)
+	{
+		for (int32 ComponentIndex = 0; ComponentIndex < 4; ++ComponentIndex)
 		{
-			const VRBoneTransform_t& SrcTransform = SteamVRBoneTransforms[BoneIndex];
+			VRBoneTransform_t BasisBoneTransforms[STEAMVR_SKELETON_BONE_COUNT];
+			FMemory::Memzero(BasisBoneTransforms);
 
-			FQuat NewRotation(
-				SrcTransform.orientation.z,
-				-SrcTransform.orientation.x,
-				SrcTransform.orientation.y,
-				-SrcTransform.orientation.w
-			);
+			for (int32 BoneIndex = 0; BoneIndex < STEAMVR_SKELETON_BONE_COUNT; ++BoneIndex)
+			{
+				// HmdQuaternionf_t is laid out as w, x, y, z
+				float* Orientation = &BasisBoneTransforms[BoneIndex].orientation.w;
+				Orientation[ComponentIndex] = 1.f;
+				BasisBoneTransforms[BoneIndex].position.v[ComponentIndex] = 1.f;
+			}
 
-			FVector NewTranslation(
-				SrcTransform.position.v[2],
-				-SrcTransform.position.v[0],
-				SrcTransform.position.v[1]
-			);
+			FTransform BasisTransforms[STEAMVR_SKELETON_BONE_COUNT];
+			ConvertSteamVRSkeletonScalar(BasisBoneTransforms, MirrorIndex == 1, BasisTransforms);
+
+			for (int32 BoneIndex = ESteamVRBone_Root + 1; BoneIndex < STEAMVR_SKELETON_BONE_COUNT; ++BoneIndex)
+			{
+				// Round away the float error of the PI rotation used by the root children fixup so the kernel is an exact signed permutation
+				const FQuat Rotation = BasisTransforms[BoneIndex].GetRotation();
+				const FVector Translation = BasisTransforms[BoneIndex].GetTranslation();
 
-			FTransform& DstTransform = OutBoneTransform[BoneIndex];
-			DstTransform.SetRotation(NewRotation);
-			DstTransform.SetTranslation(NewTranslation);
+				FSteamVRBoneConversion& BoneConversion = BoneConversions[MirrorIndex][BoneIndex];
+				BoneConversion.RotationColumns[ComponentIndex] = MakeVectorRegister(FMath::RoundToFloat(Rotation.X), FMath::RoundToFloat(Rotation.Y), FMath::RoundToFloat(Rotation.Z), FMath::RoundToFloat(Rotation.W));
+				BoneConversion.TranslationColumns[ComponentIndex] = MakeVectorRegister(FMath::RoundToFloat(Translation.X), FMath::RoundToFloat(Translation.Y), FMath::RoundToFloat(Translation.Z), 0.f);
+			}
 		}
+	}
+}
+
+void FSteamVRInputDevice::ConvertSteamVRSkeleton(const VRBoneTransform_t* SteamVRBoneTransforms, bool bMirror, FTransform* OutBoneTransform) const
+{
+	// The root is positioned at the controller's anchor position with zero rotation, scaled to the UE4 coordinate system
+	OutBoneTransform[ESteamVRBone_Root].SetComponents(FQuat::Identity, FVector::ZeroVector, FVector(100.f, 100.f, 100.f));
 
-		// Apply an extra transformation to the children of the root bone to compensate for the changes made to the root
-		// to make it fit the new coordinate system even though it has zero rotation
-		FQuat FixupRotation(FVector(0.f, 0.f, 1.f), PI);
+	// Mirror and convert all the non-root bones in a single pass, as a multiply-add against each bone's precomputed conversion
+	const FSteamVRBoneConversion* Conversions = BoneConversions[bMirror ? 1 : 0];
+	for (int32 BoneIndex = ESteamVRBone_Root + 1; BoneIndex < STEAMVR_SKELETON_BONE_COUNT; ++BoneIndex)
+	{
+		const VRBoneTransform_t& SrcTransform = SteamVRBoneTransforms[BoneIndex];
+		const FSteamVRBoneConversion& Conversion = Conversions[BoneIndex];
 
-		for (int32 ChildIndex = 0; ChildIndex < SteamVRSkeleton::GetChildCount(ESteamVRBone_Root); ++ChildIndex)
-		{
-			int32 BoneIndex = SteamVRSkeleton::GetChildIndex(ESteamVRBone_Root, ChildIndex);
+		const VectorRegister SrcRotation = VectorLoad(&SrcTransform.orientation.w);
+		VectorRegister NewRotation = VectorMultiply(VectorReplicate(SrcRotation, 0), Conversion.RotationColumns[0]);
+		NewRotation = VectorMultiplyAdd(VectorReplicate(SrcRotation, 1), Conversion.RotationColumns[1], NewRotation);
+		NewRotation = VectorMultiplyAdd(VectorReplicate(SrcRotation, 2), Conversion.RotationColumns[2], NewRotation);
+		NewRotation = VectorMultiplyAdd(VectorReplicate(SrcRotation, 3), Conversion.RotationColumns[3], NewRotation);
 
-			FTransform& DstTransform = OutBoneTransform[BoneIndex];
+		const VectorRegister SrcTranslation = VectorLoad(SrcTransform.position.v);
+		VectorRegister NewTranslation = VectorMultiply(VectorReplicate(SrcTranslation, 0), Conversion.TranslationColumns[0]);
+		NewTranslation = VectorMultiplyAdd(VectorReplicate(SrcTranslation, 1), Conversion.TranslationColumns[1], NewTranslation);
+		NewTranslation = VectorMultiplyAdd(VectorReplicate(SrcTranslation, 2), Conversion.TranslationColumns[2], NewTranslation);
 
-			FVector NewTranslation = DstTransform.GetTranslation() * FVector(-1.f, -1.f, 1.f);
-			FQuat NewRotation = FixupRotation * DstTransform.GetRotation();
+		FQuat Rotation;
+		VectorStoreAligned(NewRotation, &Rotation);
 
-			DstTransform.SetRotation(NewRotation);
-			DstTransform.SetTranslation(NewTranslation);
-		}
+		FVector4 Translation;
+		VectorStoreAligned(NewTranslation, &Translation);
 
-		return true;
+		OutBoneTransform[BoneIndex].SetComponents(Rotation, FVector(Translation), FVector::OneVector);
 	}
-
-	return false;
 }
 
-void FSteamVRInputDevice::SendAnalogMessage(const ETrackedControllerRole TrackedControllerRole, const FGamepadKeyNames::Type AxisButton, float AnalogValue)
+void FSteamVRInputDevice::ConvertSteamVRSkeletonScalar(const VRBoneTransform_t* SteamVRBoneTransforms, bool bMirror, FTransform* OutBoneTransform) const
 {
-	if (TrackedControllerRole == ETrackedControllerRole::TrackedControllerRole_LeftHand && bCurlsAndSplaysEnabled_L)
-	{
-		MessageHandler->OnControllerAnalog(AxisButton, 0, AnalogValue);
-		//UE_LOG(LogSteamVRInputDevice, Warning, TEXT("Left Index value: %f for axis %s"), ControllerState.IndexGripAnalog, *AxisButton.ToString());
-	}
-	else if (TrackedControllerRole == ETrackedControllerRole::TrackedControllerRole_RightHand && bCurlsAndSplaysEnabled_R)
+	VRBoneTransform_t BoneTransforms[STEAMVR_SKELETON_BONE_COUNT];
+	FMemory::Memcpy(BoneTransforms, SteamVRBoneTransforms, sizeof(BoneTransforms));
+
+	if (bMirror)
 	{
-		MessageHandler->OnControllerAnalog(AxisButton, 0, AnalogValue);
-		//UE_LOG(LogSteamVRInputDevice, Warning, TEXT("Left Index value: %f for axis %s"), ControllerState.IndexGripAnalog, *AxisButton.ToString());
+		MirrorSteamVRSkeleton(BoneTransforms, STEAMVR_SKELETON_BONE_COUNT);
 	}
+
+	ConvertSteamVRBoneTransforms(BoneTransforms, OutBoneTransform);
 }
 
-void FSteamVRInputDevice::SendControllerEvents()
+bool FSteamVRInputDevice::GetCachedSkeletalData(bool bLeftHand, bool bMirror, EVRSkeletalMotionRange MotionRange, FTransform* OutBoneTransform)
 {
-
-	if (VRSystem() && VRInput() && SteamVRInputActionSets.Num() > 0)
+	if (IsSteamVRActive() && FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
-		EVRInputError ActionStateError = VRInput()->UpdateActionState(ActiveActionSets, sizeof(VRActiveActionSet_t), 1);
+		// Get the handle for the skeletal action.  If its invalid (the necessary skeletal action is not in the manifest) then there is no data
+		vr::VRActionHandle_t ActionHandle = (bLeftHand) ? VRSkeletalHandleLeft : VRSkeletalHandleRight;
+		if (ActionHandle == k_ulInvalidActionHandle)
+		{
+			return false;
+		}
+
+		const int32 RangeIndex = (MotionRange == VRSkeletalMotionRange_WithController) ? 0 : 1;
+		const int32 MirrorIndex = bMirror ? 1 : 0;
+
+		FScopeLock SkeletalCacheScopeLock(&SkeletalCacheLock);
+		FSteamVRCachedSkeleton& CachedSkeleton = SkeletalCache[bLeftHand ? 0 : 1][RangeIndex];
 
-		if (ActionStateError != VRInputError_None)
+		// Get skeletal data, once per frame for each hand and motion range
+		if (CachedSkeleton.FrameNumber != GFrameCounter)
 		{
-			//GetInputError(ActionStateError, TEXT("Error encountered when trying to update the action state"));
-			return;
+			CachedSkeleton.FrameNumber = GFrameCounter;
+			CachedSkeleton.bIsConverted[0] = false;
+			CachedSkeleton.bIsConverted[1] = false;
+
+			FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+			CachedSkeleton.InputError = FSteamVRInputRuntime::VRInput()->GetSkeletalBoneData(ActionHandle, vr::EVRSkeletalTransformSpace::VRSkeletalTransformSpace_Parent, MotionRange, CachedSkeleton.SteamVRBoneTransforms, STEAMVR_SKELETON_BONE_COUNT);
+		}
+
+		if (CachedSkeleton.InputError != VRInputError_None)
+		{
+			return false;
 		}
 
-		// Go through all Actions in all active ActionSets
-		for (auto& SteamVRInputActionSet : SteamVRInputActionSets)
+		// Mirror and convert each requested variant only once per frame
+		if (!CachedSkeleton.bIsConverted[MirrorIndex])
 		{
-			ProcessActionEvents(SteamVRInputActionSet);
+			ConvertSteamVRSkeleton(CachedSkeleton.SteamVRBoneTransforms, bMirror, CachedSkeleton.BoneTransforms[MirrorIndex]);
+			CachedSkeleton.bIsConverted[MirrorIndex] = true;
 		}
+
+		// Copy while still holding the lock, the next frame's fetch from another thread overwrites the cache
+		FMemory::Memcpy(OutBoneTransform, CachedSkeleton.BoneTransforms[MirrorIndex], sizeof(FTransform) * STEAMVR_SKELETON_BONE_COUNT);
+		return true;
 	}
+
+	return false;
 }
 
-void FSteamVRInputDevice::SetMessageHandler(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler)
+bool FSteamVRInputDevice::GetSkeletalData(bool bLeftHand, bool bMirror, EVRSkeletalMotionRange MotionRange, FTransform* OutBoneTransform, int32 OutBoneTransformCount)
 {
-	MessageHandler = InMessageHandler;
+	SCOPE_CYCLE_COUNTER(STAT_SteamVRInput_SkeletalData);
+	CSV_SCOPED_TIMING_STAT(SteamVRInput, SkeletalData);
+
+	// Check that the size of the buffer we will be writing into is big enough to hold all the bone transforms
+	if (OutBoneTransformCount < STEAMVR_SKELETON_BONE_COUNT)
+	{
+		return false;
+	}
+
+	return GetCachedSkeletalData(bLeftHand, bMirror, MotionRange, OutBoneTransform);
 }
 
-bool FSteamVRInputDevice::Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar)
+
+/** Bit of FSteamVRInputDevice::SnapshotRequests asking for the bones of a hand, motion range and mirroring */
+static int32 GetSnapshotBoneRequest(int32 HandIndex, int32 RangeIndex, int32 MirrorIndex)
 {
-	return false;
+	return 1 << (HandIndex * 4 + RangeIndex * 2 + MirrorIndex);
 }
 
-bool FSteamVRInputDevice::GetControllerOrientationAndPosition(const int32 ControllerIndex, const FName MotionSource, FRotator& OutOrientation, FVector& OutPosition, float WorldToMetersScale) const
+/** Bit of FSteamVRInputDevice::SnapshotRequests asking for the finger curls and splays of a hand and summary type */
+static int32 GetSnapshotSummaryRequest(int32 HandIndex, int32 SummaryTypeIndex)
 {
-	if (VRInput() && VRCompositor())
-	{
-		InputPoseActionData_t PoseData = {};
-		EVRInputError InputError = VRInputError_NoData;
+	return 1 << (8 + HandIndex * 2 + SummaryTypeIndex);
+}
 
-		VRActionHandle_t LeftActionHandle = bUseSkeletonPose ? VRSkeletalHandleLeft : VRControllerHandleLeft;
-		VRActionHandle_t RightActionHandle = bUseSkeletonPose ? VRSkeletalHandleRight : VRControllerHandleRight;
+/** Bit of FSteamVRInputDevice::SnapshotRequests asking for the controller pose of a hand */
+static int32 GetSnapshotPoseRequest(int32 HandIndex)
+{
+	return 1 << (12 + HandIndex);
+}
 
-		//UE_LOG(LogSteamVRInputDevice, Warning, TEXT("MOTION SOURCE: %s"), *MotionSource.ToString());
-		if (MotionSource.IsEqual(TEXT("Left")))
+void FSteamVRInputDevice::RequestSnapshotData(int32 Request) const
+{
+	// Readers request the same data every frame, so only the first request of a frame writes
+	int32 Requests = FPlatformAtomics::AtomicRead(&SnapshotRequests);
+	while ((Requests & Request) != Request)
+	{
+		const int32 PreviousRequests = FPlatformAtomics::InterlockedCompareExchange(&SnapshotRequests, Requests | Request, Requests);
+		if (PreviousRequests == Requests)
 		{
-			if (LeftActionHandle != vr::k_ulInvalidActionHandle)
-			{
-				if (GlobalPredictedSecondsFromNow <= -9999.f)
-				{
-					InputError = VRInput()->GetPoseActionDataForNextFrame(LeftActionHandle, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-				}
-				else
-				{
-					InputError = VRInput()->GetPoseActionDataRelativeToNow(LeftActionHandle, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-				}
-
-				if (InputError != VRInputError_None)
-				{
-					return false;
-				}
-			}
+			break;
 		}
-		else if (MotionSource.IsEqual(TEXT("Right")))
-		{
-			if (RightActionHandle != vr::k_ulInvalidActionHandle)
-			{
-				if (GlobalPredictedSecondsFromNow <= -9999.f)
-				{
-					InputError = VRInput()->GetPoseActionDataForNextFrame(RightActionHandle, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-				}
-				else
-				{
-					InputError = VRInput()->GetPoseActionDataRelativeToNow(RightActionHandle, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-				}
+		Requests = PreviousRequests;
+	}
+}
 
-				if (InputError != VRInputError_None)
-				{
-					return false;
-				}
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Camera")))
-		{
-			if (VRTRackerCamera == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+void FSteamVRInputDevice::PublishInputSnapshot()
+{
+	// Write into the buffer after the published one, readers only ever start on the published buffer
+	const int32 WriteIndex = (FPlatformAtomics::AtomicRead(&PublishedSnapshotIndex) + 1) % INPUT_SNAPSHOT_BUFFER_COUNT;
+	FSteamVRInputSnapshotBuffer& SnapshotBuffer = InputSnapshots[WriteIndex];
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTRackerCamera, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTRackerCamera, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+	// Only what was read since the last snapshot is read from SteamVR, nothing at all while there are no readers
+	const int32 Requests = FPlatformAtomics::InterlockedExchange(&SnapshotRequests, 0);
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Chest")))
-		{
-			if (VRTrackerChest == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+	// Mark the buffer as being written (odd sequence) so any late reader retries
+	FPlatformAtomics::InterlockedIncrement(&SnapshotBuffer.Sequence);
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerChest, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerChest, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+	FSteamVRInputSnapshot& Snapshot = SnapshotBuffer.Snapshot;
+	Snapshot.FrameNumber = GFrameCounter;
+	Snapshot.Requests = Requests;
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Waist")))
-		{
-			if (VRTrackerWaist == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+	for (int32 HandIndex = 0; HandIndex < 2; ++HandIndex)
+	{
+		const bool bLeftHand = (HandIndex == 0);
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerWaist, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerWaist, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+		// Skeletal bones, SteamVR is read once per motion range and shared by both mirroring variants through the skeletal cache
+		for (int32 RangeIndex = 0; RangeIndex < 2; ++RangeIndex)
+		{
+			const EVRSkeletalMotionRange MotionRange = (RangeIndex == 0) ? VRSkeletalMotionRange_WithController : VRSkeletalMotionRange_WithoutController;
 
-			if (InputError != VRInputError_None)
+			for (int32 MirrorIndex = 0; MirrorIndex < 2; ++MirrorIndex)
 			{
-				return false;
+				Snapshot.bHasBoneTransforms[HandIndex][RangeIndex][MirrorIndex] = (Requests & GetSnapshotBoneRequest(HandIndex, RangeIndex, MirrorIndex))
+					&& GetCachedSkeletalData(bLeftHand, MirrorIndex == 1, MotionRange, Snapshot.BoneTransforms[HandIndex][RangeIndex][MirrorIndex]);
 			}
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Foot_Left")))
+
+		// Finger curls and splays
+		for (int32 SummaryTypeIndex = 0; SummaryTypeIndex < 2; ++SummaryTypeIndex)
 		{
-			if (VRTrackerFootL == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+			Snapshot.bHasSkeletalSummaryData[HandIndex][SummaryTypeIndex] = (Requests & GetSnapshotSummaryRequest(HandIndex, SummaryTypeIndex))
+				&& QuerySkeletalSummaryData(bLeftHand, (EVRSummaryType)SummaryTypeIndex, Snapshot.SkeletalSummaryData[HandIndex][SummaryTypeIndex]);
+		}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerFootL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerFootL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+		// Controller pose, shared with the per-frame pose cache
+		const VRActionHandle_t ControllerHandle = bLeftHand ? VRControllerHandleLeft : VRControllerHandleRight;
+		Snapshot.bHasControllerPose[HandIndex] = (Requests & GetSnapshotPoseRequest(HandIndex)) && ControllerHandle != k_ulInvalidActionHandle
+			&& GetPoseActionData(ControllerHandle, Snapshot.ControllerPoses[HandIndex]) == VRInputError_None;
+	}
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
+	// Action states, written in place so a reader still on this buffer never follows freed memory
+	Snapshot.ActionStateCount = FMath::Min(ActionEvents.Num(), INPUT_SNAPSHOT_MAX_ACTIONS);
+	for (int32 ActionIndex = 0; ActionIndex < Snapshot.ActionStateCount; ++ActionIndex)
+	{
+		FSteamVRActionStateSnapshot& ActionState = Snapshot.ActionStates[ActionIndex];
+		ActionState.Name = ActionEvents[ActionIndex].Name;
+		ActionState.bState = ActionEvents[ActionIndex].bState;
+		ActionState.Value = ActionEvents[ActionIndex].Value;
+	}
+
+	// Mark the buffer as complete (even sequence) and make it the one new readers pick up
+	FPlatformAtomics::InterlockedIncrement(&SnapshotBuffer.Sequence);
+	FPlatformAtomics::InterlockedExchange(&PublishedSnapshotIndex, WriteIndex);
+}
+
+
+template<typename ReaderType>
+bool FSteamVRInputDevice::ReadInputSnapshot(ReaderType Reader) const
+{
+	// The game thread only recycles a buffer two publishes after it was current, so retries are rare and bounded
+	for (int32 Attempt = 0; Attempt < INPUT_SNAPSHOT_BUFFER_COUNT * 2; ++Attempt)
+	{
+		const int32 ReadIndex = FPlatformAtomics::AtomicRead(&PublishedSnapshotIndex);
+		if (ReadIndex == INDEX_NONE)
+		{
+			return false;
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Foot_Right")))
+
+		const FSteamVRInputSnapshotBuffer& SnapshotBuffer = InputSnapshots[ReadIndex];
+		const int32 SequenceBefore = FPlatformAtomics::AtomicRead(&SnapshotBuffer.Sequence);
+		if (SequenceBefore & 1)
 		{
-			if (VRTrackerFootR == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+			continue;
+		}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerFootR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerFootR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+		const bool bResult = Reader(SnapshotBuffer.Snapshot);
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Shoulder_Left")))
+		FPlatformMisc::MemoryBarrier();
+		if (FPlatformAtomics::AtomicRead(&SnapshotBuffer.Sequence) == SequenceBefore)
 		{
-			if (VRTrackerShoulderL == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+			return bResult;
+		}
+	}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerShoulderL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerShoulderL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+	return false;
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
+bool FSteamVRInputDevice::QuerySkeletalSummaryData(bool bLeftHand, EVRSummaryType SummaryType, VRSkeletalSummaryData_t& OutSummaryData) const
+{
+	const VRActionHandle_t SkeletalHandle = bLeftHand ? VRSkeletalHandleLeft : VRSkeletalHandleRight;
+	if (SkeletalHandle == k_ulInvalidActionHandle || !FSteamVRInputRuntime::VRInput())
+	{
+		return false;
+	}
+
+	FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+	return FSteamVRInputRuntime::VRInput()->GetSkeletalSummaryData(SkeletalHandle, SummaryType, &OutSummaryData) == VRInputError_None;
+}
+
+bool FSteamVRInputDevice::GetSkeletalSummaryData(bool bLeftHand, EVRSummaryType SummaryType, VRSkeletalSummaryData_t& OutSummaryData) const
+{
+	const bool bIsSkeletalControllerPresent = bLeftHand ? bIsSkeletalControllerLeftPresent : bIsSkeletalControllerRightPresent;
+	const VRActionHandle_t SkeletalHandle = bLeftHand ? VRSkeletalHandleLeft : VRSkeletalHandleRight;
+	if (!bIsSkeletalControllerPresent || SkeletalHandle == k_ulInvalidActionHandle || !FSteamVRInputRuntime::VRInput())
+	{
+		return false;
+	}
+
+	// The action state is updated once a frame for every active action set, see SendControllerEvents
+	FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+	InputSkeletalActionData_t SkeletalActionData;
+	if (FSteamVRInputRuntime::VRInput()->GetSkeletalActionData(SkeletalHandle, &SkeletalActionData, sizeof(InputSkeletalActionData_t)) != VRInputError_None || !SkeletalActionData.bActive)
+	{
+		return false;
+	}
+
+	return FSteamVRInputRuntime::VRInput()->GetSkeletalSummaryData(SkeletalHandle, SummaryType, &OutSummaryData) == VRInputError_None;
+}
+
+bool FSteamVRInputDevice::GetSkeletalDataSnapshot(bool bLeftHand, bool bMirror, EVRSkeletalMotionRange MotionRange, FTransform* OutBoneTransform, int32 OutBoneTransformCount)
+{
+	// Check that the size of the buffer we will be writing into is big enough to hold all the bone transforms
+	if (OutBoneTransformCount < STEAMVR_SKELETON_BONE_COUNT)
+	{
+		return false;
+	}
+
+	const int32 HandIndex = bLeftHand ? 0 : 1;
+	const int32 RangeIndex = (MotionRange == VRSkeletalMotionRange_WithController) ? 0 : 1;
+	const int32 MirrorIndex = bMirror ? 1 : 0;
+	const int32 Request = GetSnapshotBoneRequest(HandIndex, RangeIndex, MirrorIndex);
+
+	// Keep asking for as long as this is read, the next snapshot then carries it
+	RequestSnapshotData(Request);
+
+	bool bWasPublished = false;
+	const bool bHasBoneTransforms = ReadInputSnapshot([&](const FSteamVRInputSnapshot& Snapshot)
+	{
+		bWasPublished = (Snapshot.Requests & Request) != 0;
+		if (!bWasPublished || !Snapshot.bHasBoneTransforms[HandIndex][RangeIndex][MirrorIndex])
+		{
+			return false;
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Shoulder_Right")))
+
+		for (int32 BoneIndex = 0; BoneIndex < STEAMVR_SKELETON_BONE_COUNT; ++BoneIndex)
 		{
-			if (VRTrackerShoulderR == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+			OutBoneTransform[BoneIndex] = Snapshot.BoneTransforms[HandIndex][RangeIndex][MirrorIndex][BoneIndex];
+		}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerShoulderR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerShoulderR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+		return true;
+	});
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_RawPose_Left")))
+	if (bWasPublished)
+	{
+		return bHasBoneTransforms;
+	}
+
+	// Nobody read these bones before the last snapshot was published, read them directly this once
+	return GetCachedSkeletalData(bLeftHand, bMirror, MotionRange, OutBoneTransform);
+}
+
+bool FSteamVRInputDevice::GetSkeletalSummarySnapshot(bool bLeftHand, EVRSummaryType SummaryType, VRSkeletalSummaryData_t& OutSummaryData) const
+{
+	const int32 HandIndex = bLeftHand ? 0 : 1;
+	const int32 SummaryTypeIndex = (SummaryType == VRSummaryType_FromAnimation) ? 0 : 1;
+	const int32 Request = GetSnapshotSummaryRequest(HandIndex, SummaryTypeIndex);
+
+	// Keep asking for as long as this is read, the next snapshot then carries it
+	RequestSnapshotData(Request);
+
+	bool bWasPublished = false;
+	const bool bHasSummaryData = ReadInputSnapshot([&](const FSteamVRInputSnapshot& Snapshot)
+	{
+		bWasPublished = (Snapshot.Requests & Request) != 0;
+		if (!bWasPublished || !Snapshot.bHasSkeletalSummaryData[HandIndex][SummaryTypeIndex])
 		{
-			if (VRTrackerHandedPoseL == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+			return false;
+		}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedPoseL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedPoseL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+		OutSummaryData = Snapshot.SkeletalSummaryData[HandIndex][SummaryTypeIndex];
+		return true;
+	});
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
+	if (bWasPublished)
+	{
+		return bHasSummaryData;
+	}
+
+	return QuerySkeletalSummaryData(bLeftHand, SummaryType, OutSummaryData);
+}
+
+bool FSteamVRInputDevice::GetControllerPoseSnapshot(bool bLeftHand, InputPoseActionData_t& OutPoseData) const
+{
+	const int32 HandIndex = bLeftHand ? 0 : 1;
+	const int32 Request = GetSnapshotPoseRequest(HandIndex);
+
+	// Keep asking for as long as this is read, the next snapshot then carries it
+	RequestSnapshotData(Request);
+
+	bool bWasPublished = false;
+	const bool bHasControllerPose = ReadInputSnapshot([&](const FSteamVRInputSnapshot& Snapshot)
+	{
+		bWasPublished = (Snapshot.Requests & Request) != 0;
+		if (!bWasPublished || !Snapshot.bHasControllerPose[HandIndex])
+		{
+			return false;
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_RawPose_Right")))
+
+		OutPoseData = Snapshot.ControllerPoses[HandIndex];
+		return true;
+	});
+
+	if (bWasPublished)
+	{
+		return bHasControllerPose;
+	}
+
+	const VRActionHandle_t ControllerHandle = bLeftHand ? VRControllerHandleLeft : VRControllerHandleRight;
+	return ControllerHandle != k_ulInvalidActionHandle && FSteamVRInputRuntime::VRInput() && QueryPoseActionData(ControllerHandle, OutPoseData) == VRInputError_None;
+}
+
+bool FSteamVRInputDevice::GetActionStateSnapshot(FName ActionName, bool& bOutState, FVector& OutValue) const
+{
+	return ReadInputSnapshot([&](const FSteamVRInputSnapshot& Snapshot)
+	{
+		// The count may be torn if the buffer is being rewritten, the sequence check then discards the result
+		const int32 ActionStateCount = FMath::Clamp(Snapshot.ActionStateCount, 0, INPUT_SNAPSHOT_MAX_ACTIONS);
+		for (int32 ActionIndex = 0; ActionIndex < ActionStateCount; ++ActionIndex)
 		{
-			if (VRTrackerHandedPoseR == k_ulInvalidActionHandle)
+			const FSteamVRActionStateSnapshot& ActionState = Snapshot.ActionStates[ActionIndex];
+			if (ActionState.Name == ActionName)
 			{
-				return false;
+				bOutState = ActionState.bState;
+				OutValue = ActionState.Value;
+				return true;
 			}
+		}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedPoseR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedPoseR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+		return false;
+	});
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
+void FSteamVRInputDevice::SendAnalogMessage(const ETrackedControllerRole TrackedControllerRole, const FGamepadKeyNames::Type AxisButton, bool bIsSplay, int32 FingerIndex, float AnalogValue)
+{
+	const bool bIsLeftHand = TrackedControllerRole == ETrackedControllerRole::TrackedControllerRole_LeftHand;
+	const bool bIsRightHand = TrackedControllerRole == ETrackedControllerRole::TrackedControllerRole_RightHand;
+	if ((bIsLeftHand && bCurlsAndSplaysEnabled_L) || (bIsRightHand && bCurlsAndSplaysEnabled_R))
+	{
+		// Skip values that haven't moved since the last one sent for this hand and axis
+		const int32 HandIndex = bIsLeftHand ? 0 : 1;
+		float& LastSentValue = bIsSplay ? LastSplayValues[HandIndex][FMath::Clamp(FingerIndex, 0, VRFingerSplay_Count - 1)] : LastCurlValues[HandIndex][FMath::Clamp(FingerIndex, 0, VRFinger_Count - 1)];
+		if (!ShouldSendAnalogValue(AnalogValue, LastSentValue, ANALOG_DISPATCH_DEADBAND))
+		{
+			DispatchStats.CurlSplayEventsSuppressed++;
+			return;
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_Back_Left")))
+
+		LastSentValue = AnalogValue;
+		MessageHandler->OnControllerAnalog(AxisButton, 0, AnalogValue);
+		DispatchStats.CurlSplayEventsSent++;
+		//UE_LOG(LogSteamVRInputDevice, Warning, TEXT("Left Index value: %f for axis %s"), ControllerState.IndexGripAnalog, *AxisButton.ToString());
+	}
+}
+
+void FSteamVRInputDevice::SendControllerEvents()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SteamVRInput_SendControllerEvents);
+	CSV_SCOPED_TIMING_STAT(SteamVRInput, SendControllerEvents);
+
+	if (IsSteamVRActive() && FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput() && SteamVRInputActionSets.Num() > 0)
+	{
+		// Only update and process actions if at least one action set is active
+		if (ActiveActionSetCount > 0)
 		{
-			if (VRTrackerHandedBackL == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+			FScopeLock ActionStateScopeLock(&ActionStateLock);
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
+			EVRInputError ActionStateError;
 			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedBackL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
+				FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+				ActionStateError = FSteamVRInputRuntime::VRInput()->UpdateActionState(ActiveActionSets, sizeof(VRActiveActionSet_t), ActiveActionSetCount);
 			}
-			else
+
+			if (ActionStateError != VRInputError_None)
 			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedBackL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
+				//GetInputError(ActionStateError, TEXT("Error encountered when trying to update the action state"));
+				return;
 			}
 
-			if (InputError != VRInputError_None)
+			// Go through all Actions in all active ActionSets, each action belongs to exactly one action set
+			for (const FSteamVRInputActionSet& SteamVRInputActionSet : SteamVRInputActionSets)
 			{
-				return false;
+				if (SteamVRInputActionSet.bIsActive)
+				{
+					ProcessActionEvents(SteamVRInputActionSet);
+				}
 			}
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_Back_Right")))
-		{
-			if (VRTrackerHandedBackR == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedBackR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedBackR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+		// Send the digital transitions the polling thread saw since the last frame
+		DrainPolledDigitalEvents();
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
+		// Publish this frame's input for readers on other threads (e.g. anim worker threads)
+		PublishInputSnapshot();
+	}
+}
+
+void FSteamVRInputDevice::SetMessageHandler(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler)
+{
+	MessageHandler = InMessageHandler;
+}
+
+static FString DescribePosePrediction(float PredictedSecondsFromNow)
+{
+	return (PredictedSecondsFromNow <= -9999.f) ? FString(TEXT("next frame")) : FString::Printf(TEXT("%.4f seconds from now"), PredictedSecondsFromNow);
+}
+
+static void DumpOpenVRCallCounts(FOutputDevice& Ar)
+{
+	if (!FSteamVRInputCallCounter::IsEnabled())
+	{
+		Ar.Logf(TEXT("OpenVR calls are not being counted, use steamvr.input.ipcstats on or set [SteamVRInput] bCountOpenVRCalls"));
+	}
+
+	for (int32 InterfaceIndex = 0; InterfaceIndex < VRInterface_Count; ++InterfaceIndex)
+	{
+		const ESteamVRInterface Interface = (ESteamVRInterface)InterfaceIndex;
+		const int32 MethodCount = FSteamVRInputCallCounter::GetMethodCount(Interface);
+
+		uint64 InterfaceTotal = 0;
+		for (int32 MethodIndex = 0; MethodIndex < MethodCount; ++MethodIndex)
+		{
+			InterfaceTotal += FSteamVRInputCallCounter::GetTotalCallCount(Interface, MethodIndex);
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_Front_Left")))
+
+		Ar.Logf(TEXT("%s: %d calls last frame, %llu in total"), FSteamVRInputCallCounter::GetInterfaceName(Interface), FSteamVRInputCallCounter::GetFrameCallCount(Interface), InterfaceTotal);
+
+		// Only methods that were called are listed
+		for (int32 MethodIndex = 0; MethodIndex < MethodCount; ++MethodIndex)
 		{
-			if (VRTrackerHandedFrontL == k_ulInvalidActionHandle)
+			const uint64 MethodTotal = FSteamVRInputCallCounter::GetTotalCallCount(Interface, MethodIndex);
+			if (MethodTotal > 0)
 			{
-				return false;
+				Ar.Logf(TEXT("    %-48s %6d last frame %12llu in total"), FSteamVRInputCallCounter::GetMethodName(Interface, MethodIndex), FSteamVRInputCallCounter::GetFrameCallCount(Interface, MethodIndex), MethodTotal);
 			}
+		}
+	}
+}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedFrontL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedFrontL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+bool FSteamVRInputDevice::Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar)
+{
+	if (FParse::Command(&Cmd, TEXT("steamvr.input.dump")))
+	{
+		DumpInputState(Ar);
+		return true;
+	}
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
+	if (FParse::Command(&Cmd, TEXT("steamvr.input.prediction")))
+	{
+		// steamvr.input.prediction [<Seconds>|next]
+		const FString Argument = FParse::Token(Cmd, false);
+		if (Argument == TEXT("next"))
+		{
+			GlobalPredictedSecondsFromNow = -9999.f;
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_Front_Right")))
+		else if (Argument.IsNumeric())
 		{
-			if (VRTrackerHandedFrontR == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+			GlobalPredictedSecondsFromNow = FCString::Atof(*Argument);
+		}
+		else if (!Argument.IsEmpty())
+		{
+			Ar.Logf(TEXT("Usage: steamvr.input.prediction [<Seconds>|next]"));
+			return true;
+		}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedFrontR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedFrontR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+		Ar.Logf(TEXT("Poses are predicted for the %s"), *DescribePosePrediction(GlobalPredictedSecondsFromNow));
+		return true;
+	}
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
+	if (FParse::Command(&Cmd, TEXT("steamvr.input.poll")))
+	{
+		// steamvr.input.poll [<Hz>], 0 reads digital actions once per frame
+		const FString Argument = FParse::Token(Cmd, false);
+		if (Argument.IsNumeric())
+		{
+			SetInputPollingRate(FCString::Atof(*Argument));
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_FrontRolled_Left")))
+		else if (!Argument.IsEmpty())
 		{
-			if (VRTrackerHandedFrontRL == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
-
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedFrontRL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedFrontRL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+			Ar.Logf(TEXT("Usage: steamvr.input.poll [<Hz>]"));
+			return true;
+		}
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
+		const float PollingRate = GetInputPollingRate();
+		if (PollingRate > 0.f)
+		{
+			Ar.Logf(TEXT("Digital actions are polled at %.1f Hz"), PollingRate);
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_FrontRolled_Right")))
+		else
 		{
-			if (VRTrackerHandedFrontRR == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+			Ar.Logf(TEXT("Digital actions are read once per frame"));
+		}
+		return true;
+	}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedFrontRR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
+	if (FParse::Command(&Cmd, TEXT("steamvr.input.sets")))
+	{
+		// steamvr.input.sets [push <ActionSet> [<DevicePath>]|pop [<ActionSet>]]
+		if (FParse::Command(&Cmd, TEXT("push")))
+		{
+			const FString ActionSetName = FParse::Token(Cmd, false);
+			const FString DevicePath = FParse::Token(Cmd, false);
+			if (ActionSetName.IsEmpty())
 			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedFrontRR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
+				Ar.Logf(TEXT("Usage: steamvr.input.sets push <ActionSet> [<DevicePath>]"));
+				return true;
 			}
 
-			if (InputError != VRInputError_None)
+			if (!PushActionSet(FName(*ActionSetName), DevicePath))
 			{
-				return false;
+				Ar.Logf(TEXT("Unable to push action set %s"), *ActionSetName);
 			}
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_PistolGrip_Left")))
+		else if (FParse::Command(&Cmd, TEXT("pop")))
 		{
-			if (VRTrackerHandedGripL == k_ulInvalidActionHandle)
+			const FString ActionSetName = FParse::Token(Cmd, false);
+			if (!PopActionSet(ActionSetName.IsEmpty() ? NAME_None : FName(*ActionSetName)))
 			{
-				return false;
+				Ar.Logf(TEXT("Unable to pop action set %s"), ActionSetName.IsEmpty() ? TEXT("from the top of the stack") : *ActionSetName);
 			}
+		}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedGripL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedGripL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+		DumpActionSets(Ar);
+		return true;
+	}
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
+	if (FParse::Command(&Cmd, TEXT("steamvr.input.ipcstats")))
+	{
+		// steamvr.input.ipcstats [print|reset|on|off]
+		if (FParse::Command(&Cmd, TEXT("reset")))
+		{
+			FSteamVRInputCallCounter::Reset();
+			Ar.Logf(TEXT("OpenVR call counts reset"));
+			return true;
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_PistolGrip_Right")))
+
+		// The counting interfaces are only switched once the worker registering the startup action manifest is done with them
+		if (FParse::Command(&Cmd, TEXT("on")))
 		{
-			if (VRTrackerHandedGripR == k_ulInvalidActionHandle)
-			{
-				return false;
-			}
+			FinishAsyncInitialization(true);
+			FSteamVRInputCallCounter::SetEnabled(true);
+		}
+		else if (FParse::Command(&Cmd, TEXT("off")))
+		{
+			FinishAsyncInitialization(true);
+			FSteamVRInputCallCounter::SetEnabled(false);
+		}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedGripR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedGripR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+		DumpOpenVRCallCounts(Ar);
+		return true;
+	}
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Keyboard")))
+	if (FParse::Command(&Cmd, TEXT("steamvr.input.benchmark")))
+	{
+		// steamvr.input.benchmark [Frames=<Count>]
+		int32 FrameCount = BENCHMARK_FRAME_COUNT;
+		FParse::Value(Cmd, TEXT("Frames="), FrameCount);
+
+		FSteamVRInputBenchmark Benchmark(*this);
+		Benchmark.Run(Ar, FrameCount);
+		return true;
+	}
+
+	return false;
+}
+
+void FSteamVRInputDevice::DumpInputState(FOutputDevice& Ar)
+{
+	const TCHAR* RuntimeName = TEXT("unavailable");
+	if (MockRuntime.IsValid())
+	{
+		RuntimeName = TEXT("mock runtime");
+	}
+	else if (IsReplayingInput())
+	{
+		RuntimeName = TEXT("input replay");
+	}
+	else if (ConnectionState == SteamVRConnection_Dormant)
+	{
+		RuntimeName = TEXT("dormant (-nohmd)");
+	}
+	else if (ConnectionState == SteamVRConnection_Connected)
+	{
+		RuntimeName = TEXT("SteamVR");
+	}
+	else if (!IsInitializingInput())
+	{
+		Ar.Logf(TEXT("SteamVR is probed again in %.1fs"), FMath::Max(NextReconnectTime - FPlatformTime::Seconds(), 0.0));
+	}
+	Ar.Logf(TEXT("Runtime: %s%s%s"), RuntimeName, IsRecordingInput() ? TEXT(", recording input") : TEXT(""), IsInitializingInput() ? TEXT(", action manifest still registering") : TEXT(""));
+
+	Ar.Logf(TEXT("Main action set: %llu"), (uint64)MainActionSet);
+	Ar.Logf(TEXT("Controller poses: left %llu, right %llu"), (uint64)VRControllerHandleLeft, (uint64)VRControllerHandleRight);
+	Ar.Logf(TEXT("Skeletal actions: left %llu (%s), right %llu (%s), %s"), (uint64)VRSkeletalHandleLeft, bIsSkeletalControllerLeftPresent ? TEXT("present") : TEXT("absent"),
+		(uint64)VRSkeletalHandleRight, bIsSkeletalControllerRightPresent ? TEXT("present") : TEXT("absent"), bUseSkeletonPose ? TEXT("driving controller poses") : TEXT("not driving controller poses"));
+	Ar.Logf(TEXT("Vibration actions: left %llu, right %llu"), (uint64)VRVibrationLeft, (uint64)VRVibrationRight);
+
+	// Controllers and trackers, by motion source name
+	Ar.Logf(TEXT("Motion sources (%d):"), MotionSourceHandles.Num());
+	for (const TPair<FName, FSteamVRMotionSourceHandles>& MotionSource : MotionSourceHandles)
+	{
+		Ar.Logf(TEXT("    %-24s pose %llu, skeletal %llu"), *MotionSource.Key.ToString(), (uint64)MotionSource.Value.PoseHandle, (uint64)MotionSource.Value.SkeletalHandle);
+	}
+
+	{
+		FScopeLock ActionStateScopeLock(&ActionStateLock);
+
+		Ar.Logf(TEXT("Actions (%d):"), ActionEvents.Num());
+		for (FSteamVRInputAction& Action : ActionEvents)
 		{
-			if (VRTrackerKeyboard == k_ulInvalidActionHandle)
+			FString State;
+			switch (Action.Type)
 			{
-				return false;
+			case EActionType::Boolean:
+				State = Action.bState ? TEXT("pressed") : TEXT("released");
+				break;
+			case EActionType::Vector1:
+			case EActionType::Vector2:
+			case EActionType::Vector3:
+				State = Action.Value.ToString();
+				break;
+			default:
+				break;
 			}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerKeyboard, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerKeyboard, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+			Ar.Logf(TEXT("    %-48s %-9s handle %llu %s%s"), *Action.Path, *Action.GetActionTypeName(), (uint64)Action.Handle, *State,
+				(Action.LastError != VRInputError_None) ? *FString::Printf(TEXT(" (error %d)"), (int32)Action.LastError) : TEXT(""));
+		}
+	}
 
-			if (InputError != VRInputError_None)
-			{
-				return false;
-			}
+	Ar.Logf(TEXT("Poses are predicted for the %s, tracking space %d"), *DescribePosePrediction(GlobalPredictedSecondsFromNow), (int32)CachedTrackingSpace);
+	Ar.Logf(TEXT("Digital action polling rate: %.1f Hz"), GetInputPollingRate());
+	Ar.Logf(TEXT("Analog events: %llu sent, %llu suppressed. Curl and splay events: %llu sent, %llu suppressed"),
+		DispatchStats.AnalogEventsSent, DispatchStats.AnalogEventsSuppressed, DispatchStats.CurlSplayEventsSent, DispatchStats.CurlSplayEventsSuppressed);
+}
+
+void FSteamVRInputDevice::DumpActionSets(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Action sets (%d defined, %u active):"), SteamVRInputActionSets.Num(), ActiveActionSetCount);
+	for (const FSteamVRInputActionSet& ActionSet : SteamVRInputActionSets)
+	{
+		Ar.Logf(TEXT("  %s %-24s priority %d, handle %llu, %d actions%s"), ActionSet.bIsActive ? TEXT("*") : TEXT(" "), *ActionSet.Name.ToString(), ActionSet.Priority,
+			(uint64)ActionSet.Handle, ActionSet.DispatchIndices.Num(),
+			ActionSet.RestrictedToDevicePath.IsEmpty() ? TEXT("") : *FString::Printf(TEXT(", restricted to %s"), *ActionSet.RestrictedToDevicePath));
+	}
+
+	FString Stack;
+	for (const FName& ActionSetName : ActionSetStack)
+	{
+		Stack += Stack.IsEmpty() ? ActionSetName.ToString() : FString(TEXT(", ")) + ActionSetName.ToString();
+	}
+	Ar.Logf(TEXT("Action set stack, bottom to top: %s"), Stack.IsEmpty() ? TEXT("(empty)") : *Stack);
+}
+
+EVRInputError FSteamVRInputDevice::QueryPoseActionData(VRActionHandle_t ActionHandle, InputPoseActionData_t& OutPoseData) const
+{
+	EVRInputError InputError;
+	{
+		FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+		InputError = (GlobalPredictedSecondsFromNow <= -9999.f)
+			? FSteamVRInputRuntime::VRInput()->GetPoseActionDataForNextFrame(ActionHandle, CachedTrackingSpace, &OutPoseData, sizeof(OutPoseData), k_ulInvalidInputValueHandle)
+			: FSteamVRInputRuntime::VRInput()->GetPoseActionDataRelativeToNow(ActionHandle, CachedTrackingSpace, GlobalPredictedSecondsFromNow, &OutPoseData, sizeof(OutPoseData), k_ulInvalidInputValueHandle);
+	}
+
+	if (InputError == VRInputError_None && FSteamVRInputTrace::IsEnabled())
+	{
+		FSteamVRInputTrace::TracePose(ActionHandle, OutPoseData, GlobalPredictedSecondsFromNow);
+	}
+	return InputError;
+}
+
+EVRInputError FSteamVRInputDevice::GetPoseActionData(VRActionHandle_t ActionHandle, InputPoseActionData_t& OutPoseData) const
+{
+	// Late updates on the render thread need a fresh pose, so only game thread reads are cached
+	if (!IsInGameThread())
+	{
+		return QueryPoseActionData(ActionHandle, OutPoseData);
+	}
+
+	FSteamVRCachedPose& CachedPose = PoseCache.FindOrAdd(ActionHandle);
+	if (CachedPose.FrameNumber != GFrameCounter || CachedPose.PredictedSecondsFromNow != GlobalPredictedSecondsFromNow)
+	{
+		CachedPose.InputError = QueryPoseActionData(ActionHandle, CachedPose.PoseData);
+		CachedPose.FrameNumber = GFrameCounter;
+		CachedPose.PredictedSecondsFromNow = GlobalPredictedSecondsFromNow;
+	}
+
+	OutPoseData = CachedPose.PoseData;
+	return CachedPose.InputError;
+}
+
+bool FSteamVRInputDevice::GetControllerOrientationAndPosition(const int32 ControllerIndex, const FName MotionSource, FRotator& OutOrientation, FVector& OutPosition, float WorldToMetersScale) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SteamVRInput_PoseQuery);
+	CSV_SCOPED_TIMING_STAT(SteamVRInput, PoseQuery);
+
+	if (IsSteamVRActive() && FSteamVRInputRuntime::VRInput() && FSteamVRInputRuntime::VRCompositor())
+	{
+		//UE_LOG(LogSteamVRInputDevice, Warning, TEXT("MOTION SOURCE: %s"), *MotionSource.ToString());
+		const FSteamVRMotionSourceHandles* SourceHandles = MotionSourceHandles.Find(MotionSource);
+		if (SourceHandles == nullptr)
+		{
+			return false;
 		}
-		else
+
+		// Hands can optionally be driven by the skeletal pose instead of the controller pose
+		VRActionHandle_t ActionHandle = (bUseSkeletonPose && SourceHandles->SkeletalHandle != k_ulInvalidActionHandle) ? SourceHandles->SkeletalHandle : SourceHandles->PoseHandle;
+		if (ActionHandle == k_ulInvalidActionHandle)
 		{
 			return false;
 		}
 
-		if (InputError == VRInputError_None)
+		InputPoseActionData_t PoseData = {};
+		EVRInputError InputError = GetPoseActionData(ActionHandle, PoseData);
+
+		if (InputError != VRInputError_None)
 		{
-			// Get SteamVR Transform Matrix for this controller
-			HmdMatrix34_t Matrix = PoseData.pose.mDeviceToAbsoluteTracking;
+			return false;
+		}
 
-			// Transform SteamVR Pose to Unreal Pose
-			FMatrix Pose = FMatrix(
-				FPlane(Matrix.m[0][0], Matrix.m[1][0], Matrix.m[2][0], 0.0f),
-				FPlane(Matrix.m[0][1], Matrix.m[1][1], Matrix.m[2][1], 0.0f),
-				FPlane(Matrix.m[0][2], Matrix.m[1][2], Matrix.m[2][2], 0.0f),
-				FPlane(Matrix.m[0][3], Matrix.m[1][3], Matrix.m[2][3], 1.0f)
-			);
+		// Get SteamVR Transform Matrix for this controller
+		HmdMatrix34_t Matrix = PoseData.pose.mDeviceToAbsoluteTracking;
 
+		// Transform SteamVR Pose to Unreal Pose
+		FMatrix Pose = FMatrix(
+			FPlane(Matrix.m[0][0], Matrix.m[1][0], Matrix.m[2][0], 0.0f),
+			FPlane(Matrix.m[0][1], Matrix.m[1][1], Matrix.m[2][1], 0.0f),
+			FPlane(Matrix.m[0][2], Matrix.m[1][2], Matrix.m[2][2], 0.0f),
+			FPlane(Matrix.m[0][3], Matrix.m[1][3], Matrix.m[2][3], 1.0f)
+		);
 
-			// Transform SteamVR Rotation Quaternion to a UE FRotator
-			FQuat OrientationQuat;
-			FQuat Orientation(Pose);
-			OrientationQuat.X = -Orientation.Z;
-			OrientationQuat.Y = Orientation.X;
-			OrientationQuat.Z = Orientation.Y;
-			OrientationQuat.W = -Orientation.W;
 
-			// Return controller transform
-			FVector Position = ((FVector(-Pose.M[3][2], Pose.M[3][0], Pose.M[3][1])) * WorldToMetersScale - CachedBasePosition);
-			OutPosition = CachedBaseOrientation.Inverse().RotateVector(Position);
+		// Transform SteamVR Rotation Quaternion to a UE FRotator
+		FQuat OrientationQuat;
+		FQuat Orientation(Pose);
+		OrientationQuat.X = -Orientation.Z;
+		OrientationQuat.Y = Orientation.X;
+		OrientationQuat.Z = Orientation.Y;
+		OrientationQuat.W = -Orientation.W;
 
-			OrientationQuat = CachedBaseOrientation.Inverse() * OrientationQuat;
-			OrientationQuat.Normalize();
-			OutOrientation = OrientationQuat.Rotator();
+		// Return controller transform
+		FVector Position = ((FVector(-Pose.M[3][2], Pose.M[3][0], Pose.M[3][1])) * WorldToMetersScale - CachedBasePosition);
+		OutPosition = CachedBaseOrientation.Inverse().RotateVector(Position);
 
-		}
+		OrientationQuat = CachedBaseOrientation.Inverse() * OrientationQuat;
+		OrientationQuat.Normalize();
+		OutOrientation = OrientationQuat.Rotator();
 	}
 
 	return true;
@@ -872,631 +1509,656 @@ ETrackingStatus FSteamVRInputDevice::GetControllerTrackingStatus(const int32 Con
 	ETrackingStatus TrackingStatus = ETrackingStatus::NotTracked;
 	//UE_LOG(LogSteamVRInputDevice, Warning, TEXT("STATUS MOTION SOURCE: %s"), *MotionSource.ToString());
 
-	if (VRInput() && VRCompositor())
+	if (IsSteamVRActive() && FSteamVRInputRuntime::VRInput() && FSteamVRInputRuntime::VRCompositor())
 	{
-		//FName MotionSource = GetMotionSourceName(DeviceHand);
-		InputPoseActionData_t PoseData = {};
-		EVRInputError InputError = VRInputError_NoData;
-
-		if (MotionSource.IsEqual(TEXT("Left")))
+		// Tracking status always comes from the controller/tracker pose, regardless of the pose source
+		const FSteamVRMotionSourceHandles* SourceHandles = MotionSourceHandles.Find(MotionSource);
+		if (SourceHandles == nullptr || SourceHandles->PoseHandle == k_ulInvalidActionHandle)
 		{
-			if (VRControllerHandleLeft == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRControllerHandleLeft, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRControllerHandleLeft, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+			return ETrackingStatus::NotTracked;
 		}
-		else if (MotionSource.IsEqual(TEXT("Right")))
-		{
-			if (VRControllerHandleRight == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRControllerHandleRight, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRControllerHandleRight, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+		InputPoseActionData_t PoseData = {};
+		EVRInputError InputError = GetPoseActionData(SourceHandles->PoseHandle, PoseData);
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Camera")))
+		if (InputError == VRInputError_None && PoseData.pose.bDeviceIsConnected)
 		{
-			if (VRTRackerCamera == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+			TrackingStatus = ETrackingStatus::Tracked;
+		}
+	}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTRackerCamera, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTRackerCamera, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+	return TrackingStatus;
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Chest")))
-		{
-			if (VRTrackerChest == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+ETrackingStatus FSteamVRInputDevice::GetControllerTrackingStatus(const int32 ControllerIndex, const EControllerHand DeviceHand) const
+{
+	return GetControllerTrackingStatus(ControllerIndex, GetMotionSourceName(DeviceHand));
+}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerChest, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerChest, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+FName FSteamVRInputDevice::GetMotionControllerDeviceTypeName() const
+{
+	return FName(TEXT("SteamVRInputDevice"));
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Waist")))
-		{
-			if (VRTrackerWaist == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerWaist, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerWaist, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+bool FSteamVRInputDevice::GetHandJointPosition(const FName MotionSource, int jointIndex, FVector& OutPosition) const
+{
+	return false;
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Foot_Left")))
-		{
-			if (VRTrackerFootL == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerFootL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerFootL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+FName FSteamVRInputDevice::GetMotionSourceName(const EControllerHand MotionSource) const
+{
+	switch ((uint32)MotionSource)
+	{
+	case 0:
+		return FName(TEXT("Left"));
+		break;
+	case 1:
+		return FName(TEXT("Right"));
+		break;
+	case 2:
+		return FName(TEXT("AnyHand"));
+		break;
+	case 3:
+		return FName(TEXT("Pad"));
+		break;
+	case 4:
+		return FName(TEXT("ExternalCamera"));
+		break;
+	case 5:
+		return FName(TEXT("Gun"));
+		break;
+	case 6:
+		return FName(TEXT("Special_1"));
+		break;
+	case 7:
+		return FName(TEXT("Special_2"));
+		break;
+	case 8:
+		return FName(TEXT("Special_3"));
+		break;
+	case 9:
+		return FName(TEXT("Special_4"));
+		break;
+	case 10:
+		return FName(TEXT("Special_5"));
+		break;
+	case 11:
+		return FName(TEXT("Special_6"));
+		break;
+	case 12:
+		return FName(TEXT("Special_7"));
+		break;
+	case 13:
+		return FName(TEXT("Special_8"));
+		break;
+	case 14:
+		return FName(TEXT("Special_9"));
+		break;
+	case 15:
+		return FName(TEXT("Special_10"));
+		break;
+	case 16:
+		return FName(TEXT("Special_11"));
+		break;
+	case 17:
+		return FName(TEXT("Tracker_Camera"));
+		break;
+	case 18:
+		return FName(TEXT("Tracker_Chest"));
+		break;
+	case 19:
+		return FName(TEXT("Tracker_Handheld_Back_Left"));
+		break;
+	case 20:
+		return FName(TEXT("Tracker_Handheld_Back_Right"));
+		break;
+	case 21:
+		return FName(TEXT("Tracker_Handheld_Front_Left"));
+		break;
+	case 22:
+		return FName(TEXT("Tracker_Handheld_Front_Right"));
+		break;
+	case 23:
+		return FName(TEXT("Tracker_Handheld_FrontRolled_Left"));
+		break;
+	case 24:
+		return FName(TEXT("Tracker_Handheld_FrontRolled_Right"));
+		break;
+	case 25:
+		return FName(TEXT("Tracker_Handheld_PistolGrip_Left"));
+		break;
+	case 26:
+		return FName(TEXT("Tracker_Handheld_PistolGrip_Right"));
+		break;
+	case 27:
+		return FName(TEXT("Tracker_Handheld_RawPose_Left"));
+		break;
+	case 28:
+		return FName(TEXT("Tracker_Handheld_RawPose_Right"));
+		break;
+	case 29:
+		return FName(TEXT("Tracker_Foot_Left"));
+		break;
+	case 30:
+		return FName(TEXT("Tracker_Foot_Right"));
+		break;
+	case 31:
+		return FName(TEXT("Tracker_Shoulder_Left"));
+		break;
+	case 32:
+		return FName(TEXT("Tracker_Shoulder_Right"));
+		break;
+	case 33:
+		return FName(TEXT("Tracker_Keyboard"));
+		break;
+	case 34:
+		return FName(TEXT("Tracker_Waist"));
+		break;
+	default:
+		return NAME_None;
+		break;
+	}
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Foot_Right")))
-		{
-			if (VRTrackerFootR == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+void FSteamVRInputDevice::EnumerateSources(TArray<FMotionControllerSource>& SourcesOut) const
+{
+	SourcesOut.Add(FMotionControllerSource(TEXT("Left")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Right")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("AnyHand")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Pad")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("ExternalCamera")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Gun")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Camera")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Chest")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Foot_Left")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Foot_Right")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Shoulder_Left")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Shoulder_Right")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Keyboard")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Waist")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_RawPose_Left")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_RawPose_Right")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_Back_Left")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_Back_Right")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_Front_Left")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_Front_Right")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_FrontRolled_Left")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_FrontRolled_Right")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_PistolGrip_Left")));
+	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_PistolGrip_Right")));
+}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerFootR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerFootR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+void FSteamVRInputDevice::SetHapticFeedbackValues(int32 ControllerId, int32 Hand, const FHapticFeedbackValues& Values)
+{
+	// Collected for the frame and sent once at the end of Tick, AnyHand vibrates both hands
+	AddHapticFrameRequest((EControllerHand)Hand, Values.Amplitude, Values.Frequency);
+	//UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[HAPTIC] Hand: %i, Frequency: %f, Amplitude: %f"), Hand, Values.Frequency, Values.Amplitude);
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+void FSteamVRInputDevice::AddHapticFrameRequest(EControllerHand Hand, float Amplitude, float Frequency)
+{
+	const int32 HandMask = GetHapticHandMask(Hand);
+	Amplitude = FMath::Clamp(Amplitude, 0.f, 1.f);
+
+	for (int32 HandIndex = 0; HandIndex < 2; ++HandIndex)
+	{
+		if (!(HandMask & (1 << HandIndex)))
+		{
+			continue;
 		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Shoulder_Left")))
+
+		FSteamVRHapticFrameRequest& HapticFrameRequest = HapticFrameRequests[HandIndex];
+		if (!HapticFrameRequest.bIsSet || Amplitude > HapticFrameRequest.LoudestAmplitude)
 		{
-			if (VRTrackerShoulderL == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+			HapticFrameRequest.LoudestAmplitude = Amplitude;
+			HapticFrameRequest.Frequency = Frequency;
+		}
+		HapticFrameRequest.Amplitude = HapticScheduler.GetMixMode() == HapticMix_Sum ? FMath::Min(HapticFrameRequest.Amplitude + Amplitude, 1.f) : HapticFrameRequest.LoudestAmplitude;
+		HapticFrameRequest.bIsSet = true;
+	}
+}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerShoulderL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerShoulderL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+void FSteamVRInputDevice::SetHapticMixMode(EHapticMixMode MixMode)
+{
+	HapticScheduler.SetMixMode(MixMode);
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Shoulder_Right")))
-		{
-			if (VRTrackerShoulderR == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+void FSteamVRInputDevice::GetHapticFrequencyRange(float& MinFrequency, float& MaxFrequency) const
+{
+	MinFrequency = MaxFrequency = 0.f;
+}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerShoulderR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerShoulderR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+float FSteamVRInputDevice::GetHapticAmplitudeScale() const
+{
+	return 1.f;
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_RawPose_Left")))
-		{
-			if (VRTrackerHandedPoseL == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+int32 FSteamVRInputDevice::PlayHapticPattern(EControllerHand Hand, const TArray<FSteamVRHapticSegment>& Segments, float StartSecondsFromNow)
+{
+	if (Hand != EControllerHand::Left && Hand != EControllerHand::Right)
+	{
+		UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Haptic patterns can only be played on the left or right hand"));
+		return INDEX_NONE;
+	}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedPoseL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedPoseL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_RawPose_Right")))
-		{
-			if (VRTrackerHandedPoseR == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+	return HapticScheduler.Play(Hand == EControllerHand::Left ? 0 : 1, Segments, FPlatformTime::Seconds() + FMath::Max(StartSecondsFromNow, 0.f));
+}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedPoseR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedPoseR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_Back_Left")))
-		{
-			if (VRTrackerHandedBackL == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+bool FSteamVRInputDevice::StopHapticPattern(int32 PatternId)
+{
+	return HapticScheduler.Stop(PatternId);
+}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedBackL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedBackL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+bool FSteamVRInputDevice::PlayAudioHaptics(EControllerHand Hand, USoundWave* SoundWave, float Gain, float StartSecondsFromNow)
+{
+	return AudioHaptics.PlaySoundWave(GetHapticHandMask(Hand), SoundWave, Gain, FPlatformTime::Seconds() + FMath::Max(StartSecondsFromNow, 0.f));
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_Back_Right")))
-		{
-			if (VRTrackerHandedBackR == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+bool FSteamVRInputDevice::StartAudioHapticsStream(EControllerHand Hand, USoundSubmix* Submix, float Gain)
+{
+	return AudioHaptics.StartSubmixStream(GetHapticHandMask(Hand), Submix, Gain);
+}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedBackR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedBackR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+void FSteamVRInputDevice::StopAudioHapticsStream()
+{
+	AudioHaptics.StopSubmixStream();
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_Front_Left")))
-		{
-			if (VRTrackerHandedFrontL == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+bool FSteamVRInputDevice::StartInputRecording(const FString& FilePath)
+{
+	// Input is only switched once the worker registering the startup action manifest is done with it
+	FinishAsyncInitialization(true);
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedFrontL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedFrontL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+	if (InputRecorder.IsValid() || InputReplay.IsValid() || FSteamVRInputRuntime::VRInput() == nullptr)
+	{
+		UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Unable to record input to %s: SteamVR input is unavailable, or already being recorded or replayed"), *FilePath);
+		return false;
+	}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_Front_Right")))
-		{
-			if (VRTrackerHandedFrontR == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+	{
+		// Keep the polling thread out of SteamVR while the input is switched
+		FScopeLock ActionStateScopeLock(&ActionStateLock);
+		FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+		InputRecorder = MakeUnique<FSteamVRInputRecorder>(FSteamVRInputRuntime::GetInputOverride());
+		FSteamVRInputRuntime::SetInputOverride(InputRecorder.Get());
+	}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedFrontR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedFrontR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+	InputRecordingPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir(), FilePath);
+	UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Recording input to %s"), *InputRecordingPath);
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_FrontRolled_Left")))
-		{
-			if (VRTrackerHandedFrontRL == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+	// Resolve handles again so they are part of the recording
+	InitSteamVRSystem();
+	return true;
+}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedFrontRL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedFrontRL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+bool FSteamVRInputDevice::StopInputRecording()
+{
+	if (!InputRecorder.IsValid())
+	{
+		return false;
+	}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_FrontRolled_Right")))
-		{
-			if (VRTrackerHandedFrontRR == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+	{
+		FScopeLock ActionStateScopeLock(&ActionStateLock);
+		FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+		FSteamVRInputRuntime::SetInputOverride(InputRecorder->GetSourceInput());
+	}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedFrontRR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedFrontRR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+	// Let pose reads in flight on the render thread finish with the recorder
+	FlushRenderingCommands();
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_PistolGrip_Left")))
-		{
-			if (VRTrackerHandedGripL == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+	const int32 FrameCount = InputRecorder->GetFrameCount();
+	const bool bIsSaved = InputRecorder->SaveToFile(InputRecordingPath);
+	if (bIsSaved)
+	{
+		UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Recorded %d frames of input to %s"), FrameCount, *InputRecordingPath);
+	}
+	else
+	{
+		UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Unable to write input recording %s"), *InputRecordingPath);
+	}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedGripL, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedGripL, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+	InputRecorder.Reset();
+	return bIsSaved;
+}
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Handheld_PistolGrip_Right")))
-		{
-			if (VRTrackerHandedGripR == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+bool FSteamVRInputDevice::StartInputReplay(const FString& FilePath)
+{
+	const FString FullFilePath = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir(), FilePath);
+	if (InputRecorder.IsValid() || InputReplay.IsValid() || MockRuntime.IsValid())
+	{
+		UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Unable to replay input from %s: input is already being recorded, replayed or simulated"), *FullFilePath);
+		return false;
+	}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerHandedGripR, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerHandedGripR, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
+	// Input is only switched once the worker registering the startup action manifest is done with it
+	FinishAsyncInitialization(true);
 
-			if (InputError != VRInputError_None)
-			{
-				return ETrackingStatus::NotTracked;
-			}
-		}
-		else if (MotionSource.IsEqual(TEXT("Tracker_Keyboard")))
-		{
-			if (VRTrackerKeyboard == k_ulInvalidActionHandle)
-			{
-				return ETrackingStatus::NotTracked;
-			}
+	TUniquePtr<FSteamVRInputReplay> NewInputReplay = MakeUnique<FSteamVRInputReplay>();
+	if (!NewInputReplay->LoadFromFile(FullFilePath))
+	{
+		UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Unable to replay input from %s: not a valid input recording"), *FullFilePath);
+		return false;
+	}
+
+	{
+		// Keep the polling thread out of SteamVR while the input is switched
+		FScopeLock ActionStateScopeLock(&ActionStateLock);
+		FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+		InputReplay = MoveTemp(NewInputReplay);
+		FSteamVRInputRuntime::SetOverride(InputReplay->GetSystem(), InputReplay.Get(), InputReplay->GetCompositor());
+		bInputReplayEnded = false;
+	}
+
+	UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Replaying %d frames of input from %s"), InputReplay->GetFrameCount(), *FullFilePath);
+
+	// Resolve handles from the recording
+	InitSteamVRSystem();
+	return true;
+}
+
+void FSteamVRInputDevice::StopInputReplay()
+{
+	if (!InputReplay.IsValid())
+	{
+		return;
+	}
+
+	{
+		FScopeLock ActionStateScopeLock(&ActionStateLock);
+		FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+		FSteamVRInputRuntime::ClearOverride();
+	}
+
+	// Let pose reads in flight on the render thread finish with the replay
+	FlushRenderingCommands();
+	InputReplay.Reset();
+
+	// Resolve handles from SteamVR again, if it is running
+	InitSteamVRSystem();
+}
+
+bool FSteamVRInputDevice::StartMockRuntime(const FSteamVRMockRuntimeSettings& Settings)
+{
+	if (!InstallMockRuntime(Settings))
+	{
+		return false;
+	}
+
+	// Resolve handles from the mock runtime
+	InitSteamVRSystem();
+	return true;
+}
+
+bool FSteamVRInputDevice::InstallMockRuntime(const FSteamVRMockRuntimeSettings& Settings)
+{
+	if (MockRuntime.IsValid() || InputRecorder.IsValid() || InputReplay.IsValid())
+	{
+		UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Unable to start the mock runtime: input is already being recorded, replayed or simulated"));
+		return false;
+	}
+
+	// The runtime is only switched once the worker registering the startup action manifest is done with it
+	FinishAsyncInitialization(true);
+
+	{
+		// Keep the polling thread out of SteamVR while the runtime is switched
+		FScopeLock ActionStateScopeLock(&ActionStateLock);
+		FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+		MockRuntime = MakeUnique<FSteamVRMockRuntime>(Settings);
+		MockRuntime->Install();
+	}
+
+	UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Mock runtime started with %d tracked devices"), MockRuntime->GetDeviceCount());
+	return true;
+}
+
+void FSteamVRInputDevice::StopMockRuntime()
+{
+	if (!MockRuntime.IsValid())
+	{
+		return;
+	}
+
+	// A recording of the simulation reads from it until written
+	StopInputRecording();
+
+	{
+		FScopeLock ActionStateScopeLock(&ActionStateLock);
+		FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+		MockRuntime->Uninstall();
+	}
+
+	// Let pose reads in flight on the render thread finish with the mock runtime
+	FlushRenderingCommands();
+	MockRuntime.Reset();
+
+	// Resolve handles from SteamVR again, if it is running. An isolated device has nothing to go back to
+	if (!bIsIsolated)
+	{
+		InitSteamVRSystem();
+	}
+}
+
+void FSteamVRInputDevice::StopHapticPatterns(EControllerHand Hand)
+{
+	if (Hand == EControllerHand::Left || Hand == EControllerHand::AnyHand)
+	{
+		HapticScheduler.StopAll(0);
+	}
+	if (Hand == EControllerHand::Right || Hand == EControllerHand::AnyHand)
+	{
+		HapticScheduler.StopAll(1);
+	}
+}
 
-			if (GlobalPredictedSecondsFromNow <= -9999.f)
-			{
-				InputError = VRInput()->GetPoseActionDataForNextFrame(VRTrackerKeyboard, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
-			else
-			{
-				InputError = VRInput()->GetPoseActionDataRelativeToNow(VRTrackerKeyboard, VRCompositor()->GetTrackingSpace(), GlobalPredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
-			}
 
-			if (InputError != VRInputError_None)
+
+bool FSteamVRInputDevice::SetActionSetActive(FName ActionSetName, bool bActive)
+{
+	FScopeLock ActionStateScopeLock(&ActionStateLock);
+
+	for (FSteamVRInputActionSet& SteamVRInputActionSet : SteamVRInputActionSets)
+	{
+		if (SteamVRInputActionSet.Name == ActionSetName)
+		{
+			if (SteamVRInputActionSet.bIsActive != bActive)
 			{
-				return ETrackingStatus::NotTracked;
+				if (bActive)
+				{
+					// Keep the stack in step with the active action sets, so PopActionSet can deactivate this one too
+					SteamVRInputActionSet.bIsActive = true;
+					ActionSetStack.Remove(ActionSetName);
+					ActionSetStack.Add(ActionSetName);
+				}
+				else
+				{
+					DeactivateActionSet(SteamVRInputActionSet);
+				}
+
+				RebuildActiveActionSets();
 			}
+			return true;
 		}
+	}
 
-		if (InputError == VRInputError_None && PoseData.pose.bDeviceIsConnected)
+	UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Unable to find action set [%s]"), *ActionSetName.ToString());
+	return false;
+}
+
+bool FSteamVRInputDevice::IsActionSetActive(FName ActionSetName) const
+{
+	FScopeLock ActionStateScopeLock(&ActionStateLock);
+
+	for (const FSteamVRInputActionSet& SteamVRInputActionSet : SteamVRInputActionSets)
+	{
+		if (SteamVRInputActionSet.Name == ActionSetName)
 		{
-			TrackingStatus = ETrackingStatus::Tracked;
+			return SteamVRInputActionSet.bIsActive;
 		}
 	}
 
-	return TrackingStatus;
+	return false;
 }
 
-ETrackingStatus FSteamVRInputDevice::GetControllerTrackingStatus(const int32 ControllerIndex, const EControllerHand DeviceHand) const
+bool FSteamVRInputDevice::PushActionSet(FName ActionSetName, const FString& RestrictedToDevicePath)
 {
-	return GetControllerTrackingStatus(ControllerIndex, GetMotionSourceName(DeviceHand));
+	FScopeLock ActionStateScopeLock(&ActionStateLock);
+
+	FSteamVRInputActionSet* FoundActionSet = SteamVRInputActionSets.FindByPredicate([ActionSetName](const FSteamVRInputActionSet& SteamVRInputActionSet)
+	{
+		return SteamVRInputActionSet.Name == ActionSetName;
+	});
+
+	if (FoundActionSet == nullptr)
+	{
+		UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Unable to push action set [%s], it is not defined"), *ActionSetName.ToString());
+		return false;
+	}
+
+	// Resolve the device this action set is restricted to, if any
+	VRInputValueHandle_t RestrictedToDeviceHandle = k_ulInvalidInputValueHandle;
+	if (!RestrictedToDevicePath.IsEmpty() && FSteamVRInputRuntime::VRInput())
+	{
+		EVRInputError InputError;
+		{
+			FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+			InputError = FSteamVRInputRuntime::VRInput()->GetInputSourceHandle(TCHAR_TO_UTF8(*RestrictedToDevicePath), &RestrictedToDeviceHandle);
+		}
+
+		if (InputError != VRInputError_None)
+		{
+			GetInputError(InputError, FString::Printf(TEXT("Restricting action set %s to device %s"), *ActionSetName.ToString(), *RestrictedToDevicePath));
+			return false;
+		}
+	}
+
+	FoundActionSet->bIsActive = true;
+	FoundActionSet->RestrictedToDevicePath = RestrictedToDevicePath;
+	FoundActionSet->RestrictedToDeviceHandle = RestrictedToDeviceHandle;
+
+	// Pushing an action set that is already on the stack moves it to the top
+	ActionSetStack.Remove(ActionSetName);
+	ActionSetStack.Add(ActionSetName);
+
+	RebuildActiveActionSets();
+	return true;
 }
 
-FName FSteamVRInputDevice::GetMotionControllerDeviceTypeName() const
+bool FSteamVRInputDevice::PopActionSet(FName ActionSetName)
 {
-	return FName(TEXT("SteamVRInputDevice"));
-}
+	FScopeLock ActionStateScopeLock(&ActionStateLock);
 
+	if (ActionSetStack.Num() == 0)
+	{
+		return false;
+	}
 
-bool FSteamVRInputDevice::GetHandJointPosition(const FName MotionSource, int jointIndex, FVector& OutPosition) const
-{
-	return false;
-}
+	// Default to the most recently pushed action set
+	if (ActionSetName.IsNone())
+	{
+		ActionSetName = ActionSetStack.Last();
+	}
 
+	if (ActionSetStack.Remove(ActionSetName) == 0)
+	{
+		return false;
+	}
 
-FName FSteamVRInputDevice::GetMotionSourceName(const EControllerHand MotionSource) const
-{
-	switch ((uint32)MotionSource)
+	for (FSteamVRInputActionSet& SteamVRInputActionSet : SteamVRInputActionSets)
 	{
-	case 0:
-		return FName(TEXT("Left"));
-		break;
-	case 1:
-		return FName(TEXT("Right"));
-		break;
-	case 2:
-		return FName(TEXT("AnyHand"));
-		break;
-	case 3:
-		return FName(TEXT("Pad"));
-		break;
-	case 4:
-		return FName(TEXT("ExternalCamera"));
-		break;
-	case 5:
-		return FName(TEXT("Gun"));
-		break;
-	case 6:
-		return FName(TEXT("Special_1"));
-		break;
-	case 7:
-		return FName(TEXT("Special_2"));
-		break;
-	case 8:
-		return FName(TEXT("Special_3"));
-		break;
-	case 9:
-		return FName(TEXT("Special_4"));
-		break;
-	case 10:
-		return FName(TEXT("Special_5"));
-		break;
-	case 11:
-		return FName(TEXT("Special_6"));
-		break;
-	case 12:
-		return FName(TEXT("Special_7"));
-		break;
-	case 13:
-		return FName(TEXT("Special_8"));
-		break;
-	case 14:
-		return FName(TEXT("Special_9"));
-		break;
-	case 15:
-		return FName(TEXT("Special_10"));
-		break;
-	case 16:
-		return FName(TEXT("Special_11"));
-		break;
-	case 17:
-		return FName(TEXT("Tracker_Camera"));
-		break;
-	case 18:
-		return FName(TEXT("Tracker_Chest"));
-		break;
-	case 19:
-		return FName(TEXT("Tracker_Handheld_Back_Left"));
-		break;
-	case 20:
-		return FName(TEXT("Tracker_Handheld_Back_Right"));
-		break;
-	case 21:
-		return FName(TEXT("Tracker_Handheld_Front_Left"));
-		break;
-	case 22:
-		return FName(TEXT("Tracker_Handheld_Front_Right"));
-		break;
-	case 23:
-		return FName(TEXT("Tracker_Handheld_FrontRolled_Left"));
-		break;
-	case 24:
-		return FName(TEXT("Tracker_Handheld_FrontRolled_Right"));
-		break;
-	case 25:
-		return FName(TEXT("Tracker_Handheld_PistolGrip_Left"));
-		break;
-	case 26:
-		return FName(TEXT("Tracker_Handheld_PistolGrip_Right"));
-		break;
-	case 27:
-		return FName(TEXT("Tracker_Handheld_RawPose_Left"));
-		break;
-	case 28:
-		return FName(TEXT("Tracker_Handheld_RawPose_Right"));
-		break;
-	case 29:
-		return FName(TEXT("Tracker_Foot_Left"));
-		break;
-	case 30:
-		return FName(TEXT("Tracker_Foot_Right"));
-		break;
-	case 31:
-		return FName(TEXT("Tracker_Shoulder_Left"));
-		break;
-	case 32:
-		return FName(TEXT("Tracker_Shoulder_Right"));
-		break;
-	case 33:
-		return FName(TEXT("Tracker_Keyboard"));
-		break;
-	case 34:
-		return FName(TEXT("Tracker_Waist"));
-		break;
-	default:
-		return NAME_None;
-		break;
+		if (SteamVRInputActionSet.Name == ActionSetName)
+		{
+			DeactivateActionSet(SteamVRInputActionSet);
+			break;
+		}
 	}
-}
 
-void FSteamVRInputDevice::EnumerateSources(TArray<FMotionControllerSource>& SourcesOut) const
-{
-	SourcesOut.Add(FMotionControllerSource(TEXT("Left")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Right")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("AnyHand")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Pad")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("ExternalCamera")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Gun")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Camera")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Chest")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Foot_Left")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Foot_Right")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Shoulder_Left")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Shoulder_Right")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Keyboard")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Waist")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_RawPose_Left")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_RawPose_Right")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_Back_Left")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_Back_Right")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_Front_Left")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_Front_Right")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_FrontRolled_Left")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_FrontRolled_Right")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_PistolGrip_Left")));
-	SourcesOut.Add(FMotionControllerSource(TEXT("Tracker_Handheld_PistolGrip_Right")));
+	RebuildActiveActionSets();
+	return true;
 }
 
-void FSteamVRInputDevice::SetHapticFeedbackValues(int32 ControllerId, int32 Hand, const FHapticFeedbackValues& Values)
+void FSteamVRInputDevice::LoadActionSetDefinitions()
 {
-	VRActionHandle_t VibrationAction = k_ulInvalidActionHandle;
+	ActionSetDefinitions.Empty();
 
-	switch (Hand)
+	TArray<FString> ActionSetEntries;
+	if (GConfig == nullptr || GConfig->GetArray(TEXT(ACTION_SETS_CONFIG_SECTION), TEXT("ActionSets"), ActionSetEntries, GGameIni) == 0)
 	{
-		case (int32)EControllerHand::Left:
-			VibrationAction = VRVibrationLeft;
-			break;
-		case (int32)EControllerHand::Right:
-			VibrationAction = VRVibrationRight;
-			break;
-		case (int32)EControllerHand::AnyHand:
-			VibrationAction = VRVibrationLeft;	// UE4.17+: Hardwire AnyHand to OpenVR's left path as it is the lowest device id to cover most use cases without triggering a duplicate vibration/rumble. TODO: May need refactor for cases where there's a left hand device set & right hand was set to AnyHand for some reason.
-			break;
+		return;
 	}
 
-	if (VRSystem() && VRInput() && VibrationAction != k_ulInvalidActionHandle)
+	for (const FString& ActionSetEntry : ActionSetEntries)
 	{
-		VRInput()->TriggerHapticVibrationAction(VibrationAction, 0.f, CurrentDeltaTime, Values.Frequency, Values.Amplitude, k_ulInvalidInputValueHandle);
-		//UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[HAPTIC] Hand: %i, Duration: %f, Frequency: %f, Amplitude: %f"), Hand, CurrentDeltaTime, Values.Frequency, Values.Amplitude);
+		FString ActionSetName;
+		if (!FParse::Value(*ActionSetEntry, TEXT("Name="), ActionSetName) || ActionSetName.IsEmpty())
+		{
+			UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Skipping action set without a name: %s"), *ActionSetEntry);
+			continue;
+		}
+
+		// Main is always generated and cannot be redefined
+		const FString ActionSetPath = FString(TEXT(ACTION_SET_PREFIX)) + ActionSetName.ToLower();
+		if (ActionSetPath.Equals(TEXT(ACTION_SET), ESearchCase::IgnoreCase)
+			|| ActionSetDefinitions.ContainsByPredicate([&ActionSetPath](const FSteamVRInputActionSetDefinition& ActionSetDefinition) { return ActionSetDefinition.Path == ActionSetPath; }))
+		{
+			UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Skipping duplicate action set: %s"), *ActionSetPath);
+			continue;
+		}
+
+		if (ActionSetDefinitions.Num() >= MAX_ACTION_SETS - 1)
+		{
+			UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Maximum of %i action sets reached, skipping: %s"), MAX_ACTION_SETS, *ActionSetPath);
+			break;
+		}
+
+		FSteamVRInputActionSetDefinition ActionSetDefinition;
+		ActionSetDefinition.Name = FName(*ActionSetName);
+		ActionSetDefinition.Path = ActionSetPath;
+
+		// Additional action sets default to a higher priority than main, in declaration order
+		ActionSetDefinition.Priority = ActionSetDefinitions.Num() + 1;
+		FParse::Value(*ActionSetEntry, TEXT("Priority="), ActionSetDefinition.Priority);
+
+		if (!FParse::Value(*ActionSetEntry, TEXT("Description="), ActionSetDefinition.Description) || ActionSetDefinition.Description.IsEmpty())
+		{
+			ActionSetDefinition.Description = ActionSetName;
+		}
+
+		FString ActionNames;
+		if (FParse::Value(*ActionSetEntry, TEXT("Actions="), ActionNames))
+		{
+			TArray<FString> ActionNameArray;
+			ActionNames.ParseIntoArray(ActionNameArray, TEXT(","), true);
+			for (FString& ActionName : ActionNameArray)
+			{
+				ActionSetDefinition.ActionNames.AddUnique(FName(*ActionName.TrimStartAndEnd()));
+			}
+		}
+
+		UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Action set [%s] defined with %i actions"), *ActionSetPath, ActionSetDefinition.ActionNames.Num());
+		ActionSetDefinitions.Add(ActionSetDefinition);
 	}
 }
 
-void FSteamVRInputDevice::GetHapticFrequencyRange(float& MinFrequency, float& MaxFrequency) const
+FString FSteamVRInputDevice::GetActionPathIn(FName InputName) const
 {
-	MinFrequency = MaxFrequency = 0.f;
-}
+	for (const FSteamVRInputActionSetDefinition& ActionSetDefinition : ActionSetDefinitions)
+	{
+		if (ActionSetDefinition.ActionNames.Contains(InputName))
+		{
+			return ActionSetDefinition.Path / TEXT("in");
+		}
+	}
 
-float FSteamVRInputDevice::GetHapticAmplitudeScale() const
-{
-	return 1.f;
+	return FString(TEXT(ACTION_PATH_IN));
 }
 
-
-
 void FSteamVRInputDevice::GetControllerFidelity()
 {
-	if (VRInput() && VRCompositor())
+	if (FSteamVRInputRuntime::VRInput() && FSteamVRInputRuntime::VRCompositor())
 	{
 		InputPoseActionData_t PoseData = {};
 		EVRInputError InputError = VRInputError_NoData;
@@ -1506,7 +2168,7 @@ void FSteamVRInputDevice::GetControllerFidelity()
 			return;
 		}
 
-		InputError = VRInput()->GetPoseActionDataForNextFrame(VRControllerHandleLeft, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
+		InputError = GetPoseActionData(VRControllerHandleLeft, PoseData);
 		
 		if (InputError != VRInputError_None)
 		{
@@ -1520,7 +2182,10 @@ void FSteamVRInputDevice::GetControllerFidelity()
 				return;
 			}
 
-			InputError = VRInput()->GetSkeletalTrackingLevel(VRSkeletalHandleLeft, &LeftControllerFidelity);
+			{
+				FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+				InputError = FSteamVRInputRuntime::VRInput()->GetSkeletalTrackingLevel(VRSkeletalHandleLeft, &LeftControllerFidelity);
+			}
 
 			if (InputError != VRInputError_None)
 			{
@@ -1540,7 +2205,7 @@ void FSteamVRInputDevice::GetControllerFidelity()
 			return;
 		}
 
-		InputError = VRInput()->GetPoseActionDataForNextFrame(VRControllerHandleRight, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
+		InputError = GetPoseActionData(VRControllerHandleRight, PoseData);
 		if (PoseData.bActive && PoseData.pose.bDeviceIsConnected)
 		{
 			if (VRSkeletalHandleRight == k_ulInvalidActionHandle)
@@ -1548,7 +2213,10 @@ void FSteamVRInputDevice::GetControllerFidelity()
 				return;
 			}
 
-			VRInput()->GetSkeletalTrackingLevel(VRSkeletalHandleRight, &RightControllerFidelity);
+			{
+				FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+				FSteamVRInputRuntime::VRInput()->GetSkeletalTrackingLevel(VRSkeletalHandleRight, &RightControllerFidelity);
+			}
 
 			if (InputError != VRInputError_None)
 			{
@@ -1570,14 +2238,14 @@ void FSteamVRInputDevice::GetLeftHandPoseData(FVector& Position, FRotator& Orien
 	InputPoseActionData_t PoseData = {};
 	EVRInputError InputError = VRInputError_NoData;
 
-	if (bIsSkeletalControllerRightPresent && VRInput())
+	if (bIsSkeletalControllerRightPresent && FSteamVRInputRuntime::VRInput())
 	{
 		if (VRSkeletalHandleLeft == k_ulInvalidActionHandle)
 		{
 			return;
 		}
 
-		InputError = VRInput()->GetPoseActionDataForNextFrame(VRSkeletalHandleLeft, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
+		InputError = GetPoseActionData(VRSkeletalHandleLeft, PoseData);
 		
 		if (InputError != VRInputError_None || VRSkeletalHandleLeft == k_ulInvalidActionHandle)
 		{
@@ -1606,14 +2274,14 @@ void FSteamVRInputDevice::GetRightHandPoseData(FVector& Position, FRotator& Orie
 	InputPoseActionData_t PoseData = {};
 	EVRInputError InputError = VRInputError_NoData;
 
-	if (bIsSkeletalControllerRightPresent && VRInput())
+	if (bIsSkeletalControllerRightPresent && FSteamVRInputRuntime::VRInput())
 	{
 		if (VRSkeletalHandleRight == k_ulInvalidActionHandle)
 		{
 			return;
 		}
 
-		InputError = VRInput()->GetPoseActionDataForNextFrame(VRSkeletalHandleRight, VRCompositor()->GetTrackingSpace(), &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
+		InputError = GetPoseActionData(VRSkeletalHandleRight, PoseData);
 		
 		if (InputError != VRInputError_None)
 		{
@@ -1670,12 +2338,16 @@ void FSteamVRInputDevice::GetUETransform(InputPoseActionData_t PoseData, FVector
 
 void FSteamVRInputDevice::SetChannelValue(int32 ControllerId, FForceFeedbackChannelType ChannelType, float Value)
 {
-	// Empty on purpose
+	// Force feedback is mixed with the other haptic requests of the frame, on the hand its channel belongs to
+	const bool bIsLeftChannel = ChannelType == FForceFeedbackChannelType::LEFT_LARGE || ChannelType == FForceFeedbackChannelType::LEFT_SMALL;
+	AddHapticFrameRequest(bIsLeftChannel ? EControllerHand::Left : EControllerHand::Right, Value, 1.f);
 }
 
 void FSteamVRInputDevice::SetChannelValues(int32 ControllerId, const FForceFeedbackValues &values)
 {
-	// Empty on purpose
+	// Force feedback is mixed with the other haptic requests of the frame, the loudest channel of each side drives its hand
+	AddHapticFrameRequest(EControllerHand::Left, FMath::Max(values.LeftLarge, values.LeftSmall), 1.f);
+	AddHapticFrameRequest(EControllerHand::Right, FMath::Max(values.RightLarge, values.RightSmall), 1.f);
 }
 
 void FSteamVRInputDevice::InitControllerMappings()
@@ -1719,7 +2391,6 @@ bool FSteamVRInputDevice::GenerateAppManifest(FString ManifestPath, FString Proj
 {
 	// Set SteamVR AppKey
 	OutAppKey = (TEXT(APP_MANIFEST_PREFIX) + SanitizeString(GameProjectName) + TEXT(".") + ProjectName).ToLower();
-	EditorAppKey = FString(OutAppKey);
 
 	// Set Application Manifest Path - same directory where the action manifest will be
 	OutAppManifestPath = FPaths::ProjectConfigDir() / APP_MANIFEST_FILE;
@@ -1772,7 +2443,7 @@ bool FSteamVRInputDevice::GenerateAppManifest(FString ManifestPath, FString Proj
 
 void FSteamVRInputDevice::ReloadActionManifest()
 {
-	if (VRSystem() && VRInput() && VRApplications())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput() && FSteamVRInputRuntime::VRApplications())
 	{
 		// Set Action Manifest Path
 		const FString ManifestPath = FPaths::ProjectConfigDir() / CONTROLLER_BINDING_PATH / ACTION_MANIFEST;
@@ -1780,8 +2451,8 @@ void FSteamVRInputDevice::ReloadActionManifest()
 			
 		// Load application manifest
 		FString AppManifestPath = FPaths::ProjectConfigDir() / APP_MANIFEST_FILE;
-		EVRApplicationError AppError = VRApplications()->AddApplicationManifest(TCHAR_TO_UTF8(*IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*AppManifestPath)), true);
-		UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Registering Application Manifest %s : %s"), *AppManifestPath, *FString(UTF8_TO_TCHAR(VRApplications()->GetApplicationsErrorNameFromEnum(AppError))));
+		EVRApplicationError AppError = FSteamVRInputRuntime::VRApplications()->AddApplicationManifest(TCHAR_TO_UTF8(*IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*AppManifestPath)), true);
+		UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Registering Application Manifest %s : %s"), *AppManifestPath, *FString(UTF8_TO_TCHAR(FSteamVRInputRuntime::VRApplications()->GetApplicationsErrorNameFromEnum(AppError))));
 		
 		// Get the App Process Id
 		uint32 AppProcessId = FPlatformProcess::GetCurrentProcessId();
@@ -1791,11 +2462,11 @@ void FSteamVRInputDevice::ReloadActionManifest()
 		FString SteamVRAppKey = (TEXT(APP_MANIFEST_PREFIX) + SanitizeString(GameProjectName) + TEXT(".") + AppFileName).ToLower();
 		
 		// Set AppKey for this Editor Session
-		AppError = VRApplications()->IdentifyApplication(AppProcessId, TCHAR_TO_UTF8(*SteamVRAppKey));
-		UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Editor Application [%d][%s] identified to SteamVR: %s"), AppProcessId, *SteamVRAppKey, *FString(UTF8_TO_TCHAR(VRApplications()->GetApplicationsErrorNameFromEnum(AppError))));
+		AppError = FSteamVRInputRuntime::VRApplications()->IdentifyApplication(AppProcessId, TCHAR_TO_UTF8(*SteamVRAppKey));
+		UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Editor Application [%d][%s] identified to SteamVR: %s"), AppProcessId, *SteamVRAppKey, *FString(UTF8_TO_TCHAR(FSteamVRInputRuntime::VRApplications()->GetApplicationsErrorNameFromEnum(AppError))));
 
 		// Set Action Manifest
-		EVRInputError InputError = VRInput()->SetActionManifestPath(TCHAR_TO_UTF8(*IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*ManifestPath)));
+		EVRInputError InputError = FSteamVRInputRuntime::VRInput()->SetActionManifestPath(TCHAR_TO_UTF8(*IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*ManifestPath)));
 		GetInputError(InputError, FString(TEXT("Setting Action Manifest Path")));
 	}
 }
@@ -1829,13 +2500,35 @@ void FSteamVRInputDevice::GenerateControllerBindings(const FString& BindingsPath
 			// Ensure we also handle generic UE4 Motion Controllers
 			if (!SupportedController.Description.Contains(TEXT("Headset"), ESearchCase::IgnoreCase, ESearchDir::FromEnd))
 			{
-				FControllerType GenericController = FControllerType(TEXT("MotionController"), TEXT("MotionController"), TEXT("MotionController"));
-				GenerateActionBindings(InInputMapping, JsonValuesArray, GenericController, true);
+				FControllerType GenericController = FControllerType(TEXT("MotionController"), TEXT("MotionController"), TEXT("MotionController"));
+				GenerateActionBindings(InInputMapping, JsonValuesArray, GenericController, true);
+			}
+
+			// Split the sources between the action sets their outputs belong to, anything else stays in main
+			TArray<TSharedPtr<FJsonValue>> MainSourcesArray;
+			TArray<TArray<TSharedPtr<FJsonValue>>> AdditionalSourcesArrays;
+			AdditionalSourcesArrays.SetNum(ActionSetDefinitions.Num());
+			for (const TSharedPtr<FJsonValue>& SourceJsonValue : JsonValuesArray)
+			{
+				const FString OutputPath = GetBindingSourceOutputPath(SourceJsonValue);
+				const int32 DefinitionIndex = ActionSetDefinitions.IndexOfByPredicate([&OutputPath](const FSteamVRInputActionSetDefinition& ActionSetDefinition)
+				{
+					return OutputPath.StartsWith(ActionSetDefinition.Path + TEXT("/"));
+				});
+
+				if (DefinitionIndex != INDEX_NONE)
+				{
+					AdditionalSourcesArrays[DefinitionIndex].Add(SourceJsonValue);
+				}
+				else
+				{
+					MainSourcesArray.Add(SourceJsonValue);
+				}
 			}
 
 			// Create Action Set
 			TSharedRef<FJsonObject> ActionSetJsonObject = MakeShareable(new FJsonObject());
-			ActionSetJsonObject->SetArrayField(TEXT("sources"), JsonValuesArray);
+			ActionSetJsonObject->SetArrayField(TEXT("sources"), MainSourcesArray);
 
 			// Add tracker poses
 			if (SupportedController.Name.IsEqual(TEXT("vive_tracker_handed")) || SupportedController.Name.IsEqual(TEXT("vive_tracker")))
@@ -2203,6 +2896,17 @@ void FSteamVRInputDevice::GenerateControllerBindings(const FString& BindingsPath
 			// Create Bindings File that includes all Action Sets
 			TSharedRef<FJsonObject> BindingsJsonObject = MakeShareable(new FJsonObject());
 			BindingsJsonObject->SetObjectField(TEXT(ACTION_SET), ActionSetJsonObject);
+
+			for (int32 DefinitionIndex = 0; DefinitionIndex < ActionSetDefinitions.Num(); ++DefinitionIndex)
+			{
+				if (AdditionalSourcesArrays[DefinitionIndex].Num() > 0)
+				{
+					TSharedRef<FJsonObject> AdditionalActionSetJsonObject = MakeShareable(new FJsonObject());
+					AdditionalActionSetJsonObject->SetArrayField(TEXT("sources"), AdditionalSourcesArrays[DefinitionIndex]);
+					BindingsJsonObject->SetObjectField(ActionSetDefinitions[DefinitionIndex].Path, AdditionalActionSetJsonObject);
+				}
+			}
+
 			BindingsObject->SetObjectField(TEXT("bindings"), BindingsJsonObject);
 
 			// Set description of Bindings file to the Project Name
@@ -2909,53 +3613,84 @@ void FSteamVRInputDevice::GenerateActionBindings(TArray<FInputMapping> &InInputM
 }
 
 void FSteamVRInputDevice::GenerateActionManifest(bool GenerateActions, bool GenerateBindings, bool RegisterApp, bool DeleteIfExists, bool bRegisterManifestOnly)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SteamVRInput_ActionManifest);
+	CSV_SCOPED_TIMING_STAT(SteamVRInput, ActionManifest);
+
+	// Never build over the startup action manifest while it is still being registered
+	FinishAsyncInitialization(true);
+
+	FSteamVRActionManifestBuild Build(GenerateActions, GenerateBindings, RegisterApp, DeleteIfExists, bRegisterManifestOnly);
+	GatherActionManifest(Build);
+	if (!WriteActionManifest(Build))
+	{
+		return;
+	}
+
+	// Register Application to SteamVR. Handles are resolved into the build, as the startup worker does, so pose reads on the render thread
+	// aren't held up by the round trips. SteamVR handles are derived from their paths, so the ones the polling thread reads stay valid meanwhile
+	if (Build.bRegisterApp)
+	{
+		RegisterApplication(Build);
+	}
+
+	// The polling thread reads the action sets and action lists rebuilt below
+	FScopeLock ActionStateScopeLock(&ActionStateLock);
+	FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+	ApplyActionManifest(Build);
+}
+
+void FSteamVRInputDevice::GatherActionManifest(FSteamVRActionManifestBuild& Build)
 {
 	// Set Action Manifest Path
-	const FString ManifestPath = FPaths::ProjectConfigDir() / CONTROLLER_BINDING_PATH / ACTION_MANIFEST;
-	UE_LOG(LogSteamVRInputDevice, Display, TEXT("Action Manifest Path: %s"), *ManifestPath);
+	Build.ManifestPath = FPaths::ProjectConfigDir() / CONTROLLER_BINDING_PATH / ACTION_MANIFEST;
+	UE_LOG(LogSteamVRInputDevice, Display, TEXT("Action Manifest Path: %s"), *Build.ManifestPath);
 
-	// Create Action Manifest json object
-	TSharedRef<FJsonObject> ActionManifestObject = MakeShareable(new FJsonObject());
-	TArray<FString> LocalizationFields = {"language_tag", "en_us"};
+	// Fill in the Action Manifest json object
+	TSharedRef<FJsonObject> ActionManifestObject = Build.ActionManifestObject.ToSharedRef();
+	TArray<FString>& LocalizationFields = Build.LocalizationFields;
+	LocalizationFields = {"language_tag", "en_us"};
 
-	// Set where to look for controller binding files and prepare file manager
-	const FString ControllerBindingsPath = FPaths::ProjectConfigDir() / CONTROLLER_BINDING_PATH;
-	UE_LOG(LogSteamVRInputDevice, Display, TEXT("Controller Bindings Path: %s"), *ControllerBindingsPath);
-	IFileManager& FileManager = FFileManagerGeneric::Get();
+	// Set where to look for controller binding files
+	Build.ControllerBindingsPath = FPaths::ProjectConfigDir() / CONTROLLER_BINDING_PATH;
+	UE_LOG(LogSteamVRInputDevice, Display, TEXT("Controller Bindings Path: %s"), *Build.ControllerBindingsPath);
 
 	// Define Controller Types supported by SteamVR
-	TArray<TSharedPtr<FJsonValue>> ControllerBindings;
-	ControllerTypes.Empty();
-	ControllerTypes.Emplace(FControllerType(TEXT("knuckles"), TEXT("Index Controllers"), TEXT("SteamVR_Index_Controller")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_controller"), TEXT("Vive Controllers"), TEXT("SteamVR_Vive_Controller")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_cosmos_controller"), TEXT("HTC Cosmos Controllers"), TEXT("SteamVR_HTC_Cosmos_Controller")));
-	ControllerTypes.Emplace(FControllerType(TEXT("oculus_touch"), TEXT("Oculus Touch"), TEXT("SteamVR_Oculus_Touch")));
-	ControllerTypes.Emplace(FControllerType(TEXT("holographic_controller"), TEXT("Holographic Controller"), TEXT("SteamVR_Windows_MR")));
+	TArray<FControllerType>& SupportedControllerTypes = Build.ControllerTypes;
+	SupportedControllerTypes.Empty();
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("knuckles"), TEXT("Index Controllers"), TEXT("SteamVR_Index_Controller")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_controller"), TEXT("Vive Controllers"), TEXT("SteamVR_Vive_Controller")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_cosmos_controller"), TEXT("HTC Cosmos Controllers"), TEXT("SteamVR_HTC_Cosmos_Controller")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("oculus_touch"), TEXT("Oculus Touch"), TEXT("SteamVR_Oculus_Touch")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("holographic_controller"), TEXT("Holographic Controller"), TEXT("SteamVR_Windows_MR")));
 	
-	ControllerTypes.Emplace(FControllerType(TEXT("indexhmd"), TEXT("Valve Index Headset"), TEXT("SteamVR_Valve_Index_Headset")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive"), TEXT("Vive Headset"), TEXT("SteamVR_Vive")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_pro"), TEXT("Vive Pro Headset"), TEXT("SteamVR_Vive_Pro")));
-	ControllerTypes.Emplace(FControllerType(TEXT("rift"), TEXT("Rift Headset"), TEXT("SteamVR_Rift")));
-
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_tracker"), TEXT("Vive Tracker"), TEXT("SteamVR_Vive_Tracker")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_camera"), TEXT("Vive Tracker (Camera)"), TEXT("SteamVR_Vive_Tracker_Camera")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_waist"), TEXT("Vive Tracker (Waist)"), TEXT("SteamVR_Vive_Tracker_Waist")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_left_foot"), TEXT("Vive Tracker (Left Foot)"), TEXT("SteamVR_Vive_Tracker_Left_Foot")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_right_foot"), TEXT("Vive Tracker (Right Foot)"), TEXT("SteamVR_Vive_Tracker_Right_Foot")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_left_shoulder"), TEXT("Vive Tracker (Left Shoulder)"), TEXT("SteamVR_Vive_Tracker_Left_Shoulder")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_right_shoulder"), TEXT("Vive Tracker (Right Shoulder)"), TEXT("SteamVR_Vive_Tracker_Right_Shoulder")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_chest"), TEXT("Vive Tracker (Chest)"), TEXT("SteamVR_Vive_Tracker_Chest")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_handed"), TEXT("Vive Tracker (Handed)"), TEXT("SteamVR_Vive_Tracker_Handed")));
-	ControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_keyboard"), TEXT("Vive Tracker (Keyboard)"), TEXT("SteamVR_Vive_Tracker_Keyboard")));
-
-	ControllerTypes.Emplace(FControllerType(TEXT("gamepad"), TEXT("Gamepads"), TEXT("SteamVR_Gamepads")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("indexhmd"), TEXT("Valve Index Headset"), TEXT("SteamVR_Valve_Index_Headset")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive"), TEXT("Vive Headset"), TEXT("SteamVR_Vive")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_pro"), TEXT("Vive Pro Headset"), TEXT("SteamVR_Vive_Pro")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("rift"), TEXT("Rift Headset"), TEXT("SteamVR_Rift")));
+
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_tracker"), TEXT("Vive Tracker"), TEXT("SteamVR_Vive_Tracker")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_camera"), TEXT("Vive Tracker (Camera)"), TEXT("SteamVR_Vive_Tracker_Camera")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_waist"), TEXT("Vive Tracker (Waist)"), TEXT("SteamVR_Vive_Tracker_Waist")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_left_foot"), TEXT("Vive Tracker (Left Foot)"), TEXT("SteamVR_Vive_Tracker_Left_Foot")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_right_foot"), TEXT("Vive Tracker (Right Foot)"), TEXT("SteamVR_Vive_Tracker_Right_Foot")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_left_shoulder"), TEXT("Vive Tracker (Left Shoulder)"), TEXT("SteamVR_Vive_Tracker_Left_Shoulder")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_right_shoulder"), TEXT("Vive Tracker (Right Shoulder)"), TEXT("SteamVR_Vive_Tracker_Right_Shoulder")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_chest"), TEXT("Vive Tracker (Chest)"), TEXT("SteamVR_Vive_Tracker_Chest")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_handed"), TEXT("Vive Tracker (Handed)"), TEXT("SteamVR_Vive_Tracker_Handed")));
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("vive_tracker_keyboard"), TEXT("Vive Tracker (Keyboard)"), TEXT("SteamVR_Vive_Tracker_Keyboard")));
+
+	SupportedControllerTypes.Emplace(FControllerType(TEXT("gamepad"), TEXT("Gamepads"), TEXT("SteamVR_Gamepads")));
 	
 #pragma region ACTIONS
 	// Clear Actions cache
 	Actions.Empty();
 
+	// Find out which project inputs belong to additional action sets
+	LoadActionSetDefinitions();
+
 	// Setup Input Mappings cache
-	TArray<FInputMapping> InputMappings;
+	TArray<FInputMapping>& InputMappings = Build.InputMappings;
 	TArray<FName> UniqueInputs;
 
 	// Remove any existing temporary keys in the input in
@@ -3299,13 +4034,72 @@ void FSteamVRInputDevice::GenerateActionManifest(bool GenerateActions, bool Gene
 
 	// Add action sets array to the Action Manifest object
 	ActionSets.Add(MakeShareable(new FJsonValueObject(ActionSetObject)));
-	ActionManifestObject->SetArrayField(TEXT("action_sets"), ActionSets);
 
 	// Set localization text for the action set
 	LocalizationFields.Add(TEXT(ACTION_SET));
 	LocalizationFields.Add("Main Game Actions");
+
+	// Add the additional action sets declared in the project's game config
+	for (const FSteamVRInputActionSetDefinition& ActionSetDefinition : ActionSetDefinitions)
+	{
+		TSharedRef<FJsonObject> AdditionalActionSetObject = MakeShareable(new FJsonObject());
+		TArray<FString> AdditionalStringFields = {
+									 "name", ActionSetDefinition.Path,
+									 "usage", TEXT("leftright")
+		};
+		BuildJsonObject(AdditionalStringFields, AdditionalActionSetObject);
+		ActionSets.Add(MakeShareable(new FJsonValueObject(AdditionalActionSetObject)));
+
+		LocalizationFields.Add(ActionSetDefinition.Path);
+		LocalizationFields.Add(ActionSetDefinition.Description);
+	}
+
+	ActionManifestObject->SetArrayField(TEXT("action_sets"), ActionSets);
 #pragma endregion
 
+	// The worker registering the action manifest resolves the handles of its own copy of the actions and action sets
+	Build.Actions = Actions;
+	Build.ActionSetDefinitions = ActionSetDefinitions;
+
+	// Get Project Name this plugin is used in, config can only be read on the game thread
+	uint32 AppProcessId = FPlatformProcess::GetCurrentProcessId();
+	GameFileName = FPaths::GetCleanFilename(FPlatformProcess::GetApplicationName(AppProcessId));
+	if (GConfig)
+	{
+		GConfig->GetString(
+			TEXT("/Script/EngineSettings.GeneralProjectSettings"),
+			TEXT("ProjectName"),
+			GameProjectName,
+			GGameIni
+		);
+
+	}
+
+	// Use uprojectname if empty
+	if (GameProjectName.IsEmpty())
+	{
+		GameProjectName = FApp::GetProjectName();
+	}
+
+	// Add engine build number 
+	FString BuildVersion = FApp::GetBuildVersion();
+	int32 ChangeListIdx = BuildVersion.Find(FString(TEXT("-CL-")));
+
+	FString ChangeListNum = ChangeListIdx > 0 ? BuildVersion.Right(BuildVersion.Len() - ChangeListIdx) : FString(TEXT("0000"));
+	GameProjectName += ChangeListNum;
+}
+
+bool FSteamVRInputDevice::WriteActionManifest(FSteamVRActionManifestBuild& Build)
+{
+	// Overwriting existing controller bindings asks the user first
+	check(!Build.bDeleteIfExists || IsInGameThread());
+
+	const FString& ManifestPath = Build.ManifestPath;
+	const FString& ControllerBindingsPath = Build.ControllerBindingsPath;
+	TSharedRef<FJsonObject> ActionManifestObject = Build.ActionManifestObject.ToSharedRef();
+	IFileManager& FileManager = FFileManagerGeneric::Get();
+	TArray<TSharedPtr<FJsonValue>> ControllerBindings;
+
 #pragma region DEFAULT CONTROLLER BINDINGS
 	// Start search for controller bindings files
 	TArray<FString> ControllerBindingFiles;
@@ -3346,7 +4140,7 @@ void FSteamVRInputDevice::GenerateActionManifest(bool GenerateActions, bool Gene
 			bool bIsGenerated = true;
 
 			// Check if we need to delete existing controller bindings - skip trackers
-			if (DeleteIfExists && !ControllerType.Contains("vive_tracker"))
+			if (Build.bDeleteIfExists && !ControllerType.Contains("vive_tracker"))
 			{			
 				// Check if we're doing a granular overwrite
 				if (OverwriteResponse == EAppReturnType::No || OverwriteResponse == EAppReturnType::Yes)
@@ -3408,7 +4202,7 @@ void FSteamVRInputDevice::GenerateActionManifest(bool GenerateActions, bool Gene
 			ControllerBindings.Add(MakeShareable(new FJsonValueObject(ControllerBindingObject)));
 
 			// Tag this controller's generated status
-			for (auto& DefaultControllerType : ControllerTypes)
+			for (auto& DefaultControllerType : Build.ControllerTypes)
 			{
 				if (DefaultControllerType.Name == FName(*ControllerType))
 				{
@@ -3421,9 +4215,9 @@ void FSteamVRInputDevice::GenerateActionManifest(bool GenerateActions, bool Gene
 
 	#if WITH_EDITOR
 	// If we're running in the editor, build the controller bindings if they don't exist yet
-	if (GenerateBindings)
+	if (Build.bGenerateBindings)
 	{
-		GenerateControllerBindings(ControllerBindingsPath, ControllerTypes, ControllerBindings, Actions, InputMappings, DeleteIfExists);
+		GenerateControllerBindings(ControllerBindingsPath, Build.ControllerTypes, ControllerBindings, Build.Actions, Build.InputMappings, Build.bDeleteIfExists);
 	}
 	#endif
 
@@ -3444,7 +4238,7 @@ void FSteamVRInputDevice::GenerateActionManifest(bool GenerateActions, bool Gene
 	TSharedRef<FJsonObject> LocalizationsObject = MakeShareable(new FJsonObject());
 
 	// Build & add localizations to the Action Manifest object
-	BuildJsonObject(LocalizationFields, LocalizationsObject);
+	BuildJsonObject(Build.LocalizationFields, LocalizationsObject);
 	Localizations.Add(MakeShareable(new FJsonValueObject(LocalizationsObject)));
 	ActionManifestObject->SetArrayField(TEXT("localization"), Localizations);
 #pragma endregion
@@ -3455,7 +4249,7 @@ void FSteamVRInputDevice::GenerateActionManifest(bool GenerateActions, bool Gene
 	FJsonSerializer::Serialize(ActionManifestObject, JsonWriter);
 
 	// Save json as a UTF8 file
-	if (GenerateActions)
+	if (Build.bGenerateActions)
 	{
 		if (FileManager.FileExists(*ManifestPath))
 		{
@@ -3467,19 +4261,141 @@ void FSteamVRInputDevice::GenerateActionManifest(bool GenerateActions, bool Gene
 			if (!FFileHelper::SaveStringToFile(ActionManifest, *ManifestPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
 			{
 				UE_LOG(LogSteamVRInputDevice, Error, TEXT("Error trying to generate action manifest in: %s"), *ManifestPath);
-				return;
+				return false;
 			}
 		}
 	}
 
-	// Register Application to SteamVR
-	if (RegisterApp)
+	return true;
+}
+
+void FSteamVRInputDevice::ApplyActionManifest(FSteamVRActionManifestBuild& Build)
+{
+	// The polling thread reads the action sets and action lists rebuilt below
+	FScopeLock ActionStateScopeLock(&ActionStateLock);
+
+	ControllerTypes = MoveTemp(Build.ControllerTypes);
+	Actions = MoveTemp(Build.Actions);
+
+	// What SteamVR answered while the manifest was registered, possibly on a worker thread
+	for (const FSteamVRActionManifestResult& Result : Build.Results)
+	{
+		GetInputError(Result.InputError, Result.Description);
+	}
+
+	if (!Build.AppKey.IsEmpty())
 	{
-		RegisterApplication(ManifestPath, bRegisterManifestOnly);
+		EditorAppKey = Build.AppKey;
+	}
+
+	if (Build.bIsRegistered)
+	{
+		// Populate Active Action sets that will later be used in OpenVR calls
+		MainActionSet = Build.MainActionSet;
+		SteamVRInputActionSets = MoveTemp(Build.ActionSets);
+		ActionSetStack.Empty();
+		RebuildActiveActionSets();
+
+		// Set skeletal and haptic handles
+		VRSkeletalHandleLeft = Build.SkeletalHandleLeft;
+		VRSkeletalHandleRight = Build.SkeletalHandleRight;
+		bIsSkeletalControllerLeftPresent = Build.bIsSkeletalControllerLeftPresent;
+		bIsSkeletalControllerRightPresent = Build.bIsSkeletalControllerRightPresent;
+		VRVibrationLeft = Build.VibrationLeft;
+		VRVibrationRight = Build.VibrationRight;
+
+		for (const FSteamVRInputAction& Action : Actions)
+		{
+			// Keep the pose handles of the controllers and trackers
+			if (Action.Path == TEXT(ACTION_PATH_CONTROLLER_LEFT))
+			{
+				VRControllerHandleLeft = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_CONTROLLER_RIGHT))
+			{
+				VRControllerHandleRight = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_CAMERA))
+			{
+				VRTRackerCamera = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_CHEST))
+			{
+				VRTrackerChest = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_BACK_LEFT))
+			{
+				VRTrackerHandedBackL = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_BACK_RIGHT))
+			{
+				VRTrackerHandedBackR = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_FRONT_LEFT))
+			{
+				VRTrackerHandedFrontL = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_FRONT_RIGHT))
+			{
+				VRTrackerHandedFrontR = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_FRONTR_LEFT))
+			{
+				VRTrackerHandedFrontRL = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_FRONTR_RIGHT))
+			{
+				VRTrackerHandedFrontRR = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_GRIP_LEFT))
+			{
+				VRTrackerHandedGripL = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_GRIP_RIGHT))
+			{
+				VRTrackerHandedGripR = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_POSE_LEFT))
+			{
+				VRTrackerHandedPoseL = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_POSE_RIGHT))
+			{
+				VRTrackerHandedPoseR = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_FOOT_LEFT))
+			{
+				VRTrackerFootL = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_FOOT_RIGHT))
+			{
+				VRTrackerFootR = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_SHOULDER_LEFT))
+			{
+				VRTrackerShoulderL = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_SHOULDER_RIGHT))
+			{
+				VRTrackerShoulderR = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_KEYBOARD))
+			{
+				VRTrackerKeyboard = Action.Handle;
+			}
+			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_WAIST))
+			{
+				VRTrackerWaist = Action.Handle;
+			}
+		}
+
+		// Resolve motion sources to their pose handles now that all handles are known
+		BuildMotionSourceHandles();
 	}
 
 	// Update action events
 	ActionEvents.Empty();
+	ActionDispatchList.Empty();
 	bool bAlreadyExists = false;
 	for (FSteamVRInputAction& InputAction : Actions)
 	{
@@ -3496,9 +4412,28 @@ void FSteamVRInputDevice::GenerateActionManifest(bool GenerateActions, bool Gene
 
 		if (!bAlreadyExists && InputAction.Handle != k_ulInvalidActionHandle)
 		{
-			ActionEvents.Add(FSteamVRInputAction(InputAction));
+			FSteamVRInputAction& ActionEvent = ActionEvents.Add_GetRef(FSteamVRInputAction(InputAction));
+
+			// Resolve the temporary keys now so that processing controller events never has to search for them
+			FKey FoundKey;
+			ActionEvent.TemporaryKeyX = FindTemporaryActionKey(ActionEvent.Name, FoundKey) ? FoundKey.GetFName() : NAME_None;
+			ActionEvent.TemporaryKeyY = FindTemporaryActionKey(ActionEvent.Name, FoundKey, true) ? FoundKey.GetFName() : NAME_None;
+
+			// Classify how this action is dispatched so that processing controller events never has to inspect its path
+			ActionDispatchList.Add(FSteamVRActionDispatch(ActionEvent.Handle, ActionEvents.Num() - 1, ClassifyActionDispatch(ActionEvent)));
 		}
 	}
+
+	if (ActionEvents.Num() > INPUT_SNAPSHOT_MAX_ACTIONS)
+	{
+		UE_LOG(LogSteamVRInputDevice, Warning, TEXT("[STEAMVR INPUT] Only the first %d of %d actions are published to input snapshot readers"), INPUT_SNAPSHOT_MAX_ACTIONS, ActionEvents.Num());
+	}
+
+	// Split the action events between their action sets so each action is only processed once per frame
+	PartitionActionEvents();
+
+	// Queued transitions refer to the previous action events
+	ResetPolledDigitalStates();
 }
 
 bool FSteamVRInputDevice::BuildJsonObject(TArray<FString> StringFields, TSharedRef<FJsonObject> OutJsonObject)
@@ -3612,7 +4547,7 @@ void FSteamVRInputDevice::ProcessKeyInputMappings(const UInputSettings* InputSet
 
 			// If there's a Motion Controller or valid device input, add to the SteamVR Input Actions
 			Actions.Add(FSteamVRInputAction(
-				FString(ACTION_PATH_IN) / KeyActionName.ToString(),
+				GetActionPathIn(KeyActionName) / KeyActionName.ToString(),
 				KeyActionName,
 				KeyMapping.Key.GetFName(),
 				false));
@@ -3623,7 +4558,7 @@ void FSteamVRInputDevice::ProcessKeyInputMappings(const UInputSettings* InputSet
 			// Add input to Key Bindings Cache
 			FSteamVRInputKeyMapping SteamVRInputKeyMap = FSteamVRInputKeyMapping(KeyMapping);
 			SteamVRInputKeyMap.ActionName = KeyActionName.ToString();
-			SteamVRInputKeyMap.ActionNameWithPath = FString(ACTION_PATH_IN) / KeyActionName.ToString();
+			SteamVRInputKeyMap.ActionNameWithPath = GetActionPathIn(KeyActionName) / KeyActionName.ToString();
 			SteamVRInputKeyMap.ControllerName = CurrentControllerType;				
 			SteamVRKeyInputMappings.Add(SteamVRInputKeyMap);
 
@@ -4000,7 +4935,7 @@ void FSteamVRInputDevice::ProcessKeyAxisMappings(const UInputSettings* InputSett
 					TEXT(",") +
 					AxisMapping.YAxisName.ToString() +
 					TEXT(" X Y_axis2d");
-				FString ActionPath2D = FString(ACTION_PATH_IN) / AxisName2D;
+				FString ActionPath2D = GetActionPathIn(AxisMapping.InputAxisKeyMapping.AxisName) / AxisName2D;
 
 				Actions.Add(FSteamVRInputAction(ActionPath2D, FName(*AxisName2D), AxisMapping.XAxisKey, AxisMapping.YAxisKey, FVector2D()));
 				AxisMapping.ActionName = FString(AxisName2D);
@@ -4061,7 +4996,7 @@ void FSteamVRInputDevice::ProcessKeyAxisMappings(const UInputSettings* InputSett
 		{
 			// Add a Vector 1 to our Actions List
 			FString AxisName1D = AxisMapping.InputAxisKeyMapping.AxisName.ToString() + TEXT(" axis");
-			FString ActionPath = FString(ACTION_PATH_IN) / AxisName1D;
+			FString ActionPath = GetActionPathIn(AxisMapping.InputAxisKeyMapping.AxisName) / AxisName1D;
 			Actions.Add(FSteamVRInputAction(ActionPath, FName(*AxisName1D), AxisMapping.InputAxisKeyMapping.Key.GetFName(), 0.0f));
 			AxisMapping.ActionName = FString(AxisName1D);
 			AxisMapping.ActionNameWithPath = FString(ActionPath);
@@ -4112,55 +5047,29 @@ void FSteamVRInputDevice::SanitizeActions()
 	Actions.Shrink();
 }
 
-void FSteamVRInputDevice::RegisterApplication(FString ManifestPath, bool bRegisterManfiestOnly)
+void FSteamVRInputDevice::RegisterApplication(FSteamVRActionManifestBuild& Build)
 {
-
-	if (VRSystem() && VRInput())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
-		// Get Project Name this plugin is used in
-		uint32 AppProcessId = FPlatformProcess::GetCurrentProcessId();
-		GameFileName = FPaths::GetCleanFilename(FPlatformProcess::GetApplicationName(AppProcessId));
-		if (GConfig)
-		{
-			GConfig->GetString(
-				TEXT("/Script/EngineSettings.GeneralProjectSettings"),
-				TEXT("ProjectName"),
-				GameProjectName,
-				GGameIni
-			);
-
-		}
-
-		// Use uprojectname if empty
-		if (GameProjectName.IsEmpty())
-		{
-			GameProjectName = FApp::GetProjectName();
-		}
-
-		// Add engine build number 
-		FString BuildVersion = FApp::GetBuildVersion();
-		int32 ChangeListIdx = BuildVersion.Find(FString(TEXT("-CL-")));
-
-		FString ChangeListNum = ChangeListIdx > 0 ? BuildVersion.Right(BuildVersion.Len() - ChangeListIdx) : FString(TEXT("0000"));
-		GameProjectName += ChangeListNum;
-
 #if WITH_EDITOR
-		if (VRApplications() && !bRegisterManfiestOnly)
+		if (FSteamVRInputRuntime::VRApplications() && !Build.bRegisterManifestOnly)
 		{
 			// Generate Application Manifest
+			uint32 AppProcessId = FPlatformProcess::GetCurrentProcessId();
 			FString AppKey, AppManifestPath;
 	
-			GenerateAppManifest(ManifestPath, GameFileName, AppKey, AppManifestPath);
+			GenerateAppManifest(Build.ManifestPath, GameFileName, AppKey, AppManifestPath);
+			Build.AppKey = AppKey;
 	
 			char* SteamVRAppKey = TCHAR_TO_UTF8(*AppKey);
 	
 			// Load application manifest
-			EVRApplicationError AppError = VRApplications()->AddApplicationManifest(TCHAR_TO_UTF8(*IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*AppManifestPath)), true);
-			UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Registering Application Manifest %s : %s"), *AppManifestPath, *FString(UTF8_TO_TCHAR(VRApplications()->GetApplicationsErrorNameFromEnum(AppError))));
+			EVRApplicationError AppError = FSteamVRInputRuntime::VRApplications()->AddApplicationManifest(TCHAR_TO_UTF8(*IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*AppManifestPath)), true);
+			UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Registering Application Manifest %s : %s"), *AppManifestPath, *FString(UTF8_TO_TCHAR(FSteamVRInputRuntime::VRApplications()->GetApplicationsErrorNameFromEnum(AppError))));
 	
 			// Set AppKey for this Editor Session
-			AppError = VRApplications()->IdentifyApplication(AppProcessId, SteamVRAppKey);
-			UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Editor Application [%d][%s] identified to SteamVR: %s"), AppProcessId, *AppKey, *FString(UTF8_TO_TCHAR(VRApplications()->GetApplicationsErrorNameFromEnum(AppError))));
+			AppError = FSteamVRInputRuntime::VRApplications()->IdentifyApplication(AppProcessId, SteamVRAppKey);
+			UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Editor Application [%d][%s] identified to SteamVR: %s"), AppProcessId, *AppKey, *FString(UTF8_TO_TCHAR(FSteamVRInputRuntime::VRApplications()->GetApplicationsErrorNameFromEnum(AppError))));
 		}
 #endif
 
@@ -4168,155 +5077,123 @@ void FSteamVRInputDevice::RegisterApplication(FString ManifestPath, bool bRegist
 		FString TheActionManifestPath;
 		
 		#if WITH_EDITOR
-			TheActionManifestPath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*ManifestPath);
+			TheActionManifestPath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*Build.ManifestPath);
 		#else
 			TheActionManifestPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir() / TEXT("Config") / TEXT("SteamVRBindings") / TEXT(ACTION_MANIFEST)).Replace(TEXT("/"), TEXT("\\"));
 		#endif
 		
 		UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Trying to load Action Manifest from: %s"), *TheActionManifestPath);
-		EVRInputError InputError = VRInput()->SetActionManifestPath(TCHAR_TO_UTF8(*TheActionManifestPath));
-		GetInputError(InputError, FString(TEXT("Setting Action Manifest Path Result")));
+		EVRInputError InputError = FSteamVRInputRuntime::VRInput()->SetActionManifestPath(TCHAR_TO_UTF8(*TheActionManifestPath));
+		Build.Results.Add(FSteamVRActionManifestResult(InputError, TEXT("Setting Action Manifest Path Result")));
 
 		// Set Main Action Set
-		InputError = VRInput()->GetActionSetHandle(ACTION_SET, &MainActionSet);
-		UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Main Action Set Handle: %i"), (uint64)MainActionSet);
-		GetInputError(InputError, FString(TEXT("Setting main action set")));
+		InputError = FSteamVRInputRuntime::VRInput()->GetActionSetHandle(ACTION_SET, &Build.MainActionSet);
+		UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Main Action Set Handle: %i"), (uint64)Build.MainActionSet);
+		Build.Results.Add(FSteamVRActionManifestResult(InputError, TEXT("Setting main action set")));
 
 		// Add to action set array
-		SteamVRInputActionSets.Empty();
-		SteamVRInputActionSets.Add(FSteamVRInputActionSet(0, ACTION_SET, MainActionSet));
+		Build.ActionSets.Empty();
+		Build.ActionSets.Add(FSteamVRInputActionSet(0, ACTION_SET, Build.MainActionSet));
 
-		// Populate Active Action sets that will later be used in OpenVR calls
-		for (int32 i = 0; i < SteamVRInputActionSets.Num(); i++)
+		// Add the additional action sets, these stay inactive until they are pushed
+		for (const FSteamVRInputActionSetDefinition& ActionSetDefinition : Build.ActionSetDefinitions)
 		{
-			if (i > MAX_ACTION_SETS - 1) break;	// Skip if more than allocated maximum action sets
+			VRActionSetHandle_t ActionSetHandle = k_ulInvalidActionSetHandle;
+			InputError = FSteamVRInputRuntime::VRInput()->GetActionSetHandle(TCHAR_TO_UTF8(*ActionSetDefinition.Path), &ActionSetHandle);
+			if (InputError != VRInputError_None || ActionSetHandle == k_ulInvalidActionSetHandle)
+			{
+				Build.Results.Add(FSteamVRActionManifestResult(InputError, FString::Printf(TEXT("Setting action set %s"), *ActionSetDefinition.Path)));
+				continue;
+			}
 
-			ActiveActionSets[i].nPriority = (int32_t)SteamVRInputActionSets[i].Priority;
-			ActiveActionSets[i].ulActionSet = SteamVRInputActionSets[i].Handle;
-			ActiveActionSets[i].ulRestrictedToDevice = SteamVRInputActionSets[i].RestrictedToDeviceHandle;
-			ActiveActionSets[i].ulSecondaryActionSet = SteamVRInputActionSets[i].SecondaryActionSetHandle;
+			FSteamVRInputActionSet& AdditionalActionSet = Build.ActionSets.Add_GetRef(FSteamVRInputActionSet(ActionSetDefinition.Priority, FName(*ActionSetDefinition.Path), ActionSetHandle));
+			AdditionalActionSet.bIsActive = false;
 		}
 
 		// Fill in Action handles for each registered action
-		for (auto& Action : Actions)
+		for (auto& Action : Build.Actions)
 		{
 			VRActionHandle_t Handle;
-			InputError = VRInput()->GetActionHandle(TCHAR_TO_UTF8(*Action.Path), &Handle);
+			InputError = FSteamVRInputRuntime::VRInput()->GetActionHandle(TCHAR_TO_UTF8(*Action.Path), &Handle);
 
 			if (InputError != VRInputError_None || Handle == k_ulInvalidActionHandle)
 			{
-				continue;
-			}
-
-			Action.Handle = Handle;
-
-			// Test if this is a pose
-			if (Action.Path == TEXT(ACTION_PATH_CONTROLLER_LEFT))
-			{
-				VRControllerHandleLeft = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_CONTROLLER_RIGHT))
-			{
-				VRControllerHandleRight = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_CAMERA))
-			{
-				VRTRackerCamera = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_CHEST))
-			{
-				VRTrackerChest = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_BACK_LEFT))
-			{
-				VRTrackerHandedBackL = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_BACK_RIGHT))
-			{
-				VRTrackerHandedBackR = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_FRONT_LEFT))
-			{
-				VRTrackerHandedFrontL = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_FRONT_RIGHT))
-			{
-				VRTrackerHandedFrontR = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_FRONTR_LEFT))
-			{
-				VRTrackerHandedFrontRL = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_FRONTR_RIGHT))
-			{
-				VRTrackerHandedFrontRR = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_GRIP_LEFT))
-			{
-				VRTrackerHandedGripL = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_GRIP_RIGHT))
-			{
-				VRTrackerHandedGripR = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_POSE_LEFT))
-			{
-				VRTrackerHandedPoseL = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_HANDED_POSE_RIGHT))
-			{
-				VRTrackerHandedPoseR = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_FOOT_LEFT))
-			{
-				VRTrackerFootL = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_FOOT_RIGHT))
-			{
-				VRTrackerFootR = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_SHOULDER_LEFT))
-			{
-				VRTrackerShoulderL = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_SHOULDER_RIGHT))
-			{
-				VRTrackerShoulderR = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_KEYBOARD))
-			{
-				VRTrackerKeyboard = Action.Handle;
-			}
-			else if (Action.Path == TEXT(ACTION_PATH_TRACKER_WAIST))
-			{
-				VRTrackerWaist = Action.Handle;
+				continue;
 			}
 
+			Action.Handle = Handle;
+
 			UE_LOG(LogSteamVRInputDevice, Display, TEXT("Retrieving Action Handle: %s"), *Action.Path);
-			GetInputError(InputError, FString(TEXT("Setting Action Handle Path Result")));
+			Build.Results.Add(FSteamVRActionManifestResult(InputError, TEXT("Setting Action Handle Path Result")));
+		}
+
+		// Set Skeletal Handles
+		Build.bIsSkeletalControllerLeftPresent = SetSkeletalHandle(Build, TCHAR_TO_UTF8(*FString(TEXT(ACTION_PATH_SKELETON_LEFT))), Build.SkeletalHandleLeft);
+		Build.bIsSkeletalControllerRightPresent = SetSkeletalHandle(Build, TCHAR_TO_UTF8(*FString(TEXT(ACTION_PATH_SKELETON_RIGHT))), Build.SkeletalHandleRight);
+
+		// Set haptic handles
+		InputError = FSteamVRInputRuntime::VRInput()->GetActionHandle(TCHAR_TO_UTF8(*FString(TEXT(ACTION_PATH_VIBRATE_LEFT))), &Build.VibrationLeft);
+		if (InputError != VRInputError_None || Build.VibrationLeft == k_ulInvalidActionHandle)
+		{
+			Build.VibrationLeft = k_ulInvalidActionHandle;
+		}
+
+		InputError = FSteamVRInputRuntime::VRInput()->GetActionHandle(TCHAR_TO_UTF8(*FString(TEXT(ACTION_PATH_VIBRATE_RIGHT))), &Build.VibrationRight);
+		if (InputError != VRInputError_None || Build.VibrationRight == k_ulInvalidActionHandle)
+		{
+			Build.VibrationRight = k_ulInvalidActionHandle;
 		}
+
+		Build.bIsRegistered = true;
 	}
 }
 
-bool FSteamVRInputDevice::SetSkeletalHandle(char* ActionPath, VRActionHandle_t& SkeletalHandle)
+void FSteamVRInputDevice::BuildMotionSourceHandles()
+{
+	MotionSourceHandles.Empty();
+	PoseCache.Empty();
+
+	MotionSourceHandles.Add(FName(TEXT("Left")), FSteamVRMotionSourceHandles(VRControllerHandleLeft, VRSkeletalHandleLeft));
+	MotionSourceHandles.Add(FName(TEXT("Right")), FSteamVRMotionSourceHandles(VRControllerHandleRight, VRSkeletalHandleRight));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Camera")), FSteamVRMotionSourceHandles(VRTRackerCamera));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Chest")), FSteamVRMotionSourceHandles(VRTrackerChest));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Waist")), FSteamVRMotionSourceHandles(VRTrackerWaist));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Foot_Left")), FSteamVRMotionSourceHandles(VRTrackerFootL));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Foot_Right")), FSteamVRMotionSourceHandles(VRTrackerFootR));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Shoulder_Left")), FSteamVRMotionSourceHandles(VRTrackerShoulderL));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Shoulder_Right")), FSteamVRMotionSourceHandles(VRTrackerShoulderR));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Handheld_RawPose_Left")), FSteamVRMotionSourceHandles(VRTrackerHandedPoseL));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Handheld_RawPose_Right")), FSteamVRMotionSourceHandles(VRTrackerHandedPoseR));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Handheld_Back_Left")), FSteamVRMotionSourceHandles(VRTrackerHandedBackL));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Handheld_Back_Right")), FSteamVRMotionSourceHandles(VRTrackerHandedBackR));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Handheld_Front_Left")), FSteamVRMotionSourceHandles(VRTrackerHandedFrontL));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Handheld_Front_Right")), FSteamVRMotionSourceHandles(VRTrackerHandedFrontR));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Handheld_FrontRolled_Left")), FSteamVRMotionSourceHandles(VRTrackerHandedFrontRL));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Handheld_FrontRolled_Right")), FSteamVRMotionSourceHandles(VRTrackerHandedFrontRR));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Handheld_PistolGrip_Left")), FSteamVRMotionSourceHandles(VRTrackerHandedGripL));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Handheld_PistolGrip_Right")), FSteamVRMotionSourceHandles(VRTrackerHandedGripR));
+	MotionSourceHandles.Add(FName(TEXT("Tracker_Keyboard")), FSteamVRMotionSourceHandles(VRTrackerKeyboard));
+}
+
+bool FSteamVRInputDevice::SetSkeletalHandle(FSteamVRActionManifestBuild& Build, char* ActionPath, VRActionHandle_t& SkeletalHandle)
 {
-	if (VRSystem() && VRInput())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
 		// Get Skeletal Handle
-		EVRInputError Err = VRInput()->GetActionHandle(ActionPath, &SkeletalHandle);
+		EVRInputError Err = FSteamVRInputRuntime::VRInput()->GetActionHandle(ActionPath, &SkeletalHandle);
 		if (Err != VRInputError_None || SkeletalHandle == k_ulInvalidActionHandle)
 		{
-			if (Err != LastInputError)
+			if (Err != Build.LastInputError)
 			{
-				GetInputError(Err, TEXT("Couldn't get skeletal action handle for Skeleton."));
+				Build.Results.Add(FSteamVRActionManifestResult(Err, TEXT("Couldn't get skeletal action handle for Skeleton.")));
 			}
 
-			Err = LastInputError;
+			Build.LastInputError = Err;
 			return false;
 		}
 		else
 		{
-			Err = LastInputError;
+			Build.LastInputError = Err;
 			return true;
 		}
 	}
@@ -4651,20 +5528,93 @@ void FSteamVRInputDevice::InitControllerKeys()
 #pragma endregion
 }
 
-void FSteamVRInputDevice::ProcessActionEvents(FSteamVRInputActionSet SteamVRInputActionSet)
+void FSteamVRInputDevice::RebuildActiveActionSets()
 {
-	for (auto& Action : ActionEvents)
+	ActionStateGeneration++;
+	ActiveActionSetCount = 0;
+	for (const FSteamVRInputActionSet& SteamVRInputActionSet : SteamVRInputActionSets)
+	{
+		if (!SteamVRInputActionSet.bIsActive)
+		{
+			continue;
+		}
+
+		if (ActiveActionSetCount >= MAX_ACTION_SETS) break;	// Skip if more than allocated maximum action sets
+
+		VRActiveActionSet_t& ActiveActionSet = ActiveActionSets[ActiveActionSetCount++];
+		ActiveActionSet.nPriority = (int32_t)SteamVRInputActionSet.Priority;
+		ActiveActionSet.ulActionSet = SteamVRInputActionSet.Handle;
+		ActiveActionSet.ulRestrictedToDevice = SteamVRInputActionSet.RestrictedToDeviceHandle;
+		ActiveActionSet.ulSecondaryActionSet = SteamVRInputActionSet.SecondaryActionSetHandle;
+	}
+}
+
+void FSteamVRInputDevice::PartitionActionEvents()
+{
+	for (FSteamVRInputActionSet& SteamVRInputActionSet : SteamVRInputActionSets)
+	{
+		SteamVRInputActionSet.DispatchIndices.Reset();
+	}
+
+	if (SteamVRInputActionSets.Num() == 0)
+	{
+		return;
+	}
+
+	for (int32 DispatchIndex = 0; DispatchIndex < ActionDispatchList.Num(); ++DispatchIndex)
 	{
-		if (Action.Handle == k_ulInvalidActionHandle)
+		const FSteamVRActionDispatch& Dispatch = ActionDispatchList[DispatchIndex];
+		if (Dispatch.Kind != ActionDispatch_Digital && Dispatch.Kind != ActionDispatch_Analog1D && Dispatch.Kind != ActionDispatch_Analog2D)
 		{
+			// Only digital and analog actions are processed each frame
 			continue;
 		}
 
-		if (Action.Type == EActionType::Boolean && !Action.Path.Contains(TEXT(" axis")) && !Action.Path.Contains(TEXT("_axis")))
+		// Action paths are prefixed by the name of their action set (e.g. /actions/main/in/{ActionName}), default to the first action set otherwise
+		const FString& ActionPath = ActionEvents[Dispatch.ActionIndex].Path;
+		FSteamVRInputActionSet* OwningActionSet = &SteamVRInputActionSets[0];
+		for (FSteamVRInputActionSet& SteamVRInputActionSet : SteamVRInputActionSets)
 		{
+			const FString ActionSetPrefix = SteamVRInputActionSet.Name.ToString() + TEXT("/");
+			if (ActionPath.StartsWith(ActionSetPrefix))
+			{
+				OwningActionSet = &SteamVRInputActionSet;
+				break;
+			}
+		}
+
+		OwningActionSet->DispatchIndices.Add(DispatchIndex);
+	}
+}
+
+void FSteamVRInputDevice::ProcessActionEvents(const FSteamVRInputActionSet& SteamVRInputActionSet)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SteamVRInput_ProcessActionEvents);
+	CSV_SCOPED_TIMING_STAT(SteamVRInput, ProcessActionEvents);
+
+	// SteamVR reports when each event happened relative to now, convert those to engine time with a single clock read
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	for (int32 DispatchIndex : SteamVRInputActionSet.DispatchIndices)
+	{
+		const FSteamVRActionDispatch& Dispatch = ActionDispatchList[DispatchIndex];
+		if (Dispatch.Kind == ActionDispatch_Digital)
+		{
+			// Digital actions are read between frames by the polling thread when it is running
+			if (InputPoller.IsValid())
+			{
+				continue;
+			}
+
+			FSteamVRInputAction& Action = ActionEvents[Dispatch.ActionIndex];
+
 			// Get digital data from SteamVR
 			InputDigitalActionData_t DigitalData;
-			EVRInputError ActionStateError = VRInput()->GetDigitalActionData(Action.Handle, &DigitalData, sizeof(DigitalData), k_ulInvalidInputValueHandle);
+			EVRInputError ActionStateError;
+			{
+				FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+				ActionStateError = FSteamVRInputRuntime::VRInput()->GetDigitalActionData(Dispatch.Handle, &DigitalData, sizeof(DigitalData), k_ulInvalidInputValueHandle);
+			}
 
 			if (ActionStateError != VRInputError_None)
 			{
@@ -4677,38 +5627,21 @@ void FSteamVRInputDevice::ProcessActionEvents(FSteamVRInputActionSet SteamVRInpu
 				DigitalData.bState != Action.bState
 				)
 			{
-				// Update our action to the value reported by SteamVR
-				Action.bState = DigitalData.bState;
-
-				// Update the active origin
-				Action.ActiveOrigin = DigitalData.activeOrigin;
-
-				// Sent event back to Engine
-				// Find the temporary action key
-				FKey FoundKey;
-				if (FindTemporaryActionKey(Action.Name, FoundKey))
-				{
-					// Test what we're receiving from SteamVR
-					//UE_LOG(LogTemp, Warning, TEXT("Handle %s KeyX %s Value %i"), *Action.Path, *FoundKey.GetFName().ToString(), DigitalData.bState);
-
-					if (Action.bState)
-					{
-						MessageHandler->OnControllerButtonPressed(FoundKey.GetFName(), 0, false);
-					}
-					else
-					{
-						MessageHandler->OnControllerButtonReleased(FoundKey.GetFName(), 0, false);
-					}
-				}
+				// SteamVR saw the change happen up to a frame before this event is sent
+				DispatchDigitalAction(Action, DigitalData.bState, DigitalData.activeOrigin, CurrentTime + DigitalData.fUpdateTime);
 			}
 		}
-		else if (Action.Type == EActionType::Vector1
-			|| Action.Type == EActionType::Vector2
-			|| Action.Type == EActionType::Vector3)
+		else if (Dispatch.Kind == ActionDispatch_Analog1D || Dispatch.Kind == ActionDispatch_Analog2D)
 		{
+			FSteamVRInputAction& Action = ActionEvents[Dispatch.ActionIndex];
+
 			// Get analog data from SteamVR
 			InputAnalogActionData_t AnalogData;
-			EVRInputError ActionStateError = VRInput()->GetAnalogActionData(Action.Handle, &AnalogData, sizeof(AnalogData), k_ulInvalidInputValueHandle);
+			EVRInputError ActionStateError;
+			{
+				FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+				ActionStateError = FSteamVRInputRuntime::VRInput()->GetAnalogActionData(Dispatch.Handle, &AnalogData, sizeof(AnalogData), k_ulInvalidInputValueHandle);
+			}
 
 			if (ActionStateError != VRInputError_None)
 			{
@@ -4720,30 +5653,378 @@ void FSteamVRInputDevice::ProcessActionEvents(FSteamVRInputActionSet SteamVRInpu
 				// Update the active origin
 				Action.ActiveOrigin = AnalogData.activeOrigin;
 
-				// Find the temporary action key (X)
-				FKey FoundKeyX;
-				if (FindTemporaryActionKey(Action.Name, FoundKeyX))
+				// Record when SteamVR last saw the value change, which can be up to a frame before this event is sent
+				Action.LastEventTime = CurrentTime + AnalogData.fUpdateTime;
+
+				if (FSteamVRInputTrace::IsEnabled() && (AnalogData.deltaX != 0.f || AnalogData.deltaY != 0.f || AnalogData.deltaZ != 0.f))
+				{
+					FSteamVRInputTrace::TraceAnalogAction(Dispatch.Handle, Action.Name, FVector(AnalogData.x, AnalogData.y, AnalogData.z), AnalogData.fUpdateTime);
+				}
+
+				// Send the X value on the temporary action key (X)
+				if (!Action.TemporaryKeyX.IsNone())
 				{
 					// Test what we're receiving from SteamVR
-					//UE_LOG(LogTemp, Warning, TEXT("Handle %s KeyX %s X-Value [%f]"), *Action.Path, *FoundKeyX.GetFName().ToString(), AnalogData.x);
+					//UE_LOG(LogTemp, Warning, TEXT("Handle %s KeyX %s X-Value [%f]"), *Action.Path, *Action.TemporaryKeyX.ToString(), AnalogData.x);
 
-					Action.Value.X = AnalogData.x; // ActionCount;
-					MessageHandler->OnControllerAnalog(FoundKeyX.GetFName(), 0, Action.Value.X);
+					if (ShouldSendAnalogValue(AnalogData.x, Action.Value.X, Action.AnalogDeadband))
+					{
+						Action.Value.X = AnalogData.x; // ActionCount;
+						MessageHandler->OnControllerAnalog(Action.TemporaryKeyX, 0, Action.Value.X);
+						DispatchStats.AnalogEventsSent++;
+					}
+					else
+					{
+						DispatchStats.AnalogEventsSuppressed++;
+					}
 				}
 
-				// Find the temporary action key (Y)
-				FKey FoundKeyY;
-				if (FindTemporaryActionKey(Action.Name, FoundKeyY, true))
+				// Send the Y value on the temporary action key (Y)
+				if (Dispatch.Kind == ActionDispatch_Analog2D && !Action.TemporaryKeyY.IsNone())
 				{
 					// Test what we're receiving from SteamVR
-					//UE_LOG(LogTemp, Warning, TEXT("Handle %s KeyY %s Y-Value {%f}"), *Action.Path, *FoundKeyY.GetFName().ToString(), AnalogData.y);
+					//UE_LOG(LogTemp, Warning, TEXT("Handle %s KeyY %s Y-Value {%f}"), *Action.Path, *Action.TemporaryKeyY.ToString(), AnalogData.y);
+
+					if (ShouldSendAnalogValue(AnalogData.y, Action.Value.Y, Action.AnalogDeadband))
+					{
+						Action.Value.Y = AnalogData.y;
+						MessageHandler->OnControllerAnalog(Action.TemporaryKeyY, 0, Action.Value.Y);
+						DispatchStats.AnalogEventsSent++;
+					}
+					else
+					{
+						DispatchStats.AnalogEventsSuppressed++;
+					}
+				}
+			}
+			else
+			{
+				// The action is no longer bound or its device went away, make sure the engine doesn't keep the last value
+				ZeroAnalogAction(Action, Dispatch.Kind);
+			}
+		}
+	}
+}
+
+void FSteamVRInputDevice::DispatchDigitalAction(FSteamVRInputAction& Action, bool bState, VRInputValueHandle_t ActiveOrigin, double EventTime)
+{
+	// Update our action to the value reported by SteamVR
+	Action.bState = bState;
+
+	// Update the active origin
+	Action.ActiveOrigin = ActiveOrigin;
+
+	// Record when SteamVR saw the change happen, which can be before this event is sent
+	Action.LastEventTime = EventTime;
+	if (FSteamVRInputTrace::IsEnabled())
+	{
+		FSteamVRInputTrace::TraceDigitalAction(Action.Handle, Action.Name, bState, (float)(EventTime - FPlatformTime::Seconds()));
+	}
+	if (Action.bState)
+	{
+		Action.LastPressedTime = Action.LastEventTime;
+	}
+	else
+	{
+		Action.LastReleasedTime = Action.LastEventTime;
+	}
+
+	// Sent event back to Engine on the temporary action key
+	if (!Action.TemporaryKeyX.IsNone())
+	{
+		// Test what we're receiving from SteamVR
+		//UE_LOG(LogTemp, Warning, TEXT("Handle %s KeyX %s Value %i"), *Action.Path, *Action.TemporaryKeyX.ToString(), bState);
+
+		if (Action.bState)
+		{
+			MessageHandler->OnControllerButtonPressed(Action.TemporaryKeyX, 0, false);
+		}
+		else
+		{
+			MessageHandler->OnControllerButtonReleased(Action.TemporaryKeyX, 0, false);
+		}
+	}
+}
+
+void FSteamVRInputDevice::PollDigitalActions(FSteamVRInputPoller& Poller)
+{
+	// Copy what to read under ActionStateLock, then talk to SteamVR without it so the game thread never waits on the polling thread's IPC
+	uint32 PollGeneration = 0;
+	{
+		FScopeLock ActionStateScopeLock(&ActionStateLock);
+
+		if (ActiveActionSetCount == 0 || !IsSteamVRActive() || !FSteamVRInputRuntime::VRInput())
+		{
+			return;
+		}
+
+		PollGeneration = ActionStateGeneration;
+		PolledActionSets.SetNumUninitialized(ActiveActionSetCount);
+		FMemory::Memcpy(PolledActionSets.GetData(), ActiveActionSets, sizeof(VRActiveActionSet_t) * ActiveActionSetCount);
+
+		PolledDigitalActions.Reset();
+		for (const FSteamVRInputActionSet& SteamVRInputActionSet : SteamVRInputActionSets)
+		{
+			if (!SteamVRInputActionSet.bIsActive)
+			{
+				continue;
+			}
 
-					Action.Value.Y = AnalogData.y;
-					MessageHandler->OnControllerAnalog(FoundKeyY.GetFName(), 0, Action.Value.Y);
+			for (int32 DispatchIndex : SteamVRInputActionSet.DispatchIndices)
+			{
+				const FSteamVRActionDispatch& Dispatch = ActionDispatchList[DispatchIndex];
+				if (Dispatch.Kind != ActionDispatch_Digital || !PolledDigitalStates.IsValidIndex(Dispatch.ActionIndex))
+				{
+					continue;
 				}
+
+				FSteamVRPolledDigitalAction& PolledAction = PolledDigitalActions.AddDefaulted_GetRef();
+				PolledAction.Handle = Dispatch.Handle;
+				PolledAction.ActionIndex = Dispatch.ActionIndex;
 			}
 		}
 	}
+
+	{
+		FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+		IVRInput* VRInput = FSteamVRInputRuntime::VRInput();
+		if (!VRInput || VRInput->UpdateActionState(PolledActionSets.GetData(), sizeof(VRActiveActionSet_t), PolledActionSets.Num()) != VRInputError_None)
+		{
+			return;
+		}
+	}
+
+	// SteamVR reports when each event happened relative to now, convert those to engine time with a single clock read
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	// Read one action at a time so the game and render threads can get in between
+	for (FSteamVRPolledDigitalAction& PolledAction : PolledDigitalActions)
+	{
+		FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+		IVRInput* VRInput = FSteamVRInputRuntime::VRInput();
+		PolledAction.InputError = VRInput ? VRInput->GetDigitalActionData(PolledAction.Handle, &PolledAction.DigitalData, sizeof(InputDigitalActionData_t), k_ulInvalidInputValueHandle) : VRInputError_NoData;
+	}
+
+	FScopeLock ActionStateScopeLock(&ActionStateLock);
+
+	// The action lists, active action sets or polled states changed while SteamVR was read, the next poll reads them again
+	if (PollGeneration != ActionStateGeneration)
+	{
+		return;
+	}
+
+	for (const FSteamVRPolledDigitalAction& PolledAction : PolledDigitalActions)
+	{
+		const InputDigitalActionData_t& DigitalData = PolledAction.DigitalData;
+		if (PolledAction.InputError != VRInputError_None ||
+			!DigitalData.bActive ||
+			DigitalData.bState == PolledDigitalStates[PolledAction.ActionIndex]
+			)
+		{
+			continue;
+		}
+
+		FSteamVRDigitalActionEvent DigitalActionEvent;
+		DigitalActionEvent.ActionIndex = PolledAction.ActionIndex;
+		DigitalActionEvent.bState = DigitalData.bState;
+		DigitalActionEvent.ActiveOrigin = DigitalData.activeOrigin;
+		DigitalActionEvent.Time = CurrentTime + DigitalData.fUpdateTime;
+
+		// Only remember the new state once the game thread will see it, so a transition dropped on a full queue is sent by the next poll
+		if (Poller.Enqueue(DigitalActionEvent))
+		{
+			PolledDigitalStates[PolledAction.ActionIndex] = DigitalData.bState;
+		}
+	}
+}
+
+void FSteamVRInputDevice::DrainPolledDigitalEvents()
+{
+	if (!InputPoller.IsValid())
+	{
+		return;
+	}
+
+	FSteamVRDigitalActionEvent DigitalActionEvent;
+	while (InputPoller->Dequeue(DigitalActionEvent))
+	{
+		if (ActionEvents.IsValidIndex(DigitalActionEvent.ActionIndex))
+		{
+			DispatchDigitalAction(ActionEvents[DigitalActionEvent.ActionIndex], DigitalActionEvent.bState, DigitalActionEvent.ActiveOrigin, DigitalActionEvent.Time);
+		}
+	}
+}
+
+void FSteamVRInputDevice::ResetPolledDigitalStates()
+{
+	// Nothing new can be queued while ActionStateLock is held, so the queue can be emptied from here
+	if (InputPoller.IsValid())
+	{
+		FSteamVRDigitalActionEvent DigitalActionEvent;
+		while (InputPoller->Dequeue(DigitalActionEvent))
+		{
+		}
+	}
+
+	ActionStateGeneration++;
+	PolledDigitalStates.SetNumUninitialized(ActionEvents.Num());
+	for (int32 ActionIndex = 0; ActionIndex < ActionEvents.Num(); ++ActionIndex)
+	{
+		PolledDigitalStates[ActionIndex] = ActionEvents[ActionIndex].bState;
+	}
+}
+
+void FSteamVRInputDevice::SetInputPollingRate(float PollingRate)
+{
+	if (InputPoller.IsValid())
+	{
+		if (PollingRate > 0.f && FMath::IsNearlyEqual(InputPoller->GetPollingRate(), FMath::Clamp(PollingRate, INPUT_POLLING_RATE_MIN, INPUT_POLLING_RATE_MAX)))
+		{
+			return;
+		}
+
+		// Stop polling first, then send what was already queued so no transition is lost
+		InputPoller->Shutdown();
+		DrainPolledDigitalEvents();
+		InputPoller.Reset();
+	}
+
+	if (PollingRate <= 0.f)
+	{
+		UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Digital actions are read once per frame"));
+		return;
+	}
+
+	{
+		// Start polling from the states the game thread last sent to the engine
+		FScopeLock ActionStateScopeLock(&ActionStateLock);
+		ResetPolledDigitalStates();
+	}
+
+	InputPoller = MakeUnique<FSteamVRInputPoller>(this, PollingRate);
+	UE_LOG(LogSteamVRInputDevice, Display, TEXT("[STEAMVR INPUT] Digital actions are read at %.0f Hz on a polling thread"), InputPoller->GetPollingRate());
+}
+
+float FSteamVRInputDevice::GetInputPollingRate() const
+{
+	return InputPoller.IsValid() ? InputPoller->GetPollingRate() : 0.f;
+}
+
+bool FSteamVRInputDevice::ShouldSendAnalogValue(float NewValue, float LastSentValue, float Deadband) const
+{
+	if (!bSendAnalogChangesOnly)
+	{
+		return true;
+	}
+
+	// Always let the value settle back to exactly zero, even when the last move was inside the deadband
+	return FMath::Abs(NewValue - LastSentValue) > Deadband || (NewValue == 0.f && LastSentValue != 0.f);
+}
+
+void FSteamVRInputDevice::ZeroAnalogAction(FSteamVRInputAction& Action, EActionDispatchKind DispatchKind)
+{
+	if (Action.Value.X != 0.f && !Action.TemporaryKeyX.IsNone())
+	{
+		MessageHandler->OnControllerAnalog(Action.TemporaryKeyX, 0, 0.f);
+		DispatchStats.AnalogEventsSent++;
+	}
+
+	if (DispatchKind == ActionDispatch_Analog2D && Action.Value.Y != 0.f && !Action.TemporaryKeyY.IsNone())
+	{
+		MessageHandler->OnControllerAnalog(Action.TemporaryKeyY, 0, 0.f);
+		DispatchStats.AnalogEventsSent++;
+	}
+
+	Action.Value = FVector::ZeroVector;
+}
+
+void FSteamVRInputDevice::ZeroActionSetAnalogs(const FSteamVRInputActionSet& SteamVRInputActionSet)
+{
+	for (int32 DispatchIndex : SteamVRInputActionSet.DispatchIndices)
+	{
+		const FSteamVRActionDispatch& Dispatch = ActionDispatchList[DispatchIndex];
+		if (Dispatch.Kind == ActionDispatch_Analog1D || Dispatch.Kind == ActionDispatch_Analog2D)
+		{
+			ZeroAnalogAction(ActionEvents[Dispatch.ActionIndex], Dispatch.Kind);
+		}
+	}
+}
+
+void FSteamVRInputDevice::ReleaseActionSetInputs(const FSteamVRInputActionSet& SteamVRInputActionSet)
+{
+	// Send the transitions the polling thread already queued first, so none of them presses a button again after its release
+	DrainPolledDigitalEvents();
+	ActionStateGeneration++;
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	for (int32 DispatchIndex : SteamVRInputActionSet.DispatchIndices)
+	{
+		const FSteamVRActionDispatch& Dispatch = ActionDispatchList[DispatchIndex];
+		if (Dispatch.Kind != ActionDispatch_Digital)
+		{
+			continue;
+		}
+
+		FSteamVRInputAction& Action = ActionEvents[Dispatch.ActionIndex];
+		if (Action.bState)
+		{
+			DispatchDigitalAction(Action, false, k_ulInvalidInputValueHandle, CurrentTime);
+		}
+
+		if (PolledDigitalStates.IsValidIndex(Dispatch.ActionIndex))
+		{
+			PolledDigitalStates[Dispatch.ActionIndex] = false;
+		}
+	}
+
+	ZeroActionSetAnalogs(SteamVRInputActionSet);
+}
+
+void FSteamVRInputDevice::DeactivateActionSet(FSteamVRInputActionSet& SteamVRInputActionSet)
+{
+	SteamVRInputActionSet.bIsActive = false;
+	SteamVRInputActionSet.RestrictedToDevicePath.Empty();
+	SteamVRInputActionSet.RestrictedToDeviceHandle = k_ulInvalidInputValueHandle;
+	ActionSetStack.Remove(SteamVRInputActionSet.Name);
+
+	// Actions of an inactive action set are no longer polled, so release their buttons and analog values now
+	ReleaseActionSetInputs(SteamVRInputActionSet);
+}
+
+bool FSteamVRInputDevice::GetActionEventTimes(FName ActionName, double& OutLastPressedTime, double& OutLastReleasedTime, double& OutLastEventTime) const
+{
+	for (const FSteamVRInputAction& Action : ActionEvents)
+	{
+		if (Action.Name == ActionName)
+		{
+			OutLastPressedTime = Action.LastPressedTime;
+			OutLastReleasedTime = Action.LastReleasedTime;
+			OutLastEventTime = Action.LastEventTime;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FSteamVRInputDevice::SetAnalogDeadband(FName ActionName, float Deadband)
+{
+	bool bFound = false;
+	for (FSteamVRInputAction& Action : ActionEvents)
+	{
+		if (Action.Name == ActionName)
+		{
+			Action.AnalogDeadband = FMath::Max(Deadband, 0.f);
+			bFound = true;
+		}
+	}
+
+	return bFound;
+}
+
+void FSteamVRInputDevice::ResetDispatchStats()
+{
+	DispatchStats = FSteamVRInputDispatchStats();
 }
 
 void FSteamVRInputDevice::GetInputError(EVRInputError InputError, FString InputAction)
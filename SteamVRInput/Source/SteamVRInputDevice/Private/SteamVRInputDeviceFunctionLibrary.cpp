@@ -29,6 +29,7 @@ POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "SteamVRInputDeviceFunctionLibrary.h"
+#include "SteamVRInputRuntime.h"
 
 #if STEAMVRCONTROLLER_SUPPORTED_PLATFORMS
 #include "../ThirdParty/OpenVRSDK/headers/openvr.h"
@@ -37,43 +38,78 @@ POSSIBILITY OF SUCH DAMAGE.
 using namespace vr;
 #endif // STEAMVRCONTROLLER_SUPPORTED_PLATFORMS
 
+/** Make a call into IVRInput under the lock of the input device, if there is one, so it doesn't race the device's polling thread */
+template<typename CallType>
+static auto CallVRInput(CallType Call) -> decltype(Call())
+{
+	FSteamVRInputDevice* SteamVRInputDevice = USteamVRInputDeviceFunctionLibrary::GetSteamVRInputDevice();
+	if (SteamVRInputDevice != nullptr)
+	{
+		return SteamVRInputDevice->CallInputRuntime(Call);
+	}
+
+	return Call();
+}
+
 void USteamVRInputDeviceFunctionLibrary::PlaySteamVR_HapticFeedback(ESteamVRHand Hand, float StartSecondsFromNow, float DurationSeconds, float Frequency, float Amplitude)
 {
 	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
-	if (VRSystem() && VRInput())
+	if (SteamVRInputDevice != nullptr && FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
-		if (Amplitude < 0.f)
-		{
-			Amplitude = 0.f;
-		}
-		else if (Amplitude > 1.f)
-		{
-			Amplitude = 1.f;
-		}
+		// Played through the haptic scheduler so it mixes with the other haptics of the hand and is sent with them at the end of the tick
+		TArray<FSteamVRHapticSegment> Segments;
+		Segments.Add(FSteamVRHapticSegment(DurationSeconds, Frequency, FMath::Clamp(Amplitude, 0.f, 1.f)));
+		SteamVRInputDevice->PlayHapticPattern(Hand == ESteamVRHand::VR_Left ? EControllerHand::Left : EControllerHand::Right, Segments, StartSecondsFromNow);
+	}
+}
 
-		// Setup which hand data we will get from SteamVR
-		VRActionHandle_t ActiveSkeletalHand = k_ulInvalidActionHandle;
+int32 USteamVRInputDeviceFunctionLibrary::PlaySteamVR_HapticPattern(ESteamVRHand Hand, const TArray<FSteamVRHapticPatternSegment>& Segments, float StartSecondsFromNow)
+{
+	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
+	if (SteamVRInputDevice == nullptr)
+	{
+		return INDEX_NONE;
+	}
 
-		if (Hand == ESteamVRHand::VR_Left && SteamVRInputDevice->VRVibrationLeft != k_ulInvalidActionHandle && SteamVRInputDevice->bIsSkeletalControllerLeftPresent && SteamVRInputDevice->VRSkeletalHandleLeft != k_ulInvalidActionHandle)
-		{
-			if (SteamVRInputDevice->VRVibrationLeft == k_ulInvalidActionHandle)
-			{
-				return;
-			}
+	TArray<FSteamVRHapticSegment> HapticSegments;
+	HapticSegments.Reserve(Segments.Num());
+	for (const FSteamVRHapticPatternSegment& Segment : Segments)
+	{
+		FSteamVRHapticSegment& HapticSegment = HapticSegments.AddDefaulted_GetRef();
+		HapticSegment.Duration = Segment.Duration;
+		HapticSegment.StartFrequency = Segment.StartFrequency;
+		HapticSegment.EndFrequency = Segment.EndFrequency;
+		HapticSegment.StartAmplitude = Segment.StartAmplitude;
+		HapticSegment.EndAmplitude = Segment.EndAmplitude;
+	}
 
-			ActiveSkeletalHand = SteamVRInputDevice->VRSkeletalHandleLeft;
-			VRInput()->TriggerHapticVibrationAction(SteamVRInputDevice->VRVibrationLeft, StartSecondsFromNow, DurationSeconds, Frequency, Amplitude, k_ulInvalidInputValueHandle);
-		}
-		else if (Hand == ESteamVRHand::VR_Right && SteamVRInputDevice->VRVibrationRight != k_ulInvalidActionHandle && SteamVRInputDevice->bIsSkeletalControllerRightPresent && SteamVRInputDevice->VRSkeletalHandleRight != k_ulInvalidActionHandle)
-		{
-			if (SteamVRInputDevice->VRVibrationRight == k_ulInvalidActionHandle)
-			{
-				return;
-			}
+	return SteamVRInputDevice->PlayHapticPattern(Hand == ESteamVRHand::VR_Left ? EControllerHand::Left : EControllerHand::Right, HapticSegments, StartSecondsFromNow);
+}
 
-			ActiveSkeletalHand = SteamVRInputDevice->VRSkeletalHandleRight;
-			VRInput()->TriggerHapticVibrationAction(SteamVRInputDevice->VRVibrationRight, StartSecondsFromNow, DurationSeconds, Frequency, Amplitude, k_ulInvalidInputValueHandle);
-		}
+bool USteamVRInputDeviceFunctionLibrary::StopSteamVR_HapticPattern(int32 PatternId)
+{
+	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
+	return SteamVRInputDevice != nullptr && SteamVRInputDevice->StopHapticPattern(PatternId);
+}
+
+bool USteamVRInputDeviceFunctionLibrary::PlaySteamVR_AudioHaptics(ESteamVRHand Hand, USoundWave* SoundWave, float Gain, float StartSecondsFromNow)
+{
+	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
+	return SteamVRInputDevice != nullptr && SteamVRInputDevice->PlayAudioHaptics(Hand == ESteamVRHand::VR_Left ? EControllerHand::Left : EControllerHand::Right, SoundWave, Gain, StartSecondsFromNow);
+}
+
+bool USteamVRInputDeviceFunctionLibrary::StartSteamVR_AudioHapticsStream(ESteamVRHand Hand, USoundSubmix* Submix, float Gain)
+{
+	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
+	return SteamVRInputDevice != nullptr && SteamVRInputDevice->StartAudioHapticsStream(Hand == ESteamVRHand::VR_Left ? EControllerHand::Left : EControllerHand::Right, Submix, Gain);
+}
+
+void USteamVRInputDeviceFunctionLibrary::StopSteamVR_AudioHapticsStream()
+{
+	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
+	if (SteamVRInputDevice != nullptr)
+	{
+		SteamVRInputDevice->StopAudioHapticsStream();
 	}
 }
 
@@ -391,26 +427,116 @@ void USteamVRInputDeviceFunctionLibrary::FindSteamVR_Action(FName ActionName, bo
 
 void USteamVRInputDeviceFunctionLibrary::GetSteamVR_ActionSetArray(TArray<FSteamVRActionSet>& SteamVRActionSets)
 {
-	// We only have one Action Set supported for this version of the plugin, so just return that
 	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
 	if (SteamVRInputDevice != nullptr)
 	{
+		// Main is always available, even before the application is registered with SteamVR
 		SteamVRActionSets.Add(FSteamVRActionSet(TEXT(ACTION_SET), SteamVRInputDevice->MainActionSet));
+
+		// Add the additional action sets declared in the project's game config
+		for (const FSteamVRInputActionSet& SteamVRInputActionSet : SteamVRInputDevice->SteamVRInputActionSets)
+		{
+			if (SteamVRInputActionSet.Handle != SteamVRInputDevice->MainActionSet)
+			{
+				SteamVRActionSets.Add(FSteamVRActionSet(SteamVRInputActionSet.Name.ToString(), SteamVRInputActionSet.Handle));
+			}
+		}
 	}
 }
 
+bool USteamVRInputDeviceFunctionLibrary::SetSteamVR_ActionSetActive(FName ActionSet, bool bIsActive)
+{
+	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
+	if (SteamVRInputDevice != nullptr)
+	{
+		return SteamVRInputDevice->SetActionSetActive(FName(*(TEXT(ACTION_SET_PREFIX) + ActionSet.ToString())), bIsActive);
+	}
+
+	return false;
+}
+
+bool USteamVRInputDeviceFunctionLibrary::PushSteamVR_ActionSet(FName ActionSet, FString RestrictedToDevicePath)
+{
+	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
+	if (SteamVRInputDevice != nullptr)
+	{
+		return SteamVRInputDevice->PushActionSet(FName(*(TEXT(ACTION_SET_PREFIX) + ActionSet.ToString())), RestrictedToDevicePath);
+	}
+
+	return false;
+}
+
+bool USteamVRInputDeviceFunctionLibrary::PopSteamVR_ActionSet(FName ActionSet)
+{
+	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
+	if (SteamVRInputDevice != nullptr)
+	{
+		return SteamVRInputDevice->PopActionSet(ActionSet.IsNone() ? NAME_None : FName(*(TEXT(ACTION_SET_PREFIX) + ActionSet.ToString())));
+	}
+
+	return false;
+}
+
+bool USteamVRInputDeviceFunctionLibrary::IsSteamVR_ActionSetActive(FName ActionSet)
+{
+	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
+	if (SteamVRInputDevice != nullptr)
+	{
+		return SteamVRInputDevice->IsActionSetActive(FName(*(TEXT(ACTION_SET_PREFIX) + ActionSet.ToString())));
+	}
+
+	return false;
+}
+
+bool USteamVRInputDeviceFunctionLibrary::GetSteamVR_ActionEventTimes(FName ActionName, float& SecondsSincePressed, float& SecondsSinceReleased)
+{
+	SecondsSincePressed = -1.f;
+	SecondsSinceReleased = -1.f;
+
+	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
+	double LastPressedTime, LastReleasedTime, LastEventTime;
+	if (SteamVRInputDevice == nullptr || !SteamVRInputDevice->GetActionEventTimes(ActionName, LastPressedTime, LastReleasedTime, LastEventTime))
+	{
+		return false;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (LastPressedTime > 0.0)
+	{
+		SecondsSincePressed = (float)(CurrentTime - LastPressedTime);
+	}
+	if (LastReleasedTime > 0.0)
+	{
+		SecondsSinceReleased = (float)(CurrentTime - LastReleasedTime);
+	}
+
+	return true;
+}
+
+bool USteamVRInputDeviceFunctionLibrary::SetSteamVR_InputPollingRate(float PollingRate)
+{
+	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
+	if (SteamVRInputDevice != nullptr)
+	{
+		SteamVRInputDevice->SetInputPollingRate(PollingRate);
+		return true;
+	}
+
+	return false;
+}
+
 bool USteamVRInputDeviceFunctionLibrary::GetSteamVR_OriginTrackedDeviceInfo(FSteamVRAction SteamVRAction, FSteamVRInputOriginInfo& InputOriginInfo)
 {
-	if (VRSystem() && VRInput())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
 		InputOriginInfo_t OriginInfo = {};
-		EVRInputError Err = VRInput()->GetOriginTrackedDeviceInfo(SteamVRAction.ActiveOrigin, &OriginInfo, sizeof(OriginInfo));
+		EVRInputError Err = CallVRInput([&]() { return FSteamVRInputRuntime::VRInput()->GetOriginTrackedDeviceInfo(SteamVRAction.ActiveOrigin, &OriginInfo, sizeof(OriginInfo)); });
 
 		if (Err == VRInputError_None && OriginInfo.trackedDeviceIndex != k_unTrackedDeviceIndexInvalid)
 		{
 			// Get device model information
 			char ModelBuffer[k_unMaxPropertyStringSize];
-			uint32 StringBytes = VRSystem()->GetStringTrackedDeviceProperty(OriginInfo.trackedDeviceIndex, ETrackedDeviceProperty::Prop_ModelNumber_String, ModelBuffer, sizeof(ModelBuffer));
+			uint32 StringBytes = FSteamVRInputRuntime::VRSystem()->GetStringTrackedDeviceProperty(OriginInfo.trackedDeviceIndex, ETrackedDeviceProperty::Prop_ModelNumber_String, ModelBuffer, sizeof(ModelBuffer));
 
 			// Set Input Origin Info
 			InputOriginInfo.TrackedDeviceIndex = OriginInfo.trackedDeviceIndex;
@@ -443,7 +569,7 @@ void USteamVRInputDeviceFunctionLibrary::FindSteamVR_OriginTrackedDeviceInfo(FNa
 
 void USteamVRInputDeviceFunctionLibrary::GetSteamVR_OriginLocalizedName(FSteamVRAction SteamVRAction, TArray<ESteamVRInputStringBits> LocalizedParts, FString& OriginLocalizedName)
 {
-	if (VRSystem() && VRInput())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
 		uint32 LocalizedPartsMask = 0;
 		EVRInputStringBits SteamVREquivalentInputStringBits;
@@ -477,7 +603,7 @@ void USteamVRInputDeviceFunctionLibrary::GetSteamVR_OriginLocalizedName(FSteamVR
 
 		// Retrieve Localized Name
 		char buf[k_unMaxPropertyStringSize];
-		EVRInputError Err = VRInput()->GetOriginLocalizedName(SteamVRAction.ActiveOrigin, buf, sizeof(buf), LocalizedPartsMask);
+		EVRInputError Err = CallVRInput([&]() { return FSteamVRInputRuntime::VRInput()->GetOriginLocalizedName(SteamVRAction.ActiveOrigin, buf, sizeof(buf), LocalizedPartsMask); });
 		OriginLocalizedName = *FString(UTF8_TO_TCHAR(buf));
 
 		// Provide debugging info if retrieval is unsuccessful
@@ -490,17 +616,17 @@ void USteamVRInputDeviceFunctionLibrary::GetSteamVR_OriginLocalizedName(FSteamVR
 
 void USteamVRInputDeviceFunctionLibrary::ShowSteamVR_ActionOrigin(FSteamVRAction SteamVRAction, FSteamVRActionSet SteamVRActionSet)
 {
-	if (VRSystem() && VRInput())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
 		// Show the action origin in user's hmd
-		EVRInputError Err = VRInput()->ShowActionOrigins(0, SteamVRAction.Handle);
+		EVRInputError Err = CallVRInput([&]() { return FSteamVRInputRuntime::VRInput()->ShowActionOrigins(0, SteamVRAction.Handle); });
 		FSteamVRInputOriginInfo OriginInfo;
 
 		if (GetSteamVR_OriginTrackedDeviceInfo(SteamVRAction, OriginInfo))
 		{
 			VRActiveActionSet_t ActiveActionSets[] = { 0 };
 			ActiveActionSets[0].ulActionSet = SteamVRActionSet.Handle;
-			VRInput()->ShowBindingsForActionSet(ActiveActionSets, sizeof(ActiveActionSets[0]), 1, SteamVRAction.ActiveOrigin);
+			CallVRInput([&]() { return FSteamVRInputRuntime::VRInput()->ShowBindingsForActionSet(ActiveActionSets, sizeof(ActiveActionSets[0]), 1, SteamVRAction.ActiveOrigin); });
 
 			//UE_LOG(LogTemp, Warning, TEXT("Action [%s] triggered from Device [%i][%s] at Component [%s]"), *SteamVRAction.Name.ToString(), OriginInfo.TrackedDeviceIndex, *OriginInfo.TrackedDeviceModel, *OriginInfo.RenderModelComponentName);
 		}
@@ -515,7 +641,7 @@ bool USteamVRInputDeviceFunctionLibrary::FindSteamVR_ActionOrigin(FName ActionNa
 	FSteamVRActionSet SteamVRActionSet;
 	FindSteamVR_Action(ActionName, bIsActionFound, SteamVRAction, SteamVRActionSet, ActionSet);
 
-	if (bIsActionFound && VRSystem() && VRInput())
+	if (bIsActionFound && FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
 		ShowSteamVR_ActionOrigin(SteamVRAction, SteamVRActionSet);
 		return true;
@@ -527,7 +653,7 @@ bool USteamVRInputDeviceFunctionLibrary::FindSteamVR_ActionOrigin(FName ActionNa
 
 bool USteamVRInputDeviceFunctionLibrary::GetSteamVR_HandPoseRelativeToNow(FVector& Position, FRotator& Orientation, ESteamVRHand Hand /*= ESteamVRHand::VR_Left*/, float PredictedSecondsFromNow /*= 0.f*/)
 {
-	if (VRSystem() && VRInput())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
 		FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
 		if (SteamVRInputDevice != nullptr)
@@ -536,7 +662,7 @@ bool USteamVRInputDeviceFunctionLibrary::GetSteamVR_HandPoseRelativeToNow(FVecto
 			if (HandActionHandle != k_ulInvalidActionHandle)
 			{
 				InputPoseActionData_t PoseData = { 0 };
-				EVRInputError InputError = VRInput()->GetPoseActionDataRelativeToNow(HandActionHandle, VRCompositor()->GetTrackingSpace(), PredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle);
+				EVRInputError InputError = SteamVRInputDevice->CallInputRuntime([&]() { return FSteamVRInputRuntime::VRInput()->GetPoseActionDataRelativeToNow(HandActionHandle, FSteamVRInputRuntime::VRCompositor()->GetTrackingSpace(), PredictedSecondsFromNow, &PoseData, sizeof(PoseData), k_ulInvalidInputValueHandle); });
 
 				if (InputError == VRInputError_None)
 				{
@@ -579,7 +705,7 @@ bool USteamVRInputDeviceFunctionLibrary::GetSteamVR_HandPoseRelativeToNow(FVecto
 
 float USteamVRInputDeviceFunctionLibrary::GetSteamVR_GlobalPredictedSecondsFromNow()
 {
-	if (VRSystem() && VRInput())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
 		FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
 		if (SteamVRInputDevice != nullptr)
@@ -593,7 +719,7 @@ float USteamVRInputDeviceFunctionLibrary::GetSteamVR_GlobalPredictedSecondsFromN
 
 float USteamVRInputDeviceFunctionLibrary::SetSteamVR_GlobalPredictedSecondsFromNow(float NewValue)
 {
-	if (VRSystem() && VRInput())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
 		FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
 		if (SteamVRInputDevice != nullptr)
@@ -609,7 +735,7 @@ float USteamVRInputDeviceFunctionLibrary::SetSteamVR_GlobalPredictedSecondsFromN
 void USteamVRInputDeviceFunctionLibrary::ShowAllSteamVR_ActionOrigins()
 {
 	VRActiveActionSet_t ActiveActionSets[1];
-	VRInput()->ShowBindingsForActionSet(ActiveActionSets, sizeof(ActiveActionSets[0]), 0, 0);
+	CallVRInput([&]() { return FSteamVRInputRuntime::VRInput()->ShowBindingsForActionSet(ActiveActionSets, sizeof(ActiveActionSets[0]), 0, 0); });
 }
 
 TArray<FSteamVRInputBindingInfo> USteamVRInputDeviceFunctionLibrary::GetSteamVR_InputBindingInfo(FSteamVRAction SteamVRActionHandle)
@@ -621,10 +747,10 @@ TArray<FSteamVRInputBindingInfo> USteamVRInputDeviceFunctionLibrary::GetSteamVR_
 	EVRInputError BindingInfoError = VRInputError_NoData;
 
 	// Execute OpenVR call GetActionBindingInfo if action handle is valid and VRInput is present
-	if (VRInput() && !SteamVRActionHandle.Path.IsEmpty())
+	if (FSteamVRInputRuntime::VRInput() && !SteamVRActionHandle.Path.IsEmpty())
 	{
 		// Get binding info for provided action handle in the currently active controller type
-		BindingInfoError = VRInput()->GetActionBindingInfo(SteamVRActionHandle.Handle, InputBindingInfo, sizeof(InputBindingInfo_t), MAX_BINDINGINFO_COUNT, &BindingInfoCount);
+		BindingInfoError = CallVRInput([&]() { return FSteamVRInputRuntime::VRInput()->GetActionBindingInfo(SteamVRActionHandle.Handle, InputBindingInfo, sizeof(InputBindingInfo_t), MAX_BINDINGINFO_COUNT, &BindingInfoCount); });
 
 		// Check if call is successful
 		if (BindingInfoError != VRInputError_None)
@@ -673,7 +799,7 @@ TArray<FSteamVRInputBindingInfo> USteamVRInputDeviceFunctionLibrary::GetSteamVR_
 TArray<FSteamVRInputBindingInfo> USteamVRInputDeviceFunctionLibrary::FindSteamVR_InputBindingInfo(FName ActionName, FName ActionSet /*= FName("main")*/)
 {
 	// Check for a valid OpenVR session and action name/set
-	if (VRInput() && ActionName != NAME_None && ActionSet != NAME_None)
+	if (FSteamVRInputRuntime::VRInput() && ActionName != NAME_None && ActionSet != NAME_None)
 	{
 		// Get the action handle for given action name and action set
 		bool bFindResult = false;
@@ -707,11 +833,11 @@ TArray<FSteamVRInputBindingInfo> USteamVRInputDeviceFunctionLibrary::FindSteamVR
 
 bool USteamVRInputDeviceFunctionLibrary::ResetSeatedPosition()
 {
-	if (VRSystem() && VRInput())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
-		if (VRCompositor()->GetTrackingSpace() == TrackingUniverseSeated)
+		if (FSteamVRInputRuntime::VRCompositor()->GetTrackingSpace() == TrackingUniverseSeated)
 		{
-			VRSystem()->ResetSeatedZeroPose();
+			FSteamVRInputRuntime::VRSystem()->ResetSeatedZeroPose();
 			return true;
 		}
 		else
@@ -726,9 +852,9 @@ bool USteamVRInputDeviceFunctionLibrary::ResetSeatedPosition()
 
 float USteamVRInputDeviceFunctionLibrary::GetUserIPD()
 {
-	if (VRSystem())
+	if (FSteamVRInputRuntime::VRSystem())
 	{
-		return VRSystem()->GetFloatTrackedDeviceProperty(k_unTrackedDeviceIndex_Hmd, ETrackedDeviceProperty::Prop_UserIpdMeters_Float) * 1000; // Return IPD in mm
+		return FSteamVRInputRuntime::VRSystem()->GetFloatTrackedDeviceProperty(k_unTrackedDeviceIndex_Hmd, ETrackedDeviceProperty::Prop_UserIpdMeters_Float) * 1000; // Return IPD in mm
 	}
 
 	return 0.f;
@@ -737,7 +863,7 @@ float USteamVRInputDeviceFunctionLibrary::GetUserIPD()
 void USteamVRInputDeviceFunctionLibrary::ShowBindingsUI(EHand Hand, FName ActionSet /*= FName("main")*/, bool bShowInVR /*= true*/)
 {
 	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
-	if (SteamVRInputDevice && VRSystem() && VRInput())
+	if (SteamVRInputDevice && FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
 		// Get current SteamVR Action Sets
 		FString InActionSet = TEXT("/actions/") + ActionSet.ToString();
@@ -772,11 +898,11 @@ void USteamVRInputDeviceFunctionLibrary::ShowBindingsUI(EHand Hand, FName Action
 
 		if (bActionSetFound)
 		{
-			VRInput()->OpenBindingUI(nullptr, FoundActionSet.Handle, SelectedHand, !bShowInVR);	
+			SteamVRInputDevice->CallInputRuntime([&]() { return FSteamVRInputRuntime::VRInput()->OpenBindingUI(nullptr, FoundActionSet.Handle, SelectedHand, !bShowInVR); });
 		}
 		else
 		{
-			VRInput()->OpenBindingUI(nullptr, k_ulInvalidActionSetHandle, SelectedHand, !bShowInVR);
+			SteamVRInputDevice->CallInputRuntime([&]() { return FSteamVRInputRuntime::VRInput()->OpenBindingUI(nullptr, k_ulInvalidActionSetHandle, SelectedHand, !bShowInVR); });
 		}
 	}
 }
@@ -833,95 +959,29 @@ void USteamVRInputDeviceFunctionLibrary::LaunchBindingsURL()
 
 void USteamVRInputDeviceFunctionLibrary::GetFingerCurlsAndSplays(EHand Hand, FSteamVRFingerCurls& FingerCurls, FSteamVRFingerSplays& FingerSplays, ESkeletalSummaryDataType SummaryDataType)
 {
-	FSteamVRInputDevice* SteamVRInputDevice = GetSteamVRInputDevice();
-	if (SteamVRInputDevice != nullptr && VRSystem() && VRInput())
-	{
-		// Get action state this frame
-		VRActiveActionSet_t ActiveActionSets[] = {
-			{
-				SteamVRInputDevice->MainActionSet,
-				k_ulInvalidInputValueHandle,
-				k_ulInvalidActionSetHandle
-			}
-		};
-
-		EVRInputError UpdateActionStateError = VRInput()->UpdateActionState(ActiveActionSets, sizeof(VRActiveActionSet_t), 1);
-		if (UpdateActionStateError != VRInputError_None)
-		{
-			FingerCurls = {};
-			FingerSplays = {};
-			return;
-		}
-
-		// Setup which hand data we will get from SteamVR
-		VRActionHandle_t ActiveSkeletalHand = k_ulInvalidActionHandle;
-
-		if (Hand == EHand::VR_LeftHand && SteamVRInputDevice->bIsSkeletalControllerLeftPresent && SteamVRInputDevice->VRSkeletalHandleLeft != k_ulInvalidActionHandle)
-		{
-			ActiveSkeletalHand = SteamVRInputDevice->VRSkeletalHandleLeft;
-		}
-		else if (Hand == EHand::VR_RightHand && SteamVRInputDevice->bIsSkeletalControllerRightPresent && SteamVRInputDevice->VRSkeletalHandleRight != k_ulInvalidActionHandle)
-		{
-			ActiveSkeletalHand = SteamVRInputDevice->VRSkeletalHandleRight;
-		}
-
-		if (ActiveSkeletalHand == k_ulInvalidActionHandle)
-		{
-			FingerCurls = {};
-			FingerSplays = {};
-			return;
-		}
-
-		InputSkeletalActionData_t actionData;
-		EVRInputError GetSkeletalActionDataError = VRInput()->GetSkeletalActionData(ActiveSkeletalHand, &actionData, sizeof(InputSkeletalActionData_t));
-
-		if (GetSkeletalActionDataError != VRInputError_None)
-		{
-			FingerCurls = {};
-			FingerSplays = {};
-			return;
-		}
-
-		if (actionData.bActive == false)
-		{
-			FingerCurls = {};
-			FingerSplays = {};
-			return;
-		}
-
-		// Get Skeletal Summary Data
-		VRSkeletalSummaryData_t ActiveSkeletalSummaryData;
-		if (ActiveSkeletalHand == k_ulInvalidActionHandle)
-		{
-			FingerCurls = {};
-			FingerSplays = {};
-			return;
-		}
+	GetDeviceFingerCurlsAndSplays(GetSteamVRInputDevice(), Hand, FingerCurls, FingerSplays, SummaryDataType);
+}
 
-		EVRSummaryType SteamVRSummaryType = (SummaryDataType == ESkeletalSummaryDataType::VR_SummaryType_FromDevice) ? VRSummaryType_FromDevice : VRSummaryType_FromAnimation;
-		EVRInputError GetSkeletalSummaryDataError = VRInput()->GetSkeletalSummaryData(ActiveSkeletalHand, SteamVRSummaryType, &ActiveSkeletalSummaryData);
+void USteamVRInputDeviceFunctionLibrary::GetDeviceFingerCurlsAndSplays(FSteamVRInputDevice* SteamVRInputDevice, EHand Hand, FSteamVRFingerCurls& FingerCurls, FSteamVRFingerSplays& FingerSplays, ESkeletalSummaryDataType SummaryDataType)
+{
+	// Read through the device, which holds the lock that keeps these calls from racing its polling thread
+	VRSkeletalSummaryData_t ActiveSkeletalSummaryData;
+	EVRSummaryType SteamVRSummaryType = (SummaryDataType == ESkeletalSummaryDataType::VR_SummaryType_FromDevice) ? VRSummaryType_FromDevice : VRSummaryType_FromAnimation;
+	if (SteamVRInputDevice != nullptr && (Hand == EHand::VR_LeftHand || Hand == EHand::VR_RightHand)
+		&& SteamVRInputDevice->GetSkeletalSummaryData(Hand == EHand::VR_LeftHand, SteamVRSummaryType, ActiveSkeletalSummaryData))
+	{
+		// Update curls and splay values for output
+		FingerCurls.Thumb = ActiveSkeletalSummaryData.flFingerCurl[VRFinger_Thumb];
+		FingerCurls.Index = ActiveSkeletalSummaryData.flFingerCurl[VRFinger_Index];
+		FingerCurls.Middle = ActiveSkeletalSummaryData.flFingerCurl[VRFinger_Middle];
+		FingerCurls.Ring = ActiveSkeletalSummaryData.flFingerCurl[VRFinger_Ring];
+		FingerCurls.Pinky = ActiveSkeletalSummaryData.flFingerCurl[VRFinger_Pinky];
 
-		if (GetSkeletalSummaryDataError != VRInputError_None)
-		{
-			FingerCurls = {};
-			FingerSplays = {};
-			return;
-		}
-		else if (GetSkeletalSummaryDataError == VRInputError_None)
-		{
-			// Update curls and splay values for output
-			FingerCurls.Thumb = ActiveSkeletalSummaryData.flFingerCurl[VRFinger_Thumb];
-			FingerCurls.Index = ActiveSkeletalSummaryData.flFingerCurl[VRFinger_Index];
-			FingerCurls.Middle = ActiveSkeletalSummaryData.flFingerCurl[VRFinger_Middle];
-			FingerCurls.Ring = ActiveSkeletalSummaryData.flFingerCurl[VRFinger_Ring];
-			FingerCurls.Pinky = ActiveSkeletalSummaryData.flFingerCurl[VRFinger_Pinky];
-
-			FingerSplays.Index_Middle = ActiveSkeletalSummaryData.flFingerSplay[VRFingerSplay_Index_Middle];
-			FingerSplays.Middle_Ring = ActiveSkeletalSummaryData.flFingerSplay[VRFingerSplay_Middle_Ring];
-			FingerSplays.Ring_Pinky = ActiveSkeletalSummaryData.flFingerSplay[VRFingerSplay_Ring_Pinky];
-			FingerSplays.Thumb_Index = ActiveSkeletalSummaryData.flFingerSplay[VRFingerSplay_Thumb_Index];
-			return;
-		}
+		FingerSplays.Index_Middle = ActiveSkeletalSummaryData.flFingerSplay[VRFingerSplay_Index_Middle];
+		FingerSplays.Middle_Ring = ActiveSkeletalSummaryData.flFingerSplay[VRFingerSplay_Middle_Ring];
+		FingerSplays.Ring_Pinky = ActiveSkeletalSummaryData.flFingerSplay[VRFingerSplay_Ring_Pinky];
+		FingerSplays.Thumb_Index = ActiveSkeletalSummaryData.flFingerSplay[VRFingerSplay_Thumb_Index];
+		return;
 	}
 
 	// Unable to retrieve the curls and splay values for this hand, send zeroed out values back to the user
@@ -0,0 +1,1177 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "SteamVRInputMockRuntime.h"
+#include "SteamVRInputRuntime.h"
+#include "SteamVRSkeletonDefinition.h"
+
+/** Action set and input source handles are kept apart from action handles, which are action indices plus one */
+static const uint64 MockActionSetHandleBase = 0x100000000ull;
+static const uint64 MockInputSourceHandleBase = 0x200000000ull;
+
+/** Fill in a tracked device pose from a position and orientation in OpenVR's tracking space */
+static void SetMockDevicePose(TrackedDevicePose_t& OutPose, const FVector& Position, const FQuat& Orientation, const FVector& Velocity, const FVector& AngularVelocity)
+{
+	const float X = Orientation.X, Y = Orientation.Y, Z = Orientation.Z, W = Orientation.W;
+	HmdMatrix34_t& Matrix = OutPose.mDeviceToAbsoluteTracking;
+	Matrix.m[0][0] = 1.f - 2.f * (Y * Y + Z * Z);	Matrix.m[0][1] = 2.f * (X * Y - Z * W);			Matrix.m[0][2] = 2.f * (X * Z + Y * W);			Matrix.m[0][3] = Position.X;
+	Matrix.m[1][0] = 2.f * (X * Y + Z * W);			Matrix.m[1][1] = 1.f - 2.f * (X * X + Z * Z);	Matrix.m[1][2] = 2.f * (Y * Z - X * W);			Matrix.m[1][3] = Position.Y;
+	Matrix.m[2][0] = 2.f * (X * Z - Y * W);			Matrix.m[2][1] = 2.f * (Y * Z + X * W);			Matrix.m[2][2] = 1.f - 2.f * (X * X + Y * Y);	Matrix.m[2][3] = Position.Z;
+
+	OutPose.vVelocity.v[0] = Velocity.X;
+	OutPose.vVelocity.v[1] = Velocity.Y;
+	OutPose.vVelocity.v[2] = Velocity.Z;
+	OutPose.vAngularVelocity.v[0] = AngularVelocity.X;
+	OutPose.vAngularVelocity.v[1] = AngularVelocity.Y;
+	OutPose.vAngularVelocity.v[2] = AngularVelocity.Z;
+	OutPose.eTrackingResult = TrackingResult_Running_OK;
+	OutPose.bPoseIsValid = OutPose.bDeviceIsConnected;
+}
+
+/** The fractional part of a value, for phases that stay precise however long the simulation runs */
+static double MockFrac(double Value)
+{
+	return Value - FMath::FloorToDouble(Value);
+}
+
+/** Move a tracked device pose along its velocity */
+static TrackedDevicePose_t PredictMockDevicePose(const TrackedDevicePose_t& Pose, float PredictedSeconds)
+{
+	TrackedDevicePose_t PredictedPose = Pose;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		PredictedPose.mDeviceToAbsoluteTracking.m[Axis][3] += Pose.vVelocity.v[Axis] * PredictedSeconds;
+	}
+	return PredictedPose;
+}
+
+/** Copy a string to an OpenVR output buffer, returning the size of the buffer it needs */
+static uint32 CopyMockString(const FString& String, char* OutBuffer, uint32 BufferSize)
+{
+	FTCHARToUTF8 Utf8String(*String);
+	const uint32 RequiredSize = Utf8String.Length() + 1;
+	if (OutBuffer != nullptr && BufferSize >= RequiredSize)
+	{
+		FMemory::Memcpy(OutBuffer, Utf8String.Get(), RequiredSize);
+	}
+	else if (OutBuffer != nullptr && BufferSize > 0)
+	{
+		OutBuffer[0] = '\0';
+	}
+	return RequiredSize;
+}
+
+FSteamVRMockRuntime::FSteamVRMockRuntime(const FSteamVRMockRuntimeSettings& InSettings)
+	: Settings(InSettings)
+{
+	System = MakeUnique<FSteamVRMockSystem>(*this);
+	Compositor = MakeUnique<FSteamVRMockCompositor>(*this);
+	Input = MakeUnique<FSteamVRMockInput>(*this);
+
+	// Headset and controllers first, then as many base stations and trackers as fit
+	AddDevice(TrackedDeviceClass_HMD, TrackedControllerRole_Invalid, TEXT("Mock HMD"), TEXT("MOCK-HMD"), TEXT("/user/head"));
+	AddDevice(TrackedDeviceClass_Controller, TrackedControllerRole_LeftHand, TEXT("Mock Controller"), TEXT("MOCK-CONTROLLER-LEFT"), TEXT("/user/hand/left"));
+	AddDevice(TrackedDeviceClass_Controller, TrackedControllerRole_RightHand, TEXT("Mock Controller"), TEXT("MOCK-CONTROLLER-RIGHT"), TEXT("/user/hand/right"));
+
+	Settings.TrackingReferenceCount = FMath::Clamp<int32>(Settings.TrackingReferenceCount, 0, k_unMaxTrackedDeviceCount - Devices.Num());
+	for (int32 ReferenceIndex = 0; ReferenceIndex < Settings.TrackingReferenceCount; ++ReferenceIndex)
+	{
+		AddDevice(TrackedDeviceClass_TrackingReference, TrackedControllerRole_Invalid, TEXT("Mock Base Station"), FString::Printf(TEXT("MOCK-REFERENCE-%d"), ReferenceIndex), FString());
+
+		// Base stations stay in the corners of the play space
+		FSteamVRMockDevice& Reference = Devices.Last();
+		Reference.bIsAnimated = false;
+		const float Side = (ReferenceIndex % 2 == 0) ? -1.f : 1.f;
+		SetMockDevicePose(Reference.Pose, FVector(2.f * Side, 2.2f, 2.f * Side), FQuat(FVector(0.f, 1.f, 0.f), ReferenceIndex * PI), FVector::ZeroVector, FVector::ZeroVector);
+	}
+
+	Settings.TrackerCount = FMath::Clamp<int32>(Settings.TrackerCount, 0, k_unMaxTrackedDeviceCount - Devices.Num());
+	for (int32 TrackerIndex = 0; TrackerIndex < Settings.TrackerCount; ++TrackerIndex)
+	{
+		AddDevice(TrackedDeviceClass_GenericTracker, TrackedControllerRole_OptOut, TEXT("Mock Tracker"), FString::Printf(TEXT("MOCK-TRACKER-%d"), TrackerIndex), FString::Printf(TEXT("/devices/mock/tracker_%d"), TrackerIndex));
+	}
+
+	FMemory::Memzero(FingerCurls);
+	Animate();
+}
+
+FSteamVRMockRuntime::~FSteamVRMockRuntime()
+{
+	Uninstall();
+}
+
+void FSteamVRMockRuntime::Install()
+{
+	if (bIsInstalled)
+	{
+		return;
+	}
+
+	// Another device may already serve OpenVR calls from a mock runtime or replay, it gets them back on Uninstall
+	PreviousSystem = FSteamVRInputRuntime::GetSystemOverride();
+	PreviousInput = FSteamVRInputRuntime::GetInputOverride();
+	PreviousCompositor = FSteamVRInputRuntime::GetCompositorOverride();
+	PreviousApplications = FSteamVRInputRuntime::GetApplicationsOverride();
+
+	FSteamVRInputRuntime::SetOverride(System.Get(), Input.Get(), Compositor.Get(), &Applications);
+	bIsInstalled = true;
+}
+
+void FSteamVRMockRuntime::Uninstall()
+{
+	if (bIsInstalled)
+	{
+		FSteamVRInputRuntime::SetOverride(PreviousSystem, PreviousInput, PreviousCompositor, PreviousApplications);
+		bIsInstalled = false;
+	}
+}
+
+void FSteamVRMockRuntime::Tick(float DeltaTime)
+{
+	FScopeLock MockScopeLock(&MockLock);
+	SimulationTime += Settings.FixedDeltaTime > 0.f ? Settings.FixedDeltaTime : DeltaTime;
+	if (Settings.bIsAnimated)
+	{
+		Animate();
+	}
+}
+
+void FSteamVRMockRuntime::AddDevice(ETrackedDeviceClass DeviceClass, ETrackedControllerRole ControllerRole, const TCHAR* ModelNumber, const FString& SerialNumber, const FString& InputSourcePath)
+{
+	FSteamVRMockDevice& Device = Devices.AddDefaulted_GetRef();
+	Device.DeviceClass = DeviceClass;
+	Device.ControllerRole = ControllerRole;
+	Device.ModelNumber = ModelNumber;
+	Device.SerialNumber = SerialNumber;
+	Device.InputSourcePath = InputSourcePath;
+	Device.Pose.bDeviceIsConnected = true;
+	SetMockDevicePose(Device.Pose, FVector::ZeroVector, FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+}
+
+void FSteamVRMockRuntime::Animate()
+{
+	const double Omega = 2.0 * PI * MOCK_RUNTIME_MOTION_FREQUENCY;
+	const float Phase = (float)(2.0 * PI * MockFrac(MOCK_RUNTIME_MOTION_FREQUENCY * SimulationTime));
+	const FVector UpAxis(0.f, 1.f, 0.f);
+
+	// Headset looks around, controllers circle in front of it, trackers bob on a ring around it
+	int32 TrackerIndex = 0;
+	for (FSteamVRMockDevice& Device : Devices)
+	{
+		const bool bIsTracker = Device.DeviceClass == TrackedDeviceClass_GenericTracker;
+		const float TrackerAngle = bIsTracker ? 2.f * PI * TrackerIndex++ / FMath::Max(Settings.TrackerCount, 1) : 0.f;
+		if (!Device.bIsAnimated)
+		{
+			continue;
+		}
+
+		if (Device.DeviceClass == TrackedDeviceClass_HMD)
+		{
+			const float Yaw = 0.25f * FMath::Sin(0.5f * Phase);
+			SetMockDevicePose(Device.Pose, FVector(0.f, 1.7f + 0.01f * FMath::Sin(Phase), 0.f), FQuat(UpAxis, Yaw),
+				FVector(0.f, 0.01f * Omega * FMath::Cos(Phase), 0.f), FVector(0.f, 0.125f * Omega * FMath::Cos(0.5f * Phase), 0.f));
+		}
+		else if (Device.DeviceClass == TrackedDeviceClass_Controller)
+		{
+			const float Side = Device.ControllerRole == TrackedControllerRole_LeftHand ? -1.f : 1.f;
+			const float Radius = 0.05f;
+			SetMockDevicePose(Device.Pose, FVector(0.2f * Side + Radius * FMath::Cos(Phase), 1.1f + Radius * FMath::Sin(Phase), -0.35f), FQuat::Identity,
+				FVector(-Radius * Omega * FMath::Sin(Phase), Radius * Omega * FMath::Cos(Phase), 0.f), FVector::ZeroVector);
+		}
+		else if (bIsTracker)
+		{
+			SetMockDevicePose(Device.Pose, FVector(FMath::Cos(TrackerAngle), 1.f + 0.02f * FMath::Sin(Phase + TrackerAngle), FMath::Sin(TrackerAngle)), FQuat(UpAxis, -TrackerAngle),
+				FVector(0.f, 0.02f * Omega * FMath::Cos(Phase + TrackerAngle), 0.f), FVector::ZeroVector);
+		}
+	}
+
+	// Fingers open and close, each a little behind the one before, the hands in opposition
+	for (int32 HandIndex = 0; HandIndex < 2; ++HandIndex)
+	{
+		if (bIsHandAnimated[HandIndex])
+		{
+			for (int32 FingerIndex = 0; FingerIndex < VRFinger_Count; ++FingerIndex)
+			{
+				FingerCurls[HandIndex][FingerIndex] = 0.5f + 0.5f * FMath::Sin(Phase + 0.5f * FingerIndex + PI * HandIndex);
+			}
+		}
+	}
+
+	// Actions press for part of every period and sweep their axes, each a little behind the one before
+	for (int32 ActionIndex = 0; ActionIndex < Actions.Num(); ++ActionIndex)
+	{
+		FSteamVRMockAction& Action = Actions[ActionIndex];
+		if (Action.bIsAnimated)
+		{
+			const float ActionPhase = Phase + ActionIndex;
+			Action.bPendingState = MockFrac((SimulationTime + 0.1 * ActionIndex) / MOCK_RUNTIME_PRESS_PERIOD) < MOCK_RUNTIME_PRESS_DUTY;
+			Action.PendingValue = FVector(FMath::Sin(ActionPhase), FMath::Cos(ActionPhase), 0.5f + 0.5f * FMath::Sin(ActionPhase));
+		}
+	}
+}
+
+FSteamVRMockAction& FSteamVRMockRuntime::FindOrAddAction(const FString& ActionPath)
+{
+	const FString LowerActionPath = ActionPath.ToLower();
+	if (const int32* ActionIndex = ActionIndices.Find(LowerActionPath))
+	{
+		return Actions[*ActionIndex];
+	}
+
+	FSteamVRMockAction& Action = Actions.AddDefaulted_GetRef();
+	Action.Path = LowerActionPath;
+	ActionIndices.Add(LowerActionPath, Actions.Num() - 1);
+
+	// Follow the device the path names, trackers are handed out in the order their actions are seen
+	const int32 FirstTrackerIndex = 3 + Settings.TrackingReferenceCount;
+	if (LowerActionPath.Contains(TEXT("tracker")))
+	{
+		Action.DeviceIndex = Settings.TrackerCount > 0 ? FirstTrackerIndex + (NextTrackerBinding++ % Settings.TrackerCount) : k_unTrackedDeviceIndexInvalid;
+	}
+	else if (LowerActionPath.Contains(TEXT("left")))
+	{
+		Action.DeviceIndex = 1;
+	}
+	else if (LowerActionPath.Contains(TEXT("right")))
+	{
+		Action.DeviceIndex = 2;
+	}
+	else if (LowerActionPath.Contains(TEXT("head")))
+	{
+		Action.DeviceIndex = k_unTrackedDeviceIndex_Hmd;
+	}
+
+	return Action;
+}
+
+FSteamVRMockAction* FSteamVRMockRuntime::FindAction(VRActionHandle_t ActionHandle)
+{
+	return (ActionHandle > 0 && ActionHandle <= (uint64)Actions.Num()) ? &Actions[ActionHandle - 1] : nullptr;
+}
+
+const FSteamVRMockDevice* FSteamVRMockRuntime::FindDevice(TrackedDeviceIndex_t DeviceIndex) const
+{
+	return Devices.IsValidIndex(DeviceIndex) ? &Devices[DeviceIndex] : nullptr;
+}
+
+VRInputValueHandle_t FSteamVRMockRuntime::GetDeviceInputSource(TrackedDeviceIndex_t DeviceIndex)
+{
+	const FSteamVRMockDevice* Device = FindDevice(DeviceIndex);
+	if (Device == nullptr || Device->InputSourcePath.IsEmpty())
+	{
+		return k_ulInvalidInputValueHandle;
+	}
+
+	const FString LowerSourcePath = Device->InputSourcePath.ToLower();
+	if (const VRInputValueHandle_t* SourceHandle = InputSourceHandles.Find(LowerSourcePath))
+	{
+		return *SourceHandle;
+	}
+
+	const VRInputValueHandle_t SourceHandle = MockInputSourceHandleBase + InputSourceHandles.Num() + 1;
+	InputSourceHandles.Add(LowerSourcePath, SourceHandle);
+	InputSourceDevices.Add(SourceHandle, DeviceIndex);
+	return SourceHandle;
+}
+
+int32 FSteamVRMockRuntime::GetDeviceHandIndex(TrackedDeviceIndex_t DeviceIndex) const
+{
+	const FSteamVRMockDevice* Device = FindDevice(DeviceIndex);
+	if (Device != nullptr && Device->DeviceClass == TrackedDeviceClass_Controller)
+	{
+		return Device->ControllerRole == TrackedControllerRole_LeftHand ? 0 : 1;
+	}
+	return INDEX_NONE;
+}
+
+void FSteamVRMockRuntime::BuildHandBones(int32 HandIndex, const float (&Curls)[VRFinger_Count], EVRSkeletalTransformSpace TransformSpace, VRBoneTransform_t* OutBoneTransforms)
+{
+	struct FMockFinger
+	{
+		ESteamVRBone FirstBone;
+		int32 BoneCount;
+		float Offset;
+		ESteamVRBone AuxBone;
+	};
+	static const FMockFinger Fingers[VRFinger_Count] =
+	{
+		{ ESteamVRBone_Thumb0, 4, 0.03f, ESteamVRBone_Aux_Thumb },
+		{ ESteamVRBone_IndexFinger0, 5, 0.02f, ESteamVRBone_Aux_IndexFinger },
+		{ ESteamVRBone_MiddleFinger0, 5, 0.f, ESteamVRBone_Aux_MiddleFinger },
+		{ ESteamVRBone_RingFinger0, 5, -0.02f, ESteamVRBone_Aux_RingFinger },
+		{ ESteamVRBone_PinkyFinger0, 5, -0.04f, ESteamVRBone_Aux_PinkyFinger }
+	};
+
+	// Each finger leaves the wrist at its own offset, mirrored for the right hand, and bends every joint but its tip by its curl
+	const float Mirror = HandIndex == 0 ? 1.f : -1.f;
+	FTransform LocalBones[ESteamVRBone_Count];
+	for (int32 FingerIndex = 0; FingerIndex < VRFinger_Count; ++FingerIndex)
+	{
+		const FMockFinger& Finger = Fingers[FingerIndex];
+		const FQuat JointRotation(FVector(0.f, 0.f, Mirror), -FMath::DegreesToRadians(MOCK_RUNTIME_MAX_CURL_ANGLE) * FMath::Clamp(Curls[FingerIndex], 0.f, 1.f));
+		for (int32 FingerBone = 0; FingerBone < Finger.BoneCount; ++FingerBone)
+		{
+			FTransform& LocalBone = LocalBones[Finger.FirstBone + FingerBone];
+			if (FingerBone == 0)
+			{
+				LocalBone.SetLocation(FVector(0.03f, 0.f, Finger.Offset * Mirror));
+			}
+			else
+			{
+				LocalBone.SetLocation(FVector(0.035f - 0.005f * FingerBone, 0.f, 0.f));
+				if (FingerBone < Finger.BoneCount - 1)
+				{
+					LocalBone.SetRotation(JointRotation);
+				}
+			}
+		}
+	}
+
+	FTransform ModelBones[ESteamVRBone_Count];
+	SteamVRSkeleton::CalcComponentSpaceTransforms(LocalBones, SteamVRSkeleton::GetParentIndices(), ESteamVRBone_Count, ModelBones);
+
+	// Aux bones hang off the root at the tip of their finger
+	for (const FMockFinger& Finger : Fingers)
+	{
+		LocalBones[Finger.AuxBone] = ModelBones[Finger.FirstBone + Finger.BoneCount - 1];
+		ModelBones[Finger.AuxBone] = LocalBones[Finger.AuxBone];
+	}
+
+	const FTransform* Bones = TransformSpace == VRSkeletalTransformSpace_Model ? ModelBones : LocalBones;
+	for (int32 BoneIndex = 0; BoneIndex < ESteamVRBone_Count; ++BoneIndex)
+	{
+		const FVector Location = Bones[BoneIndex].GetLocation();
+		const FQuat Rotation = Bones[BoneIndex].GetRotation();
+		VRBoneTransform_t& BoneTransform = OutBoneTransforms[BoneIndex];
+		BoneTransform.position.v[0] = Location.X;
+		BoneTransform.position.v[1] = Location.Y;
+		BoneTransform.position.v[2] = Location.Z;
+		BoneTransform.position.v[3] = 1.f;
+		BoneTransform.orientation.w = Rotation.W;
+		BoneTransform.orientation.x = Rotation.X;
+		BoneTransform.orientation.y = Rotation.Y;
+		BoneTransform.orientation.z = Rotation.Z;
+	}
+}
+
+void FSteamVRMockRuntime::SetDigitalAction(const FString& ActionPath, bool bState)
+{
+	FScopeLock MockScopeLock(&MockLock);
+	FSteamVRMockAction& Action = FindOrAddAction(ActionPath);
+	Action.bIsAnimated = false;
+	Action.bPendingState = bState;
+}
+
+void FSteamVRMockRuntime::SetAnalogAction(const FString& ActionPath, const FVector& Value)
+{
+	FScopeLock MockScopeLock(&MockLock);
+	FSteamVRMockAction& Action = FindOrAddAction(ActionPath);
+	Action.bIsAnimated = false;
+	Action.PendingValue = Value;
+}
+
+void FSteamVRMockRuntime::BindActionToDevice(const FString& ActionPath, TrackedDeviceIndex_t DeviceIndex)
+{
+	FScopeLock MockScopeLock(&MockLock);
+	FindOrAddAction(ActionPath).DeviceIndex = DeviceIndex;
+}
+
+void FSteamVRMockRuntime::SetDevicePose(TrackedDeviceIndex_t DeviceIndex, const FVector& Position, const FQuat& Orientation)
+{
+	FScopeLock MockScopeLock(&MockLock);
+	if (Devices.IsValidIndex(DeviceIndex))
+	{
+		FSteamVRMockDevice& Device = Devices[DeviceIndex];
+		Device.bIsAnimated = false;
+		SetMockDevicePose(Device.Pose, Position, Orientation, FVector::ZeroVector, FVector::ZeroVector);
+	}
+}
+
+void FSteamVRMockRuntime::SetDeviceConnected(TrackedDeviceIndex_t DeviceIndex, bool bIsConnected)
+{
+	FScopeLock MockScopeLock(&MockLock);
+	if (Devices.IsValidIndex(DeviceIndex))
+	{
+		TrackedDevicePose_t& Pose = Devices[DeviceIndex].Pose;
+		Pose.bDeviceIsConnected = bIsConnected;
+		Pose.bPoseIsValid = bIsConnected;
+		Pose.eTrackingResult = bIsConnected ? TrackingResult_Running_OK : TrackingResult_Uninitialized;
+	}
+}
+
+void FSteamVRMockRuntime::SetFingerCurls(int32 HandIndex, const float (&Curls)[VRFinger_Count])
+{
+	FScopeLock MockScopeLock(&MockLock);
+	if (HandIndex == 0 || HandIndex == 1)
+	{
+		bIsHandAnimated[HandIndex] = false;
+		FMemory::Memcpy(FingerCurls[HandIndex], Curls, sizeof(Curls));
+	}
+}
+
+int32 FSteamVRMockRuntime::GetDeviceCount() const
+{
+	FScopeLock MockScopeLock(&MockLock);
+	return Devices.Num();
+}
+
+bool FSteamVRMockRuntime::GetDevice(TrackedDeviceIndex_t DeviceIndex, FSteamVRMockDevice& OutDevice) const
+{
+	FScopeLock MockScopeLock(&MockLock);
+	const FSteamVRMockDevice* Device = FindDevice(DeviceIndex);
+	if (Device == nullptr)
+	{
+		return false;
+	}
+
+	OutDevice = *Device;
+	return true;
+}
+
+int32 FSteamVRMockRuntime::GetActionCount() const
+{
+	FScopeLock MockScopeLock(&MockLock);
+	return Actions.Num();
+}
+
+uint64 FSteamVRMockRuntime::GetUpdateActionStateCount() const
+{
+	FScopeLock MockScopeLock(&MockLock);
+	return UpdateActionStateCount;
+}
+
+uint64 FSteamVRMockRuntime::GetHapticVibrationCount() const
+{
+	FScopeLock MockScopeLock(&MockLock);
+	return HapticVibrationCount;
+}
+
+void FSteamVRMockSystem::GetDeviceToAbsoluteTrackingPose(ETrackingUniverseOrigin eOrigin, float fPredictedSecondsToPhotonsFromNow, TrackedDevicePose_t* pTrackedDevicePoseArray, uint32_t unTrackedDevicePoseArrayCount)
+{
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	for (uint32 DeviceIndex = 0; DeviceIndex < unTrackedDevicePoseArrayCount; ++DeviceIndex)
+	{
+		const FSteamVRMockDevice* Device = Runtime.FindDevice(DeviceIndex);
+		if (Device != nullptr)
+		{
+			pTrackedDevicePoseArray[DeviceIndex] = PredictMockDevicePose(Device->Pose, fPredictedSecondsToPhotonsFromNow);
+		}
+		else
+		{
+			FMemory::Memzero(pTrackedDevicePoseArray[DeviceIndex]);
+		}
+	}
+}
+
+uint32_t FSteamVRMockSystem::GetSortedTrackedDeviceIndicesOfClass(ETrackedDeviceClass eTrackedDeviceClass, TrackedDeviceIndex_t* punTrackedDeviceIndexArray, uint32_t unTrackedDeviceIndexArrayCount, TrackedDeviceIndex_t unRelativeToTrackedDeviceIndex)
+{
+	// Devices are reported in index order rather than by distance
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	uint32 DeviceCount = 0;
+	for (int32 DeviceIndex = 0; DeviceIndex < Runtime.Devices.Num(); ++DeviceIndex)
+	{
+		if (Runtime.Devices[DeviceIndex].DeviceClass == eTrackedDeviceClass)
+		{
+			if (punTrackedDeviceIndexArray != nullptr && DeviceCount < unTrackedDeviceIndexArrayCount)
+			{
+				punTrackedDeviceIndexArray[DeviceCount] = DeviceIndex;
+			}
+			++DeviceCount;
+		}
+	}
+	return DeviceCount;
+}
+
+EDeviceActivityLevel FSteamVRMockSystem::GetTrackedDeviceActivityLevel(TrackedDeviceIndex_t unDeviceId)
+{
+	return IsTrackedDeviceConnected(unDeviceId) ? k_EDeviceActivityLevel_UserInteraction : k_EDeviceActivityLevel_Unknown;
+}
+
+TrackedDeviceIndex_t FSteamVRMockSystem::GetTrackedDeviceIndexForControllerRole(ETrackedControllerRole unDeviceType)
+{
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	for (int32 DeviceIndex = 0; DeviceIndex < Runtime.Devices.Num(); ++DeviceIndex)
+	{
+		if (unDeviceType != TrackedControllerRole_Invalid && Runtime.Devices[DeviceIndex].ControllerRole == unDeviceType)
+		{
+			return DeviceIndex;
+		}
+	}
+	return k_unTrackedDeviceIndexInvalid;
+}
+
+ETrackedControllerRole FSteamVRMockSystem::GetControllerRoleForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex)
+{
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const FSteamVRMockDevice* Device = Runtime.FindDevice(unDeviceIndex);
+	return Device != nullptr ? Device->ControllerRole : TrackedControllerRole_Invalid;
+}
+
+ETrackedDeviceClass FSteamVRMockSystem::GetTrackedDeviceClass(TrackedDeviceIndex_t unDeviceIndex)
+{
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const FSteamVRMockDevice* Device = Runtime.FindDevice(unDeviceIndex);
+	return Device != nullptr ? Device->DeviceClass : TrackedDeviceClass_Invalid;
+}
+
+bool FSteamVRMockSystem::IsTrackedDeviceConnected(TrackedDeviceIndex_t unDeviceIndex)
+{
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const FSteamVRMockDevice* Device = Runtime.FindDevice(unDeviceIndex);
+	return Device != nullptr && Device->Pose.bDeviceIsConnected;
+}
+
+float FSteamVRMockSystem::GetFloatTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const FSteamVRMockDevice* Device = Runtime.FindDevice(unDeviceIndex);
+	ETrackedPropertyError PropertyError = Device != nullptr ? TrackedProp_UnknownProperty : TrackedProp_InvalidDevice;
+	float Value = 0.f;
+
+	if (Device != nullptr && Device->DeviceClass == TrackedDeviceClass_HMD && prop == Prop_UserIpdMeters_Float)
+	{
+		PropertyError = TrackedProp_Success;
+		Value = MOCK_RUNTIME_IPD;
+	}
+
+	if (pError != nullptr)
+	{
+		*pError = PropertyError;
+	}
+	return Value;
+}
+
+int32_t FSteamVRMockSystem::GetInt32TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const FSteamVRMockDevice* Device = Runtime.FindDevice(unDeviceIndex);
+	ETrackedPropertyError PropertyError = Device != nullptr ? TrackedProp_UnknownProperty : TrackedProp_InvalidDevice;
+	int32 Value = 0;
+
+	if (Device != nullptr && prop == Prop_DeviceClass_Int32)
+	{
+		PropertyError = TrackedProp_Success;
+		Value = (int32)Device->DeviceClass;
+	}
+	else if (Device != nullptr && prop == Prop_ControllerRoleHint_Int32)
+	{
+		PropertyError = TrackedProp_Success;
+		Value = (int32)Device->ControllerRole;
+	}
+
+	if (pError != nullptr)
+	{
+		*pError = PropertyError;
+	}
+	return Value;
+}
+
+uint32_t FSteamVRMockSystem::GetStringTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, char* pchValue, uint32_t unBufferSize, ETrackedPropertyError* pError)
+{
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const FSteamVRMockDevice* Device = Runtime.FindDevice(unDeviceIndex);
+	ETrackedPropertyError PropertyError = Device != nullptr ? TrackedProp_UnknownProperty : TrackedProp_InvalidDevice;
+	uint32 RequiredSize = 0;
+
+	if (Device != nullptr)
+	{
+		const FString* Value = nullptr;
+		static const FString TrackingSystemName(TEXT("mock"));
+		switch (prop)
+		{
+		case Prop_ModelNumber_String:			Value = &Device->ModelNumber; break;
+		case Prop_SerialNumber_String:			Value = &Device->SerialNumber; break;
+		case Prop_TrackingSystemName_String:	Value = &TrackingSystemName; break;
+		case Prop_ManufacturerName_String:		Value = &TrackingSystemName; break;
+		default:								break;
+		}
+
+		if (Value != nullptr)
+		{
+			RequiredSize = CopyMockString(*Value, pchValue, unBufferSize);
+			PropertyError = RequiredSize <= unBufferSize ? TrackedProp_Success : TrackedProp_BufferTooSmall;
+		}
+	}
+
+	if (RequiredSize == 0 && pchValue != nullptr && unBufferSize > 0)
+	{
+		pchValue[0] = '\0';
+	}
+	if (pError != nullptr)
+	{
+		*pError = PropertyError;
+	}
+	return RequiredSize;
+}
+
+bool FSteamVRMockSystem::IsInputAvailable()
+{
+	return true;
+}
+
+const char* FSteamVRMockSystem::GetRuntimeVersion()
+{
+	return "mock";
+}
+
+EVRCompositorError FSteamVRMockCompositor::WaitGetPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount)
+{
+	return GetLastPoses(pRenderPoseArray, unRenderPoseArrayCount, pGamePoseArray, unGamePoseArrayCount);
+}
+
+EVRCompositorError FSteamVRMockCompositor::GetLastPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount)
+{
+	if (pRenderPoseArray != nullptr)
+	{
+		Runtime.System->GetDeviceToAbsoluteTrackingPose(GetTrackingSpace(), 0.f, pRenderPoseArray, unRenderPoseArrayCount);
+	}
+	if (pGamePoseArray != nullptr)
+	{
+		Runtime.System->GetDeviceToAbsoluteTrackingPose(GetTrackingSpace(), 0.f, pGamePoseArray, unGamePoseArrayCount);
+	}
+	return VRCompositorError_None;
+}
+
+EVRCompositorError FSteamVRMockCompositor::GetLastPoseForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex, TrackedDevicePose_t* pOutputPose, TrackedDevicePose_t* pOutputGamePose)
+{
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const FSteamVRMockDevice* Device = Runtime.FindDevice(unDeviceIndex);
+	if (Device == nullptr)
+	{
+		return FSteamVRNullCompositor::GetLastPoseForTrackedDeviceIndex(unDeviceIndex, pOutputPose, pOutputGamePose);
+	}
+
+	if (pOutputPose != nullptr)
+	{
+		*pOutputPose = Device->Pose;
+	}
+	if (pOutputGamePose != nullptr)
+	{
+		*pOutputGamePose = Device->Pose;
+	}
+	return VRCompositorError_None;
+}
+
+EVRInputError FSteamVRMockInput::SetActionManifestPath(const char* pchActionManifestPath)
+{
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetActionSetHandle(const char* pchActionSetName, VRActionSetHandle_t* pHandle)
+{
+	if (pchActionSetName == nullptr || pHandle == nullptr)
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const FString LowerActionSetPath = FString(UTF8_TO_TCHAR(pchActionSetName)).ToLower();
+	VRActionSetHandle_t* ActionSetHandle = Runtime.ActionSetHandles.Find(LowerActionSetPath);
+	*pHandle = ActionSetHandle != nullptr ? *ActionSetHandle : Runtime.ActionSetHandles.Add(LowerActionSetPath, MockActionSetHandleBase + Runtime.ActionSetHandles.Num() + 1);
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetActionHandle(const char* pchActionName, VRActionHandle_t* pHandle)
+{
+	if (pchActionName == nullptr || pHandle == nullptr)
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	FSteamVRMockAction& Action = Runtime.FindOrAddAction(UTF8_TO_TCHAR(pchActionName));
+	*pHandle = Runtime.ActionIndices.FindChecked(Action.Path) + 1;
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetInputSourceHandle(const char* pchInputSourcePath, VRInputValueHandle_t* pHandle)
+{
+	if (pchInputSourcePath == nullptr || pHandle == nullptr)
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const FString LowerSourcePath = FString(UTF8_TO_TCHAR(pchInputSourcePath)).ToLower();
+
+	// Sources of simulated devices map back to them
+	for (int32 DeviceIndex = 0; DeviceIndex < Runtime.Devices.Num(); ++DeviceIndex)
+	{
+		if (Runtime.Devices[DeviceIndex].InputSourcePath.Equals(LowerSourcePath, ESearchCase::IgnoreCase))
+		{
+			*pHandle = Runtime.GetDeviceInputSource(DeviceIndex);
+			return VRInputError_None;
+		}
+	}
+
+	VRInputValueHandle_t* SourceHandle = Runtime.InputSourceHandles.Find(LowerSourcePath);
+	*pHandle = SourceHandle != nullptr ? *SourceHandle : Runtime.InputSourceHandles.Add(LowerSourcePath, MockInputSourceHandleBase + Runtime.InputSourceHandles.Num() + 1);
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::UpdateActionState(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount)
+{
+	if (unSetCount > 0 && (pSets == nullptr || unSizeOfVRSelectedActionSet_t != sizeof(VRActiveActionSet_t)))
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	// Every action updates, whichever action sets are active
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	for (FSteamVRMockAction& Action : Runtime.Actions)
+	{
+		Action.bChanged = Action.bState != Action.bPendingState;
+		Action.Delta = Action.PendingValue - Action.Value;
+		if (Action.bChanged || !Action.Delta.IsZero())
+		{
+			Action.LastChangeTime = Runtime.SimulationTime;
+		}
+		Action.bState = Action.bPendingState;
+		Action.Value = Action.PendingValue;
+	}
+
+	++Runtime.UpdateActionStateCount;
+	return unSetCount > 0 ? VRInputError_None : VRInputError_NoActiveActionSet;
+}
+
+EVRInputError FSteamVRMockInput::GetDigitalActionData(VRActionHandle_t action, InputDigitalActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	if (pActionData == nullptr || unActionDataSize != sizeof(InputDigitalActionData_t))
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	FMemory::Memzero(*pActionData);
+	FSteamVRMockAction* Action = Runtime.FindAction(action);
+	if (Action == nullptr)
+	{
+		return VRInputError_InvalidHandle;
+	}
+
+	pActionData->bActive = true;
+	pActionData->activeOrigin = Runtime.GetDeviceInputSource(Action->DeviceIndex);
+	pActionData->bState = Action->bState;
+	pActionData->bChanged = Action->bChanged;
+	pActionData->fUpdateTime = (float)(Action->LastChangeTime - Runtime.SimulationTime);
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetAnalogActionData(VRActionHandle_t action, InputAnalogActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	if (pActionData == nullptr || unActionDataSize != sizeof(InputAnalogActionData_t))
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	FMemory::Memzero(*pActionData);
+	FSteamVRMockAction* Action = Runtime.FindAction(action);
+	if (Action == nullptr)
+	{
+		return VRInputError_InvalidHandle;
+	}
+
+	pActionData->bActive = true;
+	pActionData->activeOrigin = Runtime.GetDeviceInputSource(Action->DeviceIndex);
+	pActionData->x = Action->Value.X;
+	pActionData->y = Action->Value.Y;
+	pActionData->z = Action->Value.Z;
+	pActionData->deltaX = Action->Delta.X;
+	pActionData->deltaY = Action->Delta.Y;
+	pActionData->deltaZ = Action->Delta.Z;
+	pActionData->fUpdateTime = (float)(Action->LastChangeTime - Runtime.SimulationTime);
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetPoseActionDataRelativeToNow(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, float fPredictedSecondsFromNow, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	if (pActionData == nullptr || unActionDataSize != sizeof(InputPoseActionData_t))
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	FMemory::Memzero(*pActionData);
+	FSteamVRMockAction* Action = Runtime.FindAction(action);
+	if (Action == nullptr)
+	{
+		return VRInputError_InvalidHandle;
+	}
+
+	const FSteamVRMockDevice* Device = Runtime.FindDevice(Action->DeviceIndex);
+	if (Device != nullptr)
+	{
+		pActionData->bActive = Device->Pose.bDeviceIsConnected;
+		pActionData->activeOrigin = Runtime.GetDeviceInputSource(Action->DeviceIndex);
+		pActionData->pose = PredictMockDevicePose(Device->Pose, fPredictedSecondsFromNow);
+	}
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetPoseActionDataForNextFrame(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	return GetPoseActionDataRelativeToNow(action, eOrigin, 0.f, pActionData, unActionDataSize, ulRestrictToDevice);
+}
+
+EVRInputError FSteamVRMockInput::GetSkeletalActionData(VRActionHandle_t action, InputSkeletalActionData_t* pActionData, uint32_t unActionDataSize)
+{
+	if (pActionData == nullptr || unActionDataSize != sizeof(InputSkeletalActionData_t))
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	FMemory::Memzero(*pActionData);
+	FSteamVRMockAction* Action = Runtime.FindAction(action);
+	if (Action == nullptr)
+	{
+		return VRInputError_InvalidHandle;
+	}
+
+	pActionData->bActive = Runtime.Settings.bHasSkeletalHands && Runtime.GetDeviceHandIndex(Action->DeviceIndex) != INDEX_NONE;
+	pActionData->activeOrigin = pActionData->bActive ? Runtime.GetDeviceInputSource(Action->DeviceIndex) : k_ulInvalidInputValueHandle;
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetBoneCount(VRActionHandle_t action, uint32_t* pBoneCount)
+{
+	if (pBoneCount == nullptr)
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	FSteamVRMockAction* Action = Runtime.FindAction(action);
+	*pBoneCount = 0;
+	if (Action == nullptr || !Runtime.Settings.bHasSkeletalHands || Runtime.GetDeviceHandIndex(Action->DeviceIndex) == INDEX_NONE)
+	{
+		return Action == nullptr ? VRInputError_InvalidHandle : VRInputError_InvalidSkeleton;
+	}
+
+	*pBoneCount = STEAMVR_SKELETON_BONE_COUNT;
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetBoneHierarchy(VRActionHandle_t action, BoneIndex_t* pParentIndices, uint32_t unIndexArayCount)
+{
+	uint32 BoneCount = 0;
+	EVRInputError Error = GetBoneCount(action, &BoneCount);
+	if (Error != VRInputError_None)
+	{
+		return Error;
+	}
+	if (pParentIndices == nullptr || unIndexArayCount != BoneCount)
+	{
+		return VRInputError_InvalidBoneCount;
+	}
+
+	for (uint32 BoneIndex = 0; BoneIndex < BoneCount; ++BoneIndex)
+	{
+		pParentIndices[BoneIndex] = (BoneIndex_t)SteamVRSkeleton::GetParentIndex(BoneIndex);
+	}
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetBoneName(VRActionHandle_t action, BoneIndex_t nBoneIndex, char* pchBoneName, uint32_t unNameBufferSize)
+{
+	uint32 BoneCount = 0;
+	EVRInputError Error = GetBoneCount(action, &BoneCount);
+	if (Error != VRInputError_None)
+	{
+		return Error;
+	}
+	if (nBoneIndex < 0 || (uint32)nBoneIndex >= BoneCount)
+	{
+		return VRInputError_InvalidBoneIndex;
+	}
+
+	const uint32 RequiredSize = CopyMockString(SteamVRSkeleton::GetBoneName(nBoneIndex).ToString(), pchBoneName, unNameBufferSize);
+	return RequiredSize <= unNameBufferSize ? VRInputError_None : VRInputError_BufferTooSmall;
+}
+
+EVRInputError FSteamVRMockInput::GetSkeletalReferenceTransforms(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalReferencePose eReferencePose, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	uint32 BoneCount = 0;
+	EVRInputError Error = GetBoneCount(action, &BoneCount);
+	if (Error != VRInputError_None)
+	{
+		return Error;
+	}
+	if (pTransformArray == nullptr || unTransformArrayCount != BoneCount)
+	{
+		return VRInputError_InvalidBoneCount;
+	}
+
+	const float Curl = eReferencePose == VRSkeletalReferencePose_Fist ? 1.f : (eReferencePose == VRSkeletalReferencePose_GripLimit ? 0.5f : 0.f);
+	const float Curls[VRFinger_Count] = { Curl, Curl, Curl, Curl, Curl };
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	FSteamVRMockRuntime::BuildHandBones(Runtime.GetDeviceHandIndex(Runtime.FindAction(action)->DeviceIndex), Curls, eTransformSpace, pTransformArray);
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetSkeletalTrackingLevel(VRActionHandle_t action, EVRSkeletalTrackingLevel* pSkeletalTrackingLevel)
+{
+	if (pSkeletalTrackingLevel == nullptr)
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	uint32 BoneCount = 0;
+	EVRInputError Error = GetBoneCount(action, &BoneCount);
+	*pSkeletalTrackingLevel = Error == VRInputError_None ? VRSkeletalTracking_Partial : VRSkeletalTracking_Estimated;
+	return Error;
+}
+
+EVRInputError FSteamVRMockInput::GetSkeletalBoneData(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalMotionRange eMotionRange, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	uint32 BoneCount = 0;
+	EVRInputError Error = GetBoneCount(action, &BoneCount);
+	if (Error != VRInputError_None)
+	{
+		return Error;
+	}
+	if (pTransformArray == nullptr || unTransformArrayCount != BoneCount)
+	{
+		return VRInputError_InvalidBoneCount;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const int32 HandIndex = Runtime.GetDeviceHandIndex(Runtime.FindAction(action)->DeviceIndex);
+
+	// Holding a controller keeps fingers from closing all the way
+	float Curls[VRFinger_Count];
+	for (int32 FingerIndex = 0; FingerIndex < VRFinger_Count; ++FingerIndex)
+	{
+		Curls[FingerIndex] = eMotionRange == VRSkeletalMotionRange_WithController ? FMath::Min(Runtime.FingerCurls[HandIndex][FingerIndex], 0.75f) : Runtime.FingerCurls[HandIndex][FingerIndex];
+	}
+
+	FSteamVRMockRuntime::BuildHandBones(HandIndex, Curls, eTransformSpace, pTransformArray);
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetSkeletalSummaryData(VRActionHandle_t action, EVRSummaryType eSummaryType, VRSkeletalSummaryData_t* pSkeletalSummaryData)
+{
+	if (pSkeletalSummaryData == nullptr)
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	uint32 BoneCount = 0;
+	EVRInputError Error = GetBoneCount(action, &BoneCount);
+	FMemory::Memzero(*pSkeletalSummaryData);
+	if (Error != VRInputError_None)
+	{
+		return Error;
+	}
+
+	// Fingers spread as they open
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const int32 HandIndex = Runtime.GetDeviceHandIndex(Runtime.FindAction(action)->DeviceIndex);
+	for (int32 FingerIndex = 0; FingerIndex < VRFinger_Count; ++FingerIndex)
+	{
+		pSkeletalSummaryData->flFingerCurl[FingerIndex] = Runtime.FingerCurls[HandIndex][FingerIndex];
+	}
+	for (int32 SplayIndex = 0; SplayIndex < VRFingerSplay_Count; ++SplayIndex)
+	{
+		pSkeletalSummaryData->flFingerSplay[SplayIndex] = 0.5f * (1.f - 0.5f * (Runtime.FingerCurls[HandIndex][SplayIndex] + Runtime.FingerCurls[HandIndex][SplayIndex + 1]));
+	}
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetSkeletalBoneDataCompressed(VRActionHandle_t action, EVRSkeletalMotionRange eMotionRange, void* pvCompressedData, uint32_t unCompressedSize, uint32_t* punRequiredCompressedSize)
+{
+	// Bones are sent uncompressed, in parent space
+	VRBoneTransform_t BoneTransforms[STEAMVR_SKELETON_BONE_COUNT];
+	EVRInputError Error = GetSkeletalBoneData(action, VRSkeletalTransformSpace_Parent, eMotionRange, BoneTransforms, STEAMVR_SKELETON_BONE_COUNT);
+	if (punRequiredCompressedSize != nullptr)
+	{
+		*punRequiredCompressedSize = sizeof(BoneTransforms);
+	}
+	if (Error != VRInputError_None)
+	{
+		return Error;
+	}
+	if (pvCompressedData == nullptr || unCompressedSize < sizeof(BoneTransforms))
+	{
+		return VRInputError_BufferTooSmall;
+	}
+
+	FMemory::Memcpy(pvCompressedData, BoneTransforms, sizeof(BoneTransforms));
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::DecompressSkeletalBoneData(const void* pvCompressedBuffer, uint32_t unCompressedBufferSize, EVRSkeletalTransformSpace eTransformSpace, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	if (pvCompressedBuffer == nullptr || unCompressedBufferSize != sizeof(VRBoneTransform_t) * STEAMVR_SKELETON_BONE_COUNT)
+	{
+		return VRInputError_InvalidCompressedData;
+	}
+	if (pTransformArray == nullptr || unTransformArrayCount != STEAMVR_SKELETON_BONE_COUNT)
+	{
+		return VRInputError_InvalidBoneCount;
+	}
+
+	const VRBoneTransform_t* ParentBones = (const VRBoneTransform_t*)pvCompressedBuffer;
+	if (eTransformSpace != VRSkeletalTransformSpace_Model)
+	{
+		FMemory::Memcpy(pTransformArray, ParentBones, unCompressedBufferSize);
+		return VRInputError_None;
+	}
+
+	FTransform LocalBones[STEAMVR_SKELETON_BONE_COUNT];
+	FTransform ModelBones[STEAMVR_SKELETON_BONE_COUNT];
+	for (int32 BoneIndex = 0; BoneIndex < STEAMVR_SKELETON_BONE_COUNT; ++BoneIndex)
+	{
+		const VRBoneTransform_t& Bone = ParentBones[BoneIndex];
+		LocalBones[BoneIndex] = FTransform(FQuat(Bone.orientation.x, Bone.orientation.y, Bone.orientation.z, Bone.orientation.w), FVector(Bone.position.v[0], Bone.position.v[1], Bone.position.v[2]));
+	}
+	SteamVRSkeleton::CalcComponentSpaceTransforms(LocalBones, SteamVRSkeleton::GetParentIndices(), STEAMVR_SKELETON_BONE_COUNT, ModelBones);
+
+	for (int32 BoneIndex = 0; BoneIndex < STEAMVR_SKELETON_BONE_COUNT; ++BoneIndex)
+	{
+		const FVector Location = ModelBones[BoneIndex].GetLocation();
+		const FQuat Rotation = ModelBones[BoneIndex].GetRotation();
+		pTransformArray[BoneIndex].position.v[0] = Location.X;
+		pTransformArray[BoneIndex].position.v[1] = Location.Y;
+		pTransformArray[BoneIndex].position.v[2] = Location.Z;
+		pTransformArray[BoneIndex].position.v[3] = 1.f;
+		pTransformArray[BoneIndex].orientation.w = Rotation.W;
+		pTransformArray[BoneIndex].orientation.x = Rotation.X;
+		pTransformArray[BoneIndex].orientation.y = Rotation.Y;
+		pTransformArray[BoneIndex].orientation.z = Rotation.Z;
+	}
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::TriggerHapticVibrationAction(VRActionHandle_t action, float fStartSecondsFromNow, float fDurationSeconds, float fFrequency, float fAmplitude, VRInputValueHandle_t ulRestrictToDevice)
+{
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	if (Runtime.FindAction(action) == nullptr)
+	{
+		return VRInputError_InvalidHandle;
+	}
+
+	++Runtime.HapticVibrationCount;
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t digitalActionHandle, VRInputValueHandle_t* originsOut, uint32_t originOutCount)
+{
+	if (originsOut == nullptr)
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	for (uint32 OriginIndex = 0; OriginIndex < originOutCount; ++OriginIndex)
+	{
+		originsOut[OriginIndex] = k_ulInvalidInputValueHandle;
+	}
+
+	FSteamVRMockAction* Action = Runtime.FindAction(digitalActionHandle);
+	if (Action == nullptr)
+	{
+		return VRInputError_InvalidHandle;
+	}
+
+	if (originOutCount > 0)
+	{
+		originsOut[0] = Runtime.GetDeviceInputSource(Action->DeviceIndex);
+	}
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetOriginLocalizedName(VRInputValueHandle_t origin, char* pchNameArray, uint32_t unNameArraySize, int32_t unStringSectionsToInclude)
+{
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	const TrackedDeviceIndex_t* DeviceIndex = Runtime.InputSourceDevices.Find(origin);
+	if (DeviceIndex == nullptr)
+	{
+		CopyMockString(FString(), pchNameArray, unNameArraySize);
+		return VRInputError_InvalidHandle;
+	}
+
+	const uint32 RequiredSize = CopyMockString(Runtime.Devices[*DeviceIndex].ModelNumber, pchNameArray, unNameArraySize);
+	return RequiredSize <= unNameArraySize ? VRInputError_None : VRInputError_BufferTooSmall;
+}
+
+EVRInputError FSteamVRMockInput::GetOriginTrackedDeviceInfo(VRInputValueHandle_t origin, InputOriginInfo_t* pOriginInfo, uint32_t unOriginInfoSize)
+{
+	if (pOriginInfo == nullptr || unOriginInfoSize != sizeof(InputOriginInfo_t))
+	{
+		return VRInputError_InvalidParam;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	FMemory::Memzero(*pOriginInfo);
+	const TrackedDeviceIndex_t* DeviceIndex = Runtime.InputSourceDevices.Find(origin);
+	if (DeviceIndex == nullptr)
+	{
+		pOriginInfo->trackedDeviceIndex = k_unTrackedDeviceIndexInvalid;
+		return VRInputError_InvalidHandle;
+	}
+
+	pOriginInfo->devicePath = origin;
+	pOriginInfo->trackedDeviceIndex = *DeviceIndex;
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::GetActionBindingInfo(VRActionHandle_t action, InputBindingInfo_t* pOriginInfo, uint32_t unBindingInfoSize, uint32_t unBindingInfoCount, uint32_t* punReturnedBindingInfoCount)
+{
+	// Actions are not bound to any particular input
+	if (punReturnedBindingInfoCount != nullptr)
+	{
+		*punReturnedBindingInfoCount = 0;
+	}
+
+	FScopeLock MockScopeLock(&Runtime.MockLock);
+	return Runtime.FindAction(action) != nullptr ? VRInputError_None : VRInputError_InvalidHandle;
+}
+
+EVRInputError FSteamVRMockInput::ShowActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t ulActionHandle)
+{
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRMockInput::ShowBindingsForActionSet(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount, VRInputValueHandle_t originToHighlight)
+{
+	return VRInputError_None;
+}
+
+bool FSteamVRMockInput::IsUsingLegacyInput()
+{
+	return false;
+}
+
+EVRInputError FSteamVRMockInput::OpenBindingUI(const char* pchAppKey, VRActionSetHandle_t ulActionSetHandle, VRInputValueHandle_t ulDeviceHandle, bool bShowOnDesktop)
+{
+	return VRInputError_None;
+}
@@ -0,0 +1,731 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "SteamVRInputNullRuntime.h"
+
+/** Mark tracked device poses as invalid and disconnected */
+static void ClearTrackedDevicePoses(TrackedDevicePose_t* Poses, uint32_t PoseCount)
+{
+	if (Poses != nullptr && PoseCount > 0)
+	{
+		FMemory::Memzero(Poses, sizeof(TrackedDevicePose_t) * PoseCount);
+	}
+}
+
+void FSteamVRNullSystem::GetRecommendedRenderTargetSize(uint32_t* pnWidth, uint32_t* pnHeight)
+{
+	*pnWidth = 0;
+	*pnHeight = 0;
+}
+
+HmdMatrix44_t FSteamVRNullSystem::GetProjectionMatrix(EVREye eEye, float fNearZ, float fFarZ)
+{
+	return HmdMatrix44_t();
+}
+
+void FSteamVRNullSystem::GetProjectionRaw(EVREye eEye, float* pfLeft, float* pfRight, float* pfTop, float* pfBottom)
+{
+	*pfLeft = *pfRight = *pfTop = *pfBottom = 0.f;
+}
+
+bool FSteamVRNullSystem::ComputeDistortion(EVREye eEye, float fU, float fV, DistortionCoordinates_t* pDistortionCoordinates)
+{
+	return false;
+}
+
+HmdMatrix34_t FSteamVRNullSystem::GetEyeToHeadTransform(EVREye eEye)
+{
+	return HmdMatrix34_t();
+}
+
+bool FSteamVRNullSystem::GetTimeSinceLastVsync(float* pfSecondsSinceLastVsync, uint64_t* pulFrameCounter)
+{
+	return false;
+}
+
+int32_t FSteamVRNullSystem::GetD3D9AdapterIndex()
+{
+	return -1;
+}
+
+void FSteamVRNullSystem::GetDXGIOutputInfo(int32_t* pnAdapterIndex)
+{
+	*pnAdapterIndex = -1;
+}
+
+void FSteamVRNullSystem::GetOutputDevice(uint64_t* pnDevice, ETextureType textureType, VkInstance_T* pInstance)
+{
+	*pnDevice = 0;
+}
+
+bool FSteamVRNullSystem::IsDisplayOnDesktop()
+{
+	return false;
+}
+
+bool FSteamVRNullSystem::SetDisplayVisibility(bool bIsVisibleOnDesktop)
+{
+	return false;
+}
+
+void FSteamVRNullSystem::GetDeviceToAbsoluteTrackingPose(ETrackingUniverseOrigin eOrigin, float fPredictedSecondsToPhotonsFromNow, TrackedDevicePose_t* pTrackedDevicePoseArray, uint32_t unTrackedDevicePoseArrayCount)
+{
+	ClearTrackedDevicePoses(pTrackedDevicePoseArray, unTrackedDevicePoseArrayCount);
+}
+
+void FSteamVRNullSystem::ResetSeatedZeroPose()
+{
+}
+
+HmdMatrix34_t FSteamVRNullSystem::GetSeatedZeroPoseToStandingAbsoluteTrackingPose()
+{
+	return HmdMatrix34_t();
+}
+
+HmdMatrix34_t FSteamVRNullSystem::GetRawZeroPoseToStandingAbsoluteTrackingPose()
+{
+	return HmdMatrix34_t();
+}
+
+uint32_t FSteamVRNullSystem::GetSortedTrackedDeviceIndicesOfClass(ETrackedDeviceClass eTrackedDeviceClass, TrackedDeviceIndex_t* punTrackedDeviceIndexArray, uint32_t unTrackedDeviceIndexArrayCount, TrackedDeviceIndex_t unRelativeToTrackedDeviceIndex)
+{
+	return 0;
+}
+
+EDeviceActivityLevel FSteamVRNullSystem::GetTrackedDeviceActivityLevel(TrackedDeviceIndex_t unDeviceId)
+{
+	return k_EDeviceActivityLevel_Unknown;
+}
+
+void FSteamVRNullSystem::ApplyTransform(TrackedDevicePose_t* pOutputPose, const TrackedDevicePose_t* pTrackedDevicePose, const HmdMatrix34_t* pTransform)
+{
+	ClearTrackedDevicePoses(pOutputPose, 1);
+}
+
+TrackedDeviceIndex_t FSteamVRNullSystem::GetTrackedDeviceIndexForControllerRole(ETrackedControllerRole unDeviceType)
+{
+	return k_unTrackedDeviceIndexInvalid;
+}
+
+ETrackedControllerRole FSteamVRNullSystem::GetControllerRoleForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex)
+{
+	return TrackedControllerRole_Invalid;
+}
+
+ETrackedDeviceClass FSteamVRNullSystem::GetTrackedDeviceClass(TrackedDeviceIndex_t unDeviceIndex)
+{
+	return TrackedDeviceClass_Invalid;
+}
+
+bool FSteamVRNullSystem::IsTrackedDeviceConnected(TrackedDeviceIndex_t unDeviceIndex)
+{
+	return false;
+}
+
+bool FSteamVRNullSystem::GetBoolTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	if (pError != nullptr)
+	{
+		*pError = TrackedProp_InvalidDevice;
+	}
+	return false;
+}
+
+float FSteamVRNullSystem::GetFloatTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	if (pError != nullptr)
+	{
+		*pError = TrackedProp_InvalidDevice;
+	}
+	return 0.f;
+}
+
+int32_t FSteamVRNullSystem::GetInt32TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	if (pError != nullptr)
+	{
+		*pError = TrackedProp_InvalidDevice;
+	}
+	return 0;
+}
+
+uint64_t FSteamVRNullSystem::GetUint64TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	if (pError != nullptr)
+	{
+		*pError = TrackedProp_InvalidDevice;
+	}
+	return 0;
+}
+
+HmdMatrix34_t FSteamVRNullSystem::GetMatrix34TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	if (pError != nullptr)
+	{
+		*pError = TrackedProp_InvalidDevice;
+	}
+	return HmdMatrix34_t();
+}
+
+uint32_t FSteamVRNullSystem::GetArrayTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, PropertyTypeTag_t propType, void* pBuffer, uint32_t unBufferSize, ETrackedPropertyError* pError)
+{
+	if (pError != nullptr)
+	{
+		*pError = TrackedProp_InvalidDevice;
+	}
+	return 0;
+}
+
+uint32_t FSteamVRNullSystem::GetStringTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, char* pchValue, uint32_t unBufferSize, ETrackedPropertyError* pError)
+{
+	if (pError != nullptr)
+	{
+		*pError = TrackedProp_InvalidDevice;
+	}
+	if (pchValue != nullptr && unBufferSize > 0)
+	{
+		pchValue[0] = '\0';
+	}
+	return 0;
+}
+
+const char* FSteamVRNullSystem::GetPropErrorNameFromEnum(ETrackedPropertyError error)
+{
+	return "";
+}
+
+bool FSteamVRNullSystem::PollNextEvent(VREvent_t* pEvent, uint32_t uncbVREvent)
+{
+	return false;
+}
+
+bool FSteamVRNullSystem::PollNextEventWithPose(ETrackingUniverseOrigin eOrigin, VREvent_t* pEvent, uint32_t uncbVREvent, TrackedDevicePose_t* pTrackedDevicePose)
+{
+	return false;
+}
+
+const char* FSteamVRNullSystem::GetEventTypeNameFromEnum(EVREventType eType)
+{
+	return "";
+}
+
+HiddenAreaMesh_t FSteamVRNullSystem::GetHiddenAreaMesh(EVREye eEye, EHiddenAreaMeshType type)
+{
+	return HiddenAreaMesh_t();
+}
+
+bool FSteamVRNullSystem::GetControllerState(TrackedDeviceIndex_t unControllerDeviceIndex, VRControllerState_t* pControllerState, uint32_t unControllerStateSize)
+{
+	return false;
+}
+
+bool FSteamVRNullSystem::GetControllerStateWithPose(ETrackingUniverseOrigin eOrigin, TrackedDeviceIndex_t unControllerDeviceIndex, VRControllerState_t* pControllerState, uint32_t unControllerStateSize, TrackedDevicePose_t* pTrackedDevicePose)
+{
+	return false;
+}
+
+void FSteamVRNullSystem::TriggerHapticPulse(TrackedDeviceIndex_t unControllerDeviceIndex, uint32_t unAxisId, unsigned short usDurationMicroSec)
+{
+}
+
+const char* FSteamVRNullSystem::GetButtonIdNameFromEnum(EVRButtonId eButtonId)
+{
+	return "";
+}
+
+const char* FSteamVRNullSystem::GetControllerAxisTypeNameFromEnum(EVRControllerAxisType eAxisType)
+{
+	return "";
+}
+
+bool FSteamVRNullSystem::IsInputAvailable()
+{
+	return false;
+}
+
+bool FSteamVRNullSystem::IsSteamVRDrawingControllers()
+{
+	return false;
+}
+
+bool FSteamVRNullSystem::ShouldApplicationPause()
+{
+	return false;
+}
+
+bool FSteamVRNullSystem::ShouldApplicationReduceRenderingWork()
+{
+	return false;
+}
+
+EVRFirmwareError FSteamVRNullSystem::PerformFirmwareUpdate(TrackedDeviceIndex_t unDeviceIndex)
+{
+	return VRFirmwareError_Fail;
+}
+
+void FSteamVRNullSystem::AcknowledgeQuit_Exiting()
+{
+}
+
+uint32_t FSteamVRNullSystem::GetAppContainerFilePaths(char* pchBuffer, uint32_t unBufferSize)
+{
+	if (pchBuffer != nullptr && unBufferSize > 0)
+	{
+		pchBuffer[0] = '\0';
+	}
+	return 0;
+}
+
+const char* FSteamVRNullSystem::GetRuntimeVersion()
+{
+	return "";
+}
+
+void FSteamVRNullCompositor::SetTrackingSpace(ETrackingUniverseOrigin eOrigin)
+{
+	TrackingSpace = eOrigin;
+}
+
+ETrackingUniverseOrigin FSteamVRNullCompositor::GetTrackingSpace()
+{
+	return TrackingSpace;
+}
+
+EVRCompositorError FSteamVRNullCompositor::WaitGetPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount)
+{
+	ClearTrackedDevicePoses(pRenderPoseArray, unRenderPoseArrayCount);
+	ClearTrackedDevicePoses(pGamePoseArray, unGamePoseArrayCount);
+	return VRCompositorError_RequestFailed;
+}
+
+EVRCompositorError FSteamVRNullCompositor::GetLastPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount)
+{
+	ClearTrackedDevicePoses(pRenderPoseArray, unRenderPoseArrayCount);
+	ClearTrackedDevicePoses(pGamePoseArray, unGamePoseArrayCount);
+	return VRCompositorError_RequestFailed;
+}
+
+EVRCompositorError FSteamVRNullCompositor::GetLastPoseForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex, TrackedDevicePose_t* pOutputPose, TrackedDevicePose_t* pOutputGamePose)
+{
+	ClearTrackedDevicePoses(pOutputPose, 1);
+	ClearTrackedDevicePoses(pOutputGamePose, 1);
+	return VRCompositorError_IndexOutOfRange;
+}
+
+EVRCompositorError FSteamVRNullCompositor::Submit(EVREye eEye, const Texture_t* pTexture, const VRTextureBounds_t* pBounds, EVRSubmitFlags nSubmitFlags)
+{
+	return VRCompositorError_RequestFailed;
+}
+
+void FSteamVRNullCompositor::ClearLastSubmittedFrame()
+{
+}
+
+void FSteamVRNullCompositor::PostPresentHandoff()
+{
+}
+
+bool FSteamVRNullCompositor::GetFrameTiming(Compositor_FrameTiming* pTiming, uint32_t unFramesAgo)
+{
+	return false;
+}
+
+uint32_t FSteamVRNullCompositor::GetFrameTimings(Compositor_FrameTiming* pTiming, uint32_t nFrames)
+{
+	return 0;
+}
+
+float FSteamVRNullCompositor::GetFrameTimeRemaining()
+{
+	return 0.f;
+}
+
+void FSteamVRNullCompositor::GetCumulativeStats(Compositor_CumulativeStats* pStats, uint32_t nStatsSizeInBytes)
+{
+	if (pStats != nullptr)
+	{
+		FMemory::Memzero(pStats, nStatsSizeInBytes);
+	}
+}
+
+void FSteamVRNullCompositor::FadeToColor(float fSeconds, float fRed, float fGreen, float fBlue, float fAlpha, bool bBackground)
+{
+}
+
+HmdColor_t FSteamVRNullCompositor::GetCurrentFadeColor(bool bBackground)
+{
+	return HmdColor_t();
+}
+
+void FSteamVRNullCompositor::FadeGrid(float fSeconds, bool bFadeIn)
+{
+}
+
+float FSteamVRNullCompositor::GetCurrentGridAlpha()
+{
+	return 0.f;
+}
+
+EVRCompositorError FSteamVRNullCompositor::SetSkyboxOverride(const Texture_t* pTextures, uint32_t unTextureCount)
+{
+	return VRCompositorError_RequestFailed;
+}
+
+void FSteamVRNullCompositor::ClearSkyboxOverride()
+{
+}
+
+void FSteamVRNullCompositor::CompositorBringToFront()
+{
+}
+
+void FSteamVRNullCompositor::CompositorGoToBack()
+{
+}
+
+void FSteamVRNullCompositor::CompositorQuit()
+{
+}
+
+bool FSteamVRNullCompositor::IsFullscreen()
+{
+	return false;
+}
+
+uint32_t FSteamVRNullCompositor::GetCurrentSceneFocusProcess()
+{
+	return 0;
+}
+
+uint32_t FSteamVRNullCompositor::GetLastFrameRenderer()
+{
+	return 0;
+}
+
+bool FSteamVRNullCompositor::CanRenderScene()
+{
+	return false;
+}
+
+void FSteamVRNullCompositor::ShowMirrorWindow()
+{
+}
+
+void FSteamVRNullCompositor::HideMirrorWindow()
+{
+}
+
+bool FSteamVRNullCompositor::IsMirrorWindowVisible()
+{
+	return false;
+}
+
+void FSteamVRNullCompositor::CompositorDumpImages()
+{
+}
+
+bool FSteamVRNullCompositor::ShouldAppRenderWithLowResources()
+{
+	return false;
+}
+
+void FSteamVRNullCompositor::ForceInterleavedReprojectionOn(bool bOverride)
+{
+}
+
+void FSteamVRNullCompositor::ForceReconnectProcess()
+{
+}
+
+void FSteamVRNullCompositor::SuspendRendering(bool bSuspend)
+{
+}
+
+EVRCompositorError FSteamVRNullCompositor::GetMirrorTextureD3D11(EVREye eEye, void* pD3D11DeviceOrResource, void* *ppD3D11ShaderResourceView)
+{
+	return VRCompositorError_RequestFailed;
+}
+
+void FSteamVRNullCompositor::ReleaseMirrorTextureD3D11(void* pD3D11ShaderResourceView)
+{
+}
+
+EVRCompositorError FSteamVRNullCompositor::GetMirrorTextureGL(EVREye eEye, glUInt_t* pglTextureId, glSharedTextureHandle_t* pglSharedTextureHandle)
+{
+	return VRCompositorError_RequestFailed;
+}
+
+bool FSteamVRNullCompositor::ReleaseSharedGLTexture(glUInt_t glTextureId, glSharedTextureHandle_t glSharedTextureHandle)
+{
+	return false;
+}
+
+void FSteamVRNullCompositor::LockGLSharedTextureForAccess(glSharedTextureHandle_t glSharedTextureHandle)
+{
+}
+
+void FSteamVRNullCompositor::UnlockGLSharedTextureForAccess(glSharedTextureHandle_t glSharedTextureHandle)
+{
+}
+
+uint32_t FSteamVRNullCompositor::GetVulkanInstanceExtensionsRequired(char* pchValue, uint32_t unBufferSize)
+{
+	if (pchValue != nullptr && unBufferSize > 0)
+	{
+		pchValue[0] = '\0';
+	}
+	return 0;
+}
+
+uint32_t FSteamVRNullCompositor::GetVulkanDeviceExtensionsRequired(VkPhysicalDevice_T* pPhysicalDevice, char* pchValue, uint32_t unBufferSize)
+{
+	if (pchValue != nullptr && unBufferSize > 0)
+	{
+		pchValue[0] = '\0';
+	}
+	return 0;
+}
+
+void FSteamVRNullCompositor::SetExplicitTimingMode(EVRCompositorTimingMode eTimingMode)
+{
+}
+
+EVRCompositorError FSteamVRNullCompositor::SubmitExplicitTimingData()
+{
+	return VRCompositorError_RequestFailed;
+}
+
+bool FSteamVRNullCompositor::IsMotionSmoothingEnabled()
+{
+	return false;
+}
+
+bool FSteamVRNullCompositor::IsMotionSmoothingSupported()
+{
+	return false;
+}
+
+bool FSteamVRNullCompositor::IsCurrentSceneFocusAppLoading()
+{
+	return false;
+}
+
+EVRApplicationError FSteamVRNullApplications::AddApplicationManifest(const char* pchApplicationManifestFullPath, bool bTemporary)
+{
+	return VRApplicationError_None;
+}
+
+EVRApplicationError FSteamVRNullApplications::RemoveApplicationManifest(const char* pchApplicationManifestFullPath)
+{
+	return VRApplicationError_None;
+}
+
+bool FSteamVRNullApplications::IsApplicationInstalled(const char* pchAppKey)
+{
+	return false;
+}
+
+uint32_t FSteamVRNullApplications::GetApplicationCount()
+{
+	return 0;
+}
+
+EVRApplicationError FSteamVRNullApplications::GetApplicationKeyByIndex(uint32_t unApplicationIndex, char* pchAppKeyBuffer, uint32_t unAppKeyBufferLen)
+{
+	if (pchAppKeyBuffer != nullptr && unAppKeyBufferLen > 0)
+	{
+		pchAppKeyBuffer[0] = '\0';
+	}
+	return VRApplicationError_InvalidIndex;
+}
+
+EVRApplicationError FSteamVRNullApplications::GetApplicationKeyByProcessId(uint32_t unProcessId, char* pchAppKeyBuffer, uint32_t unAppKeyBufferLen)
+{
+	if (pchAppKeyBuffer != nullptr && unAppKeyBufferLen > 0)
+	{
+		pchAppKeyBuffer[0] = '\0';
+	}
+	return VRApplicationError_UnknownApplication;
+}
+
+EVRApplicationError FSteamVRNullApplications::LaunchApplication(const char* pchAppKey)
+{
+	return VRApplicationError_UnknownApplication;
+}
+
+EVRApplicationError FSteamVRNullApplications::LaunchTemplateApplication(const char* pchTemplateAppKey, const char* pchNewAppKey, const AppOverrideKeys_t* pKeys, uint32_t unKeys)
+{
+	return VRApplicationError_UnknownApplication;
+}
+
+EVRApplicationError FSteamVRNullApplications::LaunchApplicationFromMimeType(const char* pchMimeType, const char* pchArgs)
+{
+	return VRApplicationError_UnknownApplication;
+}
+
+EVRApplicationError FSteamVRNullApplications::LaunchDashboardOverlay(const char* pchAppKey)
+{
+	return VRApplicationError_UnknownApplication;
+}
+
+bool FSteamVRNullApplications::CancelApplicationLaunch(const char* pchAppKey)
+{
+	return false;
+}
+
+EVRApplicationError FSteamVRNullApplications::IdentifyApplication(uint32_t unProcessId, const char* pchAppKey)
+{
+	return VRApplicationError_None;
+}
+
+uint32_t FSteamVRNullApplications::GetApplicationProcessId(const char* pchAppKey)
+{
+	return 0;
+}
+
+const char* FSteamVRNullApplications::GetApplicationsErrorNameFromEnum(EVRApplicationError error)
+{
+	return "";
+}
+
+uint32_t FSteamVRNullApplications::GetApplicationPropertyString(const char* pchAppKey, EVRApplicationProperty eProperty, char* pchPropertyValueBuffer, uint32_t unPropertyValueBufferLen, EVRApplicationError* peError)
+{
+	if (pchPropertyValueBuffer != nullptr && unPropertyValueBufferLen > 0)
+	{
+		pchPropertyValueBuffer[0] = '\0';
+	}
+	if (peError != nullptr)
+	{
+		*peError = VRApplicationError_UnknownApplication;
+	}
+	return 0;
+}
+
+bool FSteamVRNullApplications::GetApplicationPropertyBool(const char* pchAppKey, EVRApplicationProperty eProperty, EVRApplicationError* peError)
+{
+	if (peError != nullptr)
+	{
+		*peError = VRApplicationError_UnknownApplication;
+	}
+	return false;
+}
+
+uint64_t FSteamVRNullApplications::GetApplicationPropertyUint64(const char* pchAppKey, EVRApplicationProperty eProperty, EVRApplicationError* peError)
+{
+	if (peError != nullptr)
+	{
+		*peError = VRApplicationError_UnknownApplication;
+	}
+	return 0;
+}
+
+EVRApplicationError FSteamVRNullApplications::SetApplicationAutoLaunch(const char* pchAppKey, bool bAutoLaunch)
+{
+	return VRApplicationError_UnknownApplication;
+}
+
+bool FSteamVRNullApplications::GetApplicationAutoLaunch(const char* pchAppKey)
+{
+	return false;
+}
+
+EVRApplicationError FSteamVRNullApplications::SetDefaultApplicationForMimeType(const char* pchAppKey, const char* pchMimeType)
+{
+	return VRApplicationError_UnknownApplication;
+}
+
+bool FSteamVRNullApplications::GetDefaultApplicationForMimeType(const char* pchMimeType, char* pchAppKeyBuffer, uint32_t unAppKeyBufferLen)
+{
+	if (pchAppKeyBuffer != nullptr && unAppKeyBufferLen > 0)
+	{
+		pchAppKeyBuffer[0] = '\0';
+	}
+	return false;
+}
+
+bool FSteamVRNullApplications::GetApplicationSupportedMimeTypes(const char* pchAppKey, char* pchMimeTypesBuffer, uint32_t unMimeTypesBuffer)
+{
+	if (pchMimeTypesBuffer != nullptr && unMimeTypesBuffer > 0)
+	{
+		pchMimeTypesBuffer[0] = '\0';
+	}
+	return false;
+}
+
+uint32_t FSteamVRNullApplications::GetApplicationsThatSupportMimeType(const char* pchMimeType, char* pchAppKeysThatSupportBuffer, uint32_t unAppKeysThatSupportBuffer)
+{
+	if (pchAppKeysThatSupportBuffer != nullptr && unAppKeysThatSupportBuffer > 0)
+	{
+		pchAppKeysThatSupportBuffer[0] = '\0';
+	}
+	return 0;
+}
+
+uint32_t FSteamVRNullApplications::GetApplicationLaunchArguments(uint32_t unHandle, char* pchArgs, uint32_t unArgs)
+{
+	if (pchArgs != nullptr && unArgs > 0)
+	{
+		pchArgs[0] = '\0';
+	}
+	return 0;
+}
+
+EVRApplicationError FSteamVRNullApplications::GetStartingApplication(char* pchAppKeyBuffer, uint32_t unAppKeyBufferLen)
+{
+	if (pchAppKeyBuffer != nullptr && unAppKeyBufferLen > 0)
+	{
+		pchAppKeyBuffer[0] = '\0';
+	}
+	return VRApplicationError_NoApplication;
+}
+
+EVRSceneApplicationState FSteamVRNullApplications::GetSceneApplicationState()
+{
+	return EVRSceneApplicationState_None;
+}
+
+EVRApplicationError FSteamVRNullApplications::PerformApplicationPrelaunchCheck(const char* pchAppKey)
+{
+	return VRApplicationError_UnknownApplication;
+}
+
+const char* FSteamVRNullApplications::GetSceneApplicationStateNameFromEnum(EVRSceneApplicationState state)
+{
+	return "";
+}
+
+EVRApplicationError FSteamVRNullApplications::LaunchInternalProcess(const char* pchBinaryPath, const char* pchArguments, const char* pchWorkingDirectory)
+{
+	return VRApplicationError_UnknownApplication;
+}
+
+uint32_t FSteamVRNullApplications::GetCurrentSceneProcessId()
+{
+	return 0;
+}
@@ -0,0 +1,100 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "SteamVRInputPoller.h"
+#include "SteamVRInputDevice.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+FSteamVRInputPoller::FSteamVRInputPoller(FSteamVRInputDevice* InDevice, float InPollingRate)
+	: Device(InDevice)
+	, PollingRate(FMath::Clamp(InPollingRate, INPUT_POLLING_RATE_MIN, INPUT_POLLING_RATE_MAX))
+	, EventQueue(INPUT_POLLING_QUEUE_SIZE)
+{
+	Thread = FRunnableThread::Create(this, TEXT("SteamVRInputPoller"), 0, TPri_AboveNormal);
+}
+
+FSteamVRInputPoller::~FSteamVRInputPoller()
+{
+	Shutdown();
+}
+
+uint32 FSteamVRInputPoller::Run()
+{
+	const double PollingInterval = 1.0 / PollingRate;
+
+	while (!bStopping)
+	{
+		const double PollStartTime = FPlatformTime::Seconds();
+
+		Device->PollDigitalActions(*this);
+
+		// Sleep for what is left of this polling interval
+		const double RemainingTime = PollingInterval - (FPlatformTime::Seconds() - PollStartTime);
+		if (RemainingTime > 0.0)
+		{
+			FPlatformProcess::SleepNoStats((float)RemainingTime);
+		}
+	}
+
+	return 0;
+}
+
+void FSteamVRInputPoller::Stop()
+{
+	bStopping = true;
+}
+
+void FSteamVRInputPoller::Shutdown()
+{
+	if (Thread != nullptr)
+	{
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+}
+
+bool FSteamVRInputPoller::Enqueue(const FSteamVRDigitalActionEvent& Event)
+{
+	if (!EventQueue.Enqueue(Event))
+	{
+		DroppedEventCount.Increment();
+		return false;
+	}
+
+	return true;
+}
+
+bool FSteamVRInputPoller::Dequeue(FSteamVRDigitalActionEvent& OutEvent)
+{
+	return EventQueue.Dequeue(OutEvent);
+}
@@ -0,0 +1,756 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "SteamVRInputReplay.h"
+#include "SteamVRInputRuntime.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+/** Key calls made with a path or buffer by its content */
+static uint64 HashInputBuffer(const void* Buffer, uint32 BufferSize)
+{
+	return Buffer != nullptr ? CityHash64((const char*)Buffer, BufferSize) : 0;
+}
+
+static uint64 HashInputPath(const char* Path)
+{
+	return Path != nullptr ? HashInputBuffer(Path, FCStringAnsi::Strlen(Path)) : 0;
+}
+
+/** Key pose reads by tracking space (low 8 bits) and prediction time in whole microseconds (24 bits, up to 8 seconds either way) */
+static uint32 PackPoseVariant(ETrackingUniverseOrigin Origin, float PredictedSecondsFromNow)
+{
+	const int32 PredictedMicroseconds = FMath::Clamp(FMath::RoundToInt(PredictedSecondsFromNow * 1000000.f), -(1 << 23), (1 << 23) - 1);
+	return ((uint32)Origin & 0xFF) | (((uint32)PredictedMicroseconds & 0xFFFFFF) << 8);
+}
+
+/** How many bytes of a string buffer hold the string, including its terminator */
+static uint32 GetInputStringSize(const char* String, uint32 BufferSize)
+{
+	return (String != nullptr && BufferSize > 0) ? FMath::Min<uint32>(FCStringAnsi::Strlen(String) + 1, BufferSize) : 0;
+}
+
+bool FSteamVRInputRecording::SaveToFile(const FString& FilePath) const
+{
+	TArray<uint8> FileData;
+	FMemoryWriter Writer(FileData);
+
+	uint32 Magic = INPUT_RECORDING_MAGIC;
+	int32 Version = INPUT_RECORDING_VERSION;
+	Writer << Magic << Version;
+	Writer << const_cast<TArray<TArray<FSteamVRInputRecord>>&>(Frames);
+
+	return !Writer.IsError() && FFileHelper::SaveArrayToFile(FileData, *FilePath);
+}
+
+bool FSteamVRInputRecording::LoadFromFile(const FString& FilePath)
+{
+	Frames.Reset();
+
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(FileData);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic << Version;
+	if (Reader.IsError() || Magic != INPUT_RECORDING_MAGIC || Version != INPUT_RECORDING_VERSION)
+	{
+		return false;
+	}
+
+	Reader << Frames;
+	if (Reader.IsError())
+	{
+		Frames.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+FSteamVRInputRecorder::FSteamVRInputRecorder(IVRInput* InSourceInput)
+	: SourceInput(InSourceInput)
+{
+	// Frame 0 holds what is read until the first frame starts
+	RecordTrackingSpace();
+}
+
+void FSteamVRInputRecorder::BeginFrame()
+{
+	{
+		FScopeLock RecordScopeLock(&RecordLock);
+		CommitFrame();
+	}
+
+	RecordTrackingSpace();
+}
+
+void FSteamVRInputRecorder::RecordTrackingSpace()
+{
+	// The tracking space all poses of the frame are read in
+	if (IVRCompositor* Compositor = FSteamVRInputRuntime::VRCompositor())
+	{
+		const int32 TrackingSpace = (int32)Compositor->GetTrackingSpace();
+		Record(InputRecord_TrackingSpace, 0, 0, 0, VRInputError_None, &TrackingSpace, sizeof(TrackingSpace));
+	}
+}
+
+int32 FSteamVRInputRecorder::GetFrameCount() const
+{
+	FScopeLock RecordScopeLock(&RecordLock);
+	return Recording.Frames.Num() + 1;
+}
+
+bool FSteamVRInputRecorder::SaveToFile(const FString& FilePath)
+{
+	FScopeLock RecordScopeLock(&RecordLock);
+	CommitFrame();
+	return Recording.SaveToFile(FilePath);
+}
+
+void FSteamVRInputRecorder::Record(EInputRecordCall Call, uint64 Handle, uint64 Extra, uint32 Variant, EVRInputError Error, const void* Data, uint32 DataSize)
+{
+	const FSteamVRInputRecordKey Key(Call, Handle, Extra, Variant);
+	const bool bIsGameThread = IsInGameThread();
+
+	FScopeLock RecordScopeLock(&RecordLock);
+	if (bIsGameThread)
+	{
+		GameThreadFrameKeys.Add(Key);
+	}
+	else if (GameThreadFrameKeys.Contains(Key))
+	{
+		// What the game thread read this frame stands, a replay serves it to every thread
+		return;
+	}
+
+	FSteamVRInputRecord& FrameRecord = FrameRecords.FindOrAdd(Key);
+	FrameRecord.Key = Key;
+	FrameRecord.Error = (int32)Error;
+	FrameRecord.Payload.SetNumUninitialized(Data != nullptr ? DataSize : 0, false);
+	if (FrameRecord.Payload.Num() > 0)
+	{
+		FMemory::Memcpy(FrameRecord.Payload.GetData(), Data, FrameRecord.Payload.Num());
+	}
+}
+
+void FSteamVRInputRecorder::CommitFrame()
+{
+	TArray<FSteamVRInputRecord>& ChangedRecords = Recording.Frames.AddDefaulted_GetRef();
+	for (TPair<FSteamVRInputRecordKey, FSteamVRInputRecord>& FrameRecord : FrameRecords)
+	{
+		FSteamVRInputRecord* CommittedRecord = CommittedRecords.Find(FrameRecord.Key);
+		if (CommittedRecord != nullptr && CommittedRecord->Error == FrameRecord.Value.Error && CommittedRecord->Payload == FrameRecord.Value.Payload)
+		{
+			continue;
+		}
+
+		ChangedRecords.Add(FrameRecord.Value);
+		CommittedRecords.Add(FrameRecord.Key, MoveTemp(FrameRecord.Value));
+	}
+	FrameRecords.Reset();
+	GameThreadFrameKeys.Reset();
+}
+
+EVRInputError FSteamVRInputRecorder::SetActionManifestPath(const char* pchActionManifestPath)
+{
+	IVRInput* Input = GetForwardedInput();
+	return Input != nullptr ? Input->SetActionManifestPath(pchActionManifestPath) : VRInputError_NoData;
+}
+
+EVRInputError FSteamVRInputRecorder::GetActionSetHandle(const char* pchActionSetName, VRActionSetHandle_t* pHandle)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetActionSetHandle(pchActionSetName, pHandle);
+	Record(InputRecord_ActionSetHandle, HashInputPath(pchActionSetName), 0, 0, Error, pHandle, sizeof(*pHandle));
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetActionHandle(const char* pchActionName, VRActionHandle_t* pHandle)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetActionHandle(pchActionName, pHandle);
+	Record(InputRecord_ActionHandle, HashInputPath(pchActionName), 0, 0, Error, pHandle, sizeof(*pHandle));
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetInputSourceHandle(const char* pchInputSourcePath, VRInputValueHandle_t* pHandle)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetInputSourceHandle(pchInputSourcePath, pHandle);
+	Record(InputRecord_InputSourceHandle, HashInputPath(pchInputSourcePath), 0, 0, Error, pHandle, sizeof(*pHandle));
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::UpdateActionState(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->UpdateActionState(pSets, unSizeOfVRSelectedActionSet_t, unSetCount);
+	Record(InputRecord_UpdateActionState, 0, 0, 0, Error, nullptr, 0);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetDigitalActionData(VRActionHandle_t action, InputDigitalActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetDigitalActionData(action, pActionData, unActionDataSize, ulRestrictToDevice);
+	Record(InputRecord_DigitalActionData, action, ulRestrictToDevice, 0, Error, pActionData, unActionDataSize);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetAnalogActionData(VRActionHandle_t action, InputAnalogActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetAnalogActionData(action, pActionData, unActionDataSize, ulRestrictToDevice);
+	Record(InputRecord_AnalogActionData, action, ulRestrictToDevice, 0, Error, pActionData, unActionDataSize);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetPoseActionDataRelativeToNow(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, float fPredictedSecondsFromNow, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	// Poses predicted for different times are different results, e.g. the game's and a late update's
+	EVRInputError Error = Input->GetPoseActionDataRelativeToNow(action, eOrigin, fPredictedSecondsFromNow, pActionData, unActionDataSize, ulRestrictToDevice);
+	Record(InputRecord_PoseActionDataRelativeToNow, action, ulRestrictToDevice, PackPoseVariant(eOrigin, fPredictedSecondsFromNow), Error, pActionData, unActionDataSize);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetPoseActionDataForNextFrame(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetPoseActionDataForNextFrame(action, eOrigin, pActionData, unActionDataSize, ulRestrictToDevice);
+	Record(InputRecord_PoseActionDataForNextFrame, action, ulRestrictToDevice, (uint32)eOrigin, Error, pActionData, unActionDataSize);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetSkeletalActionData(VRActionHandle_t action, InputSkeletalActionData_t* pActionData, uint32_t unActionDataSize)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetSkeletalActionData(action, pActionData, unActionDataSize);
+	Record(InputRecord_SkeletalActionData, action, 0, 0, Error, pActionData, unActionDataSize);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetBoneCount(VRActionHandle_t action, uint32_t* pBoneCount)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetBoneCount(action, pBoneCount);
+	Record(InputRecord_BoneCount, action, 0, 0, Error, pBoneCount, sizeof(*pBoneCount));
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetBoneHierarchy(VRActionHandle_t action, BoneIndex_t* pParentIndices, uint32_t unIndexArayCount)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetBoneHierarchy(action, pParentIndices, unIndexArayCount);
+	Record(InputRecord_BoneHierarchy, action, 0, unIndexArayCount, Error, pParentIndices, sizeof(BoneIndex_t) * unIndexArayCount);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetBoneName(VRActionHandle_t action, BoneIndex_t nBoneIndex, char* pchBoneName, uint32_t unNameBufferSize)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetBoneName(action, nBoneIndex, pchBoneName, unNameBufferSize);
+	Record(InputRecord_BoneName, action, 0, (uint32)nBoneIndex, Error, pchBoneName, GetInputStringSize(pchBoneName, unNameBufferSize));
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetSkeletalReferenceTransforms(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalReferencePose eReferencePose, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetSkeletalReferenceTransforms(action, eTransformSpace, eReferencePose, pTransformArray, unTransformArrayCount);
+	Record(InputRecord_SkeletalReferenceTransforms, action, 0, (uint32)eTransformSpace | ((uint32)eReferencePose << 8), Error, pTransformArray, sizeof(VRBoneTransform_t) * unTransformArrayCount);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetSkeletalTrackingLevel(VRActionHandle_t action, EVRSkeletalTrackingLevel* pSkeletalTrackingLevel)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetSkeletalTrackingLevel(action, pSkeletalTrackingLevel);
+	Record(InputRecord_SkeletalTrackingLevel, action, 0, 0, Error, pSkeletalTrackingLevel, sizeof(*pSkeletalTrackingLevel));
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetSkeletalBoneData(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalMotionRange eMotionRange, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetSkeletalBoneData(action, eTransformSpace, eMotionRange, pTransformArray, unTransformArrayCount);
+	Record(InputRecord_SkeletalBoneData, action, 0, (uint32)eTransformSpace | ((uint32)eMotionRange << 8), Error, pTransformArray, sizeof(VRBoneTransform_t) * unTransformArrayCount);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetSkeletalSummaryData(VRActionHandle_t action, EVRSummaryType eSummaryType, VRSkeletalSummaryData_t* pSkeletalSummaryData)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetSkeletalSummaryData(action, eSummaryType, pSkeletalSummaryData);
+	Record(InputRecord_SkeletalSummaryData, action, 0, (uint32)eSummaryType, Error, pSkeletalSummaryData, sizeof(*pSkeletalSummaryData));
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetSkeletalBoneDataCompressed(VRActionHandle_t action, EVRSkeletalMotionRange eMotionRange, void* pvCompressedData, uint32_t unCompressedSize, uint32_t* punRequiredCompressedSize)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetSkeletalBoneDataCompressed(action, eMotionRange, pvCompressedData, unCompressedSize, punRequiredCompressedSize);
+
+	// Keep the required size ahead of the compressed data, it is returned even when the buffer is too small
+	const uint32 RequiredSize = punRequiredCompressedSize != nullptr ? *punRequiredCompressedSize : 0;
+	const uint32 CompressedSize = (Error == VRInputError_None && pvCompressedData != nullptr) ? FMath::Min(RequiredSize, unCompressedSize) : 0;
+	TArray<uint8, TInlineAllocator<256>> Payload;
+	Payload.SetNumUninitialized(sizeof(RequiredSize) + CompressedSize);
+	FMemory::Memcpy(Payload.GetData(), &RequiredSize, sizeof(RequiredSize));
+	if (CompressedSize > 0)
+	{
+		FMemory::Memcpy(Payload.GetData() + sizeof(RequiredSize), pvCompressedData, CompressedSize);
+	}
+	Record(InputRecord_SkeletalBoneDataCompressed, action, 0, (uint32)eMotionRange, Error, Payload.GetData(), Payload.Num());
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::DecompressSkeletalBoneData(const void* pvCompressedBuffer, uint32_t unCompressedBufferSize, EVRSkeletalTransformSpace eTransformSpace, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->DecompressSkeletalBoneData(pvCompressedBuffer, unCompressedBufferSize, eTransformSpace, pTransformArray, unTransformArrayCount);
+	Record(InputRecord_DecompressSkeletalBoneData, HashInputBuffer(pvCompressedBuffer, unCompressedBufferSize), 0, (uint32)eTransformSpace, Error, pTransformArray, sizeof(VRBoneTransform_t) * unTransformArrayCount);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::TriggerHapticVibrationAction(VRActionHandle_t action, float fStartSecondsFromNow, float fDurationSeconds, float fFrequency, float fAmplitude, VRInputValueHandle_t ulRestrictToDevice)
+{
+	IVRInput* Input = GetForwardedInput();
+	return Input != nullptr ? Input->TriggerHapticVibrationAction(action, fStartSecondsFromNow, fDurationSeconds, fFrequency, fAmplitude, ulRestrictToDevice) : VRInputError_NoData;
+}
+
+EVRInputError FSteamVRInputRecorder::GetActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t digitalActionHandle, VRInputValueHandle_t* originsOut, uint32_t originOutCount)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetActionOrigins(actionSetHandle, digitalActionHandle, originsOut, originOutCount);
+	Record(InputRecord_ActionOrigins, digitalActionHandle, actionSetHandle, originOutCount, Error, originsOut, sizeof(VRInputValueHandle_t) * originOutCount);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetOriginLocalizedName(VRInputValueHandle_t origin, char* pchNameArray, uint32_t unNameArraySize, int32_t unStringSectionsToInclude)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetOriginLocalizedName(origin, pchNameArray, unNameArraySize, unStringSectionsToInclude);
+	Record(InputRecord_OriginLocalizedName, origin, 0, (uint32)unStringSectionsToInclude, Error, pchNameArray, GetInputStringSize(pchNameArray, unNameArraySize));
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetOriginTrackedDeviceInfo(VRInputValueHandle_t origin, InputOriginInfo_t* pOriginInfo, uint32_t unOriginInfoSize)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetOriginTrackedDeviceInfo(origin, pOriginInfo, unOriginInfoSize);
+	Record(InputRecord_OriginTrackedDeviceInfo, origin, 0, 0, Error, pOriginInfo, unOriginInfoSize);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::GetActionBindingInfo(VRActionHandle_t action, InputBindingInfo_t* pOriginInfo, uint32_t unBindingInfoSize, uint32_t unBindingInfoCount, uint32_t* punReturnedBindingInfoCount)
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return VRInputError_NoData;
+	}
+
+	EVRInputError Error = Input->GetActionBindingInfo(action, pOriginInfo, unBindingInfoSize, unBindingInfoCount, punReturnedBindingInfoCount);
+	const uint32 ReturnedCount = punReturnedBindingInfoCount != nullptr ? FMath::Min(*punReturnedBindingInfoCount, unBindingInfoCount) : 0;
+	Record(InputRecord_ActionBindingInfo, action, 0, unBindingInfoCount, Error, pOriginInfo, unBindingInfoSize * ReturnedCount);
+	return Error;
+}
+
+EVRInputError FSteamVRInputRecorder::ShowActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t ulActionHandle)
+{
+	IVRInput* Input = GetForwardedInput();
+	return Input != nullptr ? Input->ShowActionOrigins(actionSetHandle, ulActionHandle) : VRInputError_NoData;
+}
+
+EVRInputError FSteamVRInputRecorder::ShowBindingsForActionSet(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount, VRInputValueHandle_t originToHighlight)
+{
+	IVRInput* Input = GetForwardedInput();
+	return Input != nullptr ? Input->ShowBindingsForActionSet(pSets, unSizeOfVRSelectedActionSet_t, unSetCount, originToHighlight) : VRInputError_NoData;
+}
+
+bool FSteamVRInputRecorder::IsUsingLegacyInput()
+{
+	IVRInput* Input = GetForwardedInput();
+	if (Input == nullptr)
+	{
+		return false;
+	}
+
+	const bool bIsUsingLegacyInput = Input->IsUsingLegacyInput();
+	Record(InputRecord_IsUsingLegacyInput, 0, 0, 0, VRInputError_None, &bIsUsingLegacyInput, sizeof(bIsUsingLegacyInput));
+	return bIsUsingLegacyInput;
+}
+
+EVRInputError FSteamVRInputRecorder::OpenBindingUI(const char* pchAppKey, VRActionSetHandle_t ulActionSetHandle, VRInputValueHandle_t ulDeviceHandle, bool bShowOnDesktop)
+{
+	IVRInput* Input = GetForwardedInput();
+	return Input != nullptr ? Input->OpenBindingUI(pchAppKey, ulActionSetHandle, ulDeviceHandle, bShowOnDesktop) : VRInputError_NoData;
+}
+
+bool FSteamVRInputReplay::LoadFromFile(const FString& FilePath)
+{
+	FScopeLock ReplayScopeLock(&ReplayLock);
+	ServedRecords.Reset();
+	FrameIndex = INDEX_NONE;
+	NullCompositor.SetTrackingSpace(TrackingUniverseStanding);
+
+	if (!Recording.LoadFromFile(FilePath) || Recording.Frames.Num() == 0)
+	{
+		return false;
+	}
+
+	ApplyFrame(0);
+	return true;
+}
+
+bool FSteamVRInputReplay::BeginFrame()
+{
+	FScopeLock ReplayScopeLock(&ReplayLock);
+	if (FrameIndex + 1 >= Recording.Frames.Num())
+	{
+		return false;
+	}
+
+	ApplyFrame(FrameIndex + 1);
+	return true;
+}
+
+void FSteamVRInputReplay::ApplyFrame(int32 InFrameIndex)
+{
+	FrameIndex = InFrameIndex;
+	for (const FSteamVRInputRecord& FrameRecord : Recording.Frames[FrameIndex])
+	{
+		ServedRecords.Add(FrameRecord.Key, &FrameRecord);
+
+		if (FrameRecord.Key.Call == InputRecord_TrackingSpace && FrameRecord.Payload.Num() == sizeof(int32))
+		{
+			int32 TrackingSpace = 0;
+			FMemory::Memcpy(&TrackingSpace, FrameRecord.Payload.GetData(), sizeof(TrackingSpace));
+			NullCompositor.SetTrackingSpace((ETrackingUniverseOrigin)TrackingSpace);
+		}
+	}
+}
+
+EVRInputError FSteamVRInputReplay::Serve(EInputRecordCall Call, uint64 Handle, uint64 Extra, uint32 Variant, void* OutData, uint32 OutDataSize, uint32* OutServedSize) const
+{
+	FScopeLock ReplayScopeLock(&ReplayLock);
+	const FSteamVRInputRecord* const* ServedRecord = ServedRecords.Find(FSteamVRInputRecordKey(Call, Handle, Extra, Variant));
+
+	const uint32 ServedSize = (ServedRecord != nullptr && OutData != nullptr) ? FMath::Min<uint32>((*ServedRecord)->Payload.Num(), OutDataSize) : 0;
+	if (ServedSize > 0)
+	{
+		FMemory::Memcpy(OutData, (*ServedRecord)->Payload.GetData(), ServedSize);
+	}
+	if (OutData != nullptr && ServedSize < OutDataSize)
+	{
+		FMemory::Memzero((uint8*)OutData + ServedSize, OutDataSize - ServedSize);
+	}
+	if (OutServedSize != nullptr)
+	{
+		*OutServedSize = ServedSize;
+	}
+
+	return ServedRecord != nullptr ? (EVRInputError)(*ServedRecord)->Error : VRInputError_NoData;
+}
+
+EVRInputError FSteamVRInputReplay::SetActionManifestPath(const char* pchActionManifestPath)
+{
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRInputReplay::GetActionSetHandle(const char* pchActionSetName, VRActionSetHandle_t* pHandle)
+{
+	return Serve(InputRecord_ActionSetHandle, HashInputPath(pchActionSetName), 0, 0, pHandle, sizeof(*pHandle));
+}
+
+EVRInputError FSteamVRInputReplay::GetActionHandle(const char* pchActionName, VRActionHandle_t* pHandle)
+{
+	return Serve(InputRecord_ActionHandle, HashInputPath(pchActionName), 0, 0, pHandle, sizeof(*pHandle));
+}
+
+EVRInputError FSteamVRInputReplay::GetInputSourceHandle(const char* pchInputSourcePath, VRInputValueHandle_t* pHandle)
+{
+	return Serve(InputRecord_InputSourceHandle, HashInputPath(pchInputSourcePath), 0, 0, pHandle, sizeof(*pHandle));
+}
+
+EVRInputError FSteamVRInputReplay::UpdateActionState(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount)
+{
+	return Serve(InputRecord_UpdateActionState, 0, 0, 0, nullptr, 0);
+}
+
+EVRInputError FSteamVRInputReplay::GetDigitalActionData(VRActionHandle_t action, InputDigitalActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	return Serve(InputRecord_DigitalActionData, action, ulRestrictToDevice, 0, pActionData, unActionDataSize);
+}
+
+EVRInputError FSteamVRInputReplay::GetAnalogActionData(VRActionHandle_t action, InputAnalogActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	return Serve(InputRecord_AnalogActionData, action, ulRestrictToDevice, 0, pActionData, unActionDataSize);
+}
+
+EVRInputError FSteamVRInputReplay::GetPoseActionDataRelativeToNow(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, float fPredictedSecondsFromNow, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	return Serve(InputRecord_PoseActionDataRelativeToNow, action, ulRestrictToDevice, PackPoseVariant(eOrigin, fPredictedSecondsFromNow), pActionData, unActionDataSize);
+}
+
+EVRInputError FSteamVRInputReplay::GetPoseActionDataForNextFrame(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	return Serve(InputRecord_PoseActionDataForNextFrame, action, ulRestrictToDevice, (uint32)eOrigin, pActionData, unActionDataSize);
+}
+
+EVRInputError FSteamVRInputReplay::GetSkeletalActionData(VRActionHandle_t action, InputSkeletalActionData_t* pActionData, uint32_t unActionDataSize)
+{
+	return Serve(InputRecord_SkeletalActionData, action, 0, 0, pActionData, unActionDataSize);
+}
+
+EVRInputError FSteamVRInputReplay::GetBoneCount(VRActionHandle_t action, uint32_t* pBoneCount)
+{
+	return Serve(InputRecord_BoneCount, action, 0, 0, pBoneCount, sizeof(*pBoneCount));
+}
+
+EVRInputError FSteamVRInputReplay::GetBoneHierarchy(VRActionHandle_t action, BoneIndex_t* pParentIndices, uint32_t unIndexArayCount)
+{
+	return Serve(InputRecord_BoneHierarchy, action, 0, unIndexArayCount, pParentIndices, sizeof(BoneIndex_t) * unIndexArayCount);
+}
+
+EVRInputError FSteamVRInputReplay::GetBoneName(VRActionHandle_t action, BoneIndex_t nBoneIndex, char* pchBoneName, uint32_t unNameBufferSize)
+{
+	return Serve(InputRecord_BoneName, action, 0, (uint32)nBoneIndex, pchBoneName, unNameBufferSize);
+}
+
+EVRInputError FSteamVRInputReplay::GetSkeletalReferenceTransforms(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalReferencePose eReferencePose, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	return Serve(InputRecord_SkeletalReferenceTransforms, action, 0, (uint32)eTransformSpace | ((uint32)eReferencePose << 8), pTransformArray, sizeof(VRBoneTransform_t) * unTransformArrayCount);
+}
+
+EVRInputError FSteamVRInputReplay::GetSkeletalTrackingLevel(VRActionHandle_t action, EVRSkeletalTrackingLevel* pSkeletalTrackingLevel)
+{
+	return Serve(InputRecord_SkeletalTrackingLevel, action, 0, 0, pSkeletalTrackingLevel, sizeof(*pSkeletalTrackingLevel));
+}
+
+EVRInputError FSteamVRInputReplay::GetSkeletalBoneData(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalMotionRange eMotionRange, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	return Serve(InputRecord_SkeletalBoneData, action, 0, (uint32)eTransformSpace | ((uint32)eMotionRange << 8), pTransformArray, sizeof(VRBoneTransform_t) * unTransformArrayCount);
+}
+
+EVRInputError FSteamVRInputReplay::GetSkeletalSummaryData(VRActionHandle_t action, EVRSummaryType eSummaryType, VRSkeletalSummaryData_t* pSkeletalSummaryData)
+{
+	return Serve(InputRecord_SkeletalSummaryData, action, 0, (uint32)eSummaryType, pSkeletalSummaryData, sizeof(*pSkeletalSummaryData));
+}
+
+EVRInputError FSteamVRInputReplay::GetSkeletalBoneDataCompressed(VRActionHandle_t action, EVRSkeletalMotionRange eMotionRange, void* pvCompressedData, uint32_t unCompressedSize, uint32_t* punRequiredCompressedSize)
+{
+	// The recorded required size comes ahead of the compressed data
+	TArray<uint8, TInlineAllocator<256>> Payload;
+	Payload.SetNumZeroed(sizeof(uint32) + unCompressedSize);
+	uint32 ServedSize = 0;
+	EVRInputError Error = Serve(InputRecord_SkeletalBoneDataCompressed, action, 0, (uint32)eMotionRange, Payload.GetData(), Payload.Num(), &ServedSize);
+
+	if (punRequiredCompressedSize != nullptr)
+	{
+		FMemory::Memcpy(punRequiredCompressedSize, Payload.GetData(), sizeof(uint32));
+	}
+	if (pvCompressedData != nullptr && unCompressedSize > 0)
+	{
+		FMemory::Memcpy(pvCompressedData, Payload.GetData() + sizeof(uint32), unCompressedSize);
+	}
+	return Error;
+}
+
+EVRInputError FSteamVRInputReplay::DecompressSkeletalBoneData(const void* pvCompressedBuffer, uint32_t unCompressedBufferSize, EVRSkeletalTransformSpace eTransformSpace, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	return Serve(InputRecord_DecompressSkeletalBoneData, HashInputBuffer(pvCompressedBuffer, unCompressedBufferSize), 0, (uint32)eTransformSpace, pTransformArray, sizeof(VRBoneTransform_t) * unTransformArrayCount);
+}
+
+EVRInputError FSteamVRInputReplay::TriggerHapticVibrationAction(VRActionHandle_t action, float fStartSecondsFromNow, float fDurationSeconds, float fFrequency, float fAmplitude, VRInputValueHandle_t ulRestrictToDevice)
+{
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRInputReplay::GetActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t digitalActionHandle, VRInputValueHandle_t* originsOut, uint32_t originOutCount)
+{
+	return Serve(InputRecord_ActionOrigins, digitalActionHandle, actionSetHandle, originOutCount, originsOut, sizeof(VRInputValueHandle_t) * originOutCount);
+}
+
+EVRInputError FSteamVRInputReplay::GetOriginLocalizedName(VRInputValueHandle_t origin, char* pchNameArray, uint32_t unNameArraySize, int32_t unStringSectionsToInclude)
+{
+	return Serve(InputRecord_OriginLocalizedName, origin, 0, (uint32)unStringSectionsToInclude, pchNameArray, unNameArraySize);
+}
+
+EVRInputError FSteamVRInputReplay::GetOriginTrackedDeviceInfo(VRInputValueHandle_t origin, InputOriginInfo_t* pOriginInfo, uint32_t unOriginInfoSize)
+{
+	return Serve(InputRecord_OriginTrackedDeviceInfo, origin, 0, 0, pOriginInfo, unOriginInfoSize);
+}
+
+EVRInputError FSteamVRInputReplay::GetActionBindingInfo(VRActionHandle_t action, InputBindingInfo_t* pOriginInfo, uint32_t unBindingInfoSize, uint32_t unBindingInfoCount, uint32_t* punReturnedBindingInfoCount)
+{
+	uint32 ServedSize = 0;
+	EVRInputError Error = Serve(InputRecord_ActionBindingInfo, action, 0, unBindingInfoCount, pOriginInfo, unBindingInfoSize * unBindingInfoCount, &ServedSize);
+	if (punReturnedBindingInfoCount != nullptr)
+	{
+		*punReturnedBindingInfoCount = unBindingInfoSize > 0 ? ServedSize / unBindingInfoSize : 0;
+	}
+	return Error;
+}
+
+EVRInputError FSteamVRInputReplay::ShowActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t ulActionHandle)
+{
+	return VRInputError_None;
+}
+
+EVRInputError FSteamVRInputReplay::ShowBindingsForActionSet(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount, VRInputValueHandle_t originToHighlight)
+{
+	return VRInputError_None;
+}
+
+bool FSteamVRInputReplay::IsUsingLegacyInput()
+{
+	bool bIsUsingLegacyInput = false;
+	Serve(InputRecord_IsUsingLegacyInput, 0, 0, 0, &bIsUsingLegacyInput, sizeof(bIsUsingLegacyInput));
+	return bIsUsingLegacyInput;
+}
+
+EVRInputError FSteamVRInputReplay::OpenBindingUI(const char* pchAppKey, VRActionSetHandle_t ulActionSetHandle, VRInputValueHandle_t ulDeviceHandle, bool bShowOnDesktop)
+{
+	return VRInputError_None;
+}
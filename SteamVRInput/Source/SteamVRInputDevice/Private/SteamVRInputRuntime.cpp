@@ -0,0 +1,63 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "SteamVRInputRuntime.h"
+
+IVRSystem* FSteamVRInputRuntime::OverrideSystem = nullptr;
+IVRInput* FSteamVRInputRuntime::OverrideInput = nullptr;
+IVRCompositor* FSteamVRInputRuntime::OverrideCompositor = nullptr;
+IVRApplications* FSteamVRInputRuntime::OverrideApplications = nullptr;
+IVRSystem* FSteamVRInputRuntime::CountingSystem = nullptr;
+IVRInput* FSteamVRInputRuntime::CountingInput = nullptr;
+IVRCompositor* FSteamVRInputRuntime::CountingCompositor = nullptr;
+
+void FSteamVRInputRuntime::SetOverride(IVRSystem* InSystem, IVRInput* InInput, IVRCompositor* InCompositor, IVRApplications* InApplications)
+{
+	OverrideSystem = InSystem;
+	OverrideInput = InInput;
+	OverrideCompositor = InCompositor;
+	OverrideApplications = InApplications;
+}
+
+void FSteamVRInputRuntime::ClearOverride()
+{
+	SetOverride(nullptr, nullptr, nullptr, nullptr);
+}
+
+bool FSteamVRInputRuntime::IsOverridden()
+{
+	return OverrideSystem != nullptr || OverrideInput != nullptr || OverrideCompositor != nullptr || OverrideApplications != nullptr;
+}
+
+void FSteamVRInputRuntime::SetCountingInterfaces(IVRSystem* InSystem, IVRInput* InInput, IVRCompositor* InCompositor)
+{
+	CountingSystem = InSystem;
+	CountingInput = InInput;
+	CountingCompositor = InCompositor;
+}
@@ -0,0 +1,1167 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "SteamVRInputStats.h"
+#include "SteamVRInputRuntime.h"
+
+DEFINE_STAT(STAT_SteamVRInput_SendControllerEvents);
+DEFINE_STAT(STAT_SteamVRInput_ProcessActionEvents);
+DEFINE_STAT(STAT_SteamVRInput_PoseQuery);
+DEFINE_STAT(STAT_SteamVRInput_SkeletalData);
+DEFINE_STAT(STAT_SteamVRInput_ActionManifest);
+DEFINE_STAT(STAT_SteamVRInput_SystemCalls);
+DEFINE_STAT(STAT_SteamVRInput_InputCalls);
+DEFINE_STAT(STAT_SteamVRInput_CompositorCalls);
+
+CSV_DEFINE_CATEGORY(SteamVRInput, true);
+
+/** Counts the IVRSystem calls of the plugin, served by FSteamVRInputRuntime::ResolveSystem */
+class FSteamVRCountingSystem : public IVRSystem
+{
+public:
+	virtual ~FSteamVRCountingSystem() {}
+
+	// IVRSystem interface
+	virtual void GetRecommendedRenderTargetSize(uint32_t* pnWidth, uint32_t* pnHeight) override;
+	virtual HmdMatrix44_t GetProjectionMatrix(EVREye eEye, float fNearZ, float fFarZ) override;
+	virtual void GetProjectionRaw(EVREye eEye, float* pfLeft, float* pfRight, float* pfTop, float* pfBottom) override;
+	virtual bool ComputeDistortion(EVREye eEye, float fU, float fV, DistortionCoordinates_t* pDistortionCoordinates) override;
+	virtual HmdMatrix34_t GetEyeToHeadTransform(EVREye eEye) override;
+	virtual bool GetTimeSinceLastVsync(float* pfSecondsSinceLastVsync, uint64_t* pulFrameCounter) override;
+	virtual int32_t GetD3D9AdapterIndex() override;
+	virtual void GetDXGIOutputInfo(int32_t* pnAdapterIndex) override;
+	virtual void GetOutputDevice(uint64_t* pnDevice, ETextureType textureType, VkInstance_T* pInstance) override;
+	virtual bool IsDisplayOnDesktop() override;
+	virtual bool SetDisplayVisibility(bool bIsVisibleOnDesktop) override;
+	virtual void GetDeviceToAbsoluteTrackingPose(ETrackingUniverseOrigin eOrigin, float fPredictedSecondsToPhotonsFromNow, TrackedDevicePose_t* pTrackedDevicePoseArray, uint32_t unTrackedDevicePoseArrayCount) override;
+	virtual void ResetSeatedZeroPose() override;
+	virtual HmdMatrix34_t GetSeatedZeroPoseToStandingAbsoluteTrackingPose() override;
+	virtual HmdMatrix34_t GetRawZeroPoseToStandingAbsoluteTrackingPose() override;
+	virtual uint32_t GetSortedTrackedDeviceIndicesOfClass(ETrackedDeviceClass eTrackedDeviceClass, TrackedDeviceIndex_t* punTrackedDeviceIndexArray, uint32_t unTrackedDeviceIndexArrayCount, TrackedDeviceIndex_t unRelativeToTrackedDeviceIndex) override;
+	virtual EDeviceActivityLevel GetTrackedDeviceActivityLevel(TrackedDeviceIndex_t unDeviceId) override;
+	virtual void ApplyTransform(TrackedDevicePose_t* pOutputPose, const TrackedDevicePose_t* pTrackedDevicePose, const HmdMatrix34_t* pTransform) override;
+	virtual TrackedDeviceIndex_t GetTrackedDeviceIndexForControllerRole(ETrackedControllerRole unDeviceType) override;
+	virtual ETrackedControllerRole GetControllerRoleForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex) override;
+	virtual ETrackedDeviceClass GetTrackedDeviceClass(TrackedDeviceIndex_t unDeviceIndex) override;
+	virtual bool IsTrackedDeviceConnected(TrackedDeviceIndex_t unDeviceIndex) override;
+	virtual bool GetBoolTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual float GetFloatTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual int32_t GetInt32TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual uint64_t GetUint64TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual HmdMatrix34_t GetMatrix34TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual uint32_t GetArrayTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, PropertyTypeTag_t propType, void* pBuffer, uint32_t unBufferSize, ETrackedPropertyError* pError) override;
+	virtual uint32_t GetStringTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, char* pchValue, uint32_t unBufferSize, ETrackedPropertyError* pError) override;
+	virtual const char* GetPropErrorNameFromEnum(ETrackedPropertyError error) override;
+	virtual bool PollNextEvent(VREvent_t* pEvent, uint32_t uncbVREvent) override;
+	virtual bool PollNextEventWithPose(ETrackingUniverseOrigin eOrigin, VREvent_t* pEvent, uint32_t uncbVREvent, TrackedDevicePose_t* pTrackedDevicePose) override;
+	virtual const char* GetEventTypeNameFromEnum(EVREventType eType) override;
+	virtual HiddenAreaMesh_t GetHiddenAreaMesh(EVREye eEye, EHiddenAreaMeshType type) override;
+	virtual bool GetControllerState(TrackedDeviceIndex_t unControllerDeviceIndex, VRControllerState_t* pControllerState, uint32_t unControllerStateSize) override;
+	virtual bool GetControllerStateWithPose(ETrackingUniverseOrigin eOrigin, TrackedDeviceIndex_t unControllerDeviceIndex, VRControllerState_t* pControllerState, uint32_t unControllerStateSize, TrackedDevicePose_t* pTrackedDevicePose) override;
+	virtual void TriggerHapticPulse(TrackedDeviceIndex_t unControllerDeviceIndex, uint32_t unAxisId, unsigned short usDurationMicroSec) override;
+	virtual const char* GetButtonIdNameFromEnum(EVRButtonId eButtonId) override;
+	virtual const char* GetControllerAxisTypeNameFromEnum(EVRControllerAxisType eAxisType) override;
+	virtual bool IsInputAvailable() override;
+	virtual bool IsSteamVRDrawingControllers() override;
+	virtual bool ShouldApplicationPause() override;
+	virtual bool ShouldApplicationReduceRenderingWork() override;
+	virtual EVRFirmwareError PerformFirmwareUpdate(TrackedDeviceIndex_t unDeviceIndex) override;
+	virtual void AcknowledgeQuit_Exiting() override;
+	virtual uint32_t GetAppContainerFilePaths(char* pchBuffer, uint32_t unBufferSize) override;
+	virtual const char* GetRuntimeVersion() override;
+};
+
+/** Counts the IVRInput calls of the plugin, served by FSteamVRInputRuntime::ResolveInput */
+class FSteamVRCountingInput : public IVRInput
+{
+public:
+	virtual ~FSteamVRCountingInput() {}
+
+	// IVRInput interface
+	virtual EVRInputError SetActionManifestPath(const char* pchActionManifestPath) override;
+	virtual EVRInputError GetActionSetHandle(const char* pchActionSetName, VRActionSetHandle_t* pHandle) override;
+	virtual EVRInputError GetActionHandle(const char* pchActionName, VRActionHandle_t* pHandle) override;
+	virtual EVRInputError GetInputSourceHandle(const char* pchInputSourcePath, VRInputValueHandle_t* pHandle) override;
+	virtual EVRInputError UpdateActionState(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount) override;
+	virtual EVRInputError GetDigitalActionData(VRActionHandle_t action, InputDigitalActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetAnalogActionData(VRActionHandle_t action, InputAnalogActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetPoseActionDataRelativeToNow(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, float fPredictedSecondsFromNow, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetPoseActionDataForNextFrame(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetSkeletalActionData(VRActionHandle_t action, InputSkeletalActionData_t* pActionData, uint32_t unActionDataSize) override;
+	virtual EVRInputError GetBoneCount(VRActionHandle_t action, uint32_t* pBoneCount) override;
+	virtual EVRInputError GetBoneHierarchy(VRActionHandle_t action, BoneIndex_t* pParentIndices, uint32_t unIndexArayCount) override;
+	virtual EVRInputError GetBoneName(VRActionHandle_t action, BoneIndex_t nBoneIndex, char* pchBoneName, uint32_t unNameBufferSize) override;
+	virtual EVRInputError GetSkeletalReferenceTransforms(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalReferencePose eReferencePose, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError GetSkeletalTrackingLevel(VRActionHandle_t action, EVRSkeletalTrackingLevel* pSkeletalTrackingLevel) override;
+	virtual EVRInputError GetSkeletalBoneData(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalMotionRange eMotionRange, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError GetSkeletalSummaryData(VRActionHandle_t action, EVRSummaryType eSummaryType, VRSkeletalSummaryData_t* pSkeletalSummaryData) override;
+	virtual EVRInputError GetSkeletalBoneDataCompressed(VRActionHandle_t action, EVRSkeletalMotionRange eMotionRange, void* pvCompressedData, uint32_t unCompressedSize, uint32_t* punRequiredCompressedSize) override;
+	virtual EVRInputError DecompressSkeletalBoneData(const void* pvCompressedBuffer, uint32_t unCompressedBufferSize, EVRSkeletalTransformSpace eTransformSpace, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError TriggerHapticVibrationAction(VRActionHandle_t action, float fStartSecondsFromNow, float fDurationSeconds, float fFrequency, float fAmplitude, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t digitalActionHandle, VRInputValueHandle_t* originsOut, uint32_t originOutCount) override;
+	virtual EVRInputError GetOriginLocalizedName(VRInputValueHandle_t origin, char* pchNameArray, uint32_t unNameArraySize, int32_t unStringSectionsToInclude) override;
+	virtual EVRInputError GetOriginTrackedDeviceInfo(VRInputValueHandle_t origin, InputOriginInfo_t* pOriginInfo, uint32_t unOriginInfoSize) override;
+	virtual EVRInputError GetActionBindingInfo(VRActionHandle_t action, InputBindingInfo_t* pOriginInfo, uint32_t unBindingInfoSize, uint32_t unBindingInfoCount, uint32_t* punReturnedBindingInfoCount) override;
+	virtual EVRInputError ShowActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t ulActionHandle) override;
+	virtual EVRInputError ShowBindingsForActionSet(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount, VRInputValueHandle_t originToHighlight) override;
+	virtual bool IsUsingLegacyInput() override;
+	virtual EVRInputError OpenBindingUI(const char* pchAppKey, VRActionSetHandle_t ulActionSetHandle, VRInputValueHandle_t ulDeviceHandle, bool bShowOnDesktop) override;
+};
+
+/** Counts the IVRCompositor calls of the plugin, served by FSteamVRInputRuntime::ResolveCompositor */
+class FSteamVRCountingCompositor : public IVRCompositor
+{
+public:
+	virtual ~FSteamVRCountingCompositor() {}
+
+	// IVRCompositor interface
+	virtual void SetTrackingSpace(ETrackingUniverseOrigin eOrigin) override;
+	virtual ETrackingUniverseOrigin GetTrackingSpace() override;
+	virtual EVRCompositorError WaitGetPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount) override;
+	virtual EVRCompositorError GetLastPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount) override;
+	virtual EVRCompositorError GetLastPoseForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex, TrackedDevicePose_t* pOutputPose, TrackedDevicePose_t* pOutputGamePose) override;
+	virtual EVRCompositorError Submit(EVREye eEye, const Texture_t* pTexture, const VRTextureBounds_t* pBounds, EVRSubmitFlags nSubmitFlags) override;
+	virtual void ClearLastSubmittedFrame() override;
+	virtual void PostPresentHandoff() override;
+	virtual bool GetFrameTiming(Compositor_FrameTiming* pTiming, uint32_t unFramesAgo) override;
+	virtual uint32_t GetFrameTimings(Compositor_FrameTiming* pTiming, uint32_t nFrames) override;
+	virtual float GetFrameTimeRemaining() override;
+	virtual void GetCumulativeStats(Compositor_CumulativeStats* pStats, uint32_t nStatsSizeInBytes) override;
+	virtual void FadeToColor(float fSeconds, float fRed, float fGreen, float fBlue, float fAlpha, bool bBackground) override;
+	virtual HmdColor_t GetCurrentFadeColor(bool bBackground) override;
+	virtual void FadeGrid(float fSeconds, bool bFadeIn) override;
+	virtual float GetCurrentGridAlpha() override;
+	virtual EVRCompositorError SetSkyboxOverride(const Texture_t* pTextures, uint32_t unTextureCount) override;
+	virtual void ClearSkyboxOverride() override;
+	virtual void CompositorBringToFront() override;
+	virtual void CompositorGoToBack() override;
+	virtual void CompositorQuit() override;
+	virtual bool IsFullscreen() override;
+	virtual uint32_t GetCurrentSceneFocusProcess() override;
+	virtual uint32_t GetLastFrameRenderer() override;
+	virtual bool CanRenderScene() override;
+	virtual void ShowMirrorWindow() override;
+	virtual void HideMirrorWindow() override;
+	virtual bool IsMirrorWindowVisible() override;
+	virtual void CompositorDumpImages() override;
+	virtual bool ShouldAppRenderWithLowResources() override;
+	virtual void ForceInterleavedReprojectionOn(bool bOverride) override;
+	virtual void ForceReconnectProcess() override;
+	virtual void SuspendRendering(bool bSuspend) override;
+	virtual EVRCompositorError GetMirrorTextureD3D11(EVREye eEye, void* pD3D11DeviceOrResource, void* *ppD3D11ShaderResourceView) override;
+	virtual void ReleaseMirrorTextureD3D11(void* pD3D11ShaderResourceView) override;
+	virtual EVRCompositorError GetMirrorTextureGL(EVREye eEye, glUInt_t* pglTextureId, glSharedTextureHandle_t* pglSharedTextureHandle) override;
+	virtual bool ReleaseSharedGLTexture(glUInt_t glTextureId, glSharedTextureHandle_t glSharedTextureHandle) override;
+	virtual void LockGLSharedTextureForAccess(glSharedTextureHandle_t glSharedTextureHandle) override;
+	virtual void UnlockGLSharedTextureForAccess(glSharedTextureHandle_t glSharedTextureHandle) override;
+	virtual uint32_t GetVulkanInstanceExtensionsRequired(char* pchValue, uint32_t unBufferSize) override;
+	virtual uint32_t GetVulkanDeviceExtensionsRequired(VkPhysicalDevice_T* pPhysicalDevice, char* pchValue, uint32_t unBufferSize) override;
+	virtual void SetExplicitTimingMode(EVRCompositorTimingMode eTimingMode) override;
+	virtual EVRCompositorError SubmitExplicitTimingData() override;
+	virtual bool IsMotionSmoothingEnabled() override;
+	virtual bool IsMotionSmoothingSupported() override;
+	virtual bool IsCurrentSceneFocusAppLoading() override;
+};
+
+static const TCHAR* const SystemMethodNames[] =
+{
+	TEXT("GetRecommendedRenderTargetSize"),
+	TEXT("GetProjectionMatrix"),
+	TEXT("GetProjectionRaw"),
+	TEXT("ComputeDistortion"),
+	TEXT("GetEyeToHeadTransform"),
+	TEXT("GetTimeSinceLastVsync"),
+	TEXT("GetD3D9AdapterIndex"),
+	TEXT("GetDXGIOutputInfo"),
+	TEXT("GetOutputDevice"),
+	TEXT("IsDisplayOnDesktop"),
+	TEXT("SetDisplayVisibility"),
+	TEXT("GetDeviceToAbsoluteTrackingPose"),
+	TEXT("ResetSeatedZeroPose"),
+	TEXT("GetSeatedZeroPoseToStandingAbsoluteTrackingPose"),
+	TEXT("GetRawZeroPoseToStandingAbsoluteTrackingPose"),
+	TEXT("GetSortedTrackedDeviceIndicesOfClass"),
+	TEXT("GetTrackedDeviceActivityLevel"),
+	TEXT("ApplyTransform"),
+	TEXT("GetTrackedDeviceIndexForControllerRole"),
+	TEXT("GetControllerRoleForTrackedDeviceIndex"),
+	TEXT("GetTrackedDeviceClass"),
+	TEXT("IsTrackedDeviceConnected"),
+	TEXT("GetBoolTrackedDeviceProperty"),
+	TEXT("GetFloatTrackedDeviceProperty"),
+	TEXT("GetInt32TrackedDeviceProperty"),
+	TEXT("GetUint64TrackedDeviceProperty"),
+	TEXT("GetMatrix34TrackedDeviceProperty"),
+	TEXT("GetArrayTrackedDeviceProperty"),
+	TEXT("GetStringTrackedDeviceProperty"),
+	TEXT("GetPropErrorNameFromEnum"),
+	TEXT("PollNextEvent"),
+	TEXT("PollNextEventWithPose"),
+	TEXT("GetEventTypeNameFromEnum"),
+	TEXT("GetHiddenAreaMesh"),
+	TEXT("GetControllerState"),
+	TEXT("GetControllerStateWithPose"),
+	TEXT("TriggerHapticPulse"),
+	TEXT("GetButtonIdNameFromEnum"),
+	TEXT("GetControllerAxisTypeNameFromEnum"),
+	TEXT("IsInputAvailable"),
+	TEXT("IsSteamVRDrawingControllers"),
+	TEXT("ShouldApplicationPause"),
+	TEXT("ShouldApplicationReduceRenderingWork"),
+	TEXT("PerformFirmwareUpdate"),
+	TEXT("AcknowledgeQuit_Exiting"),
+	TEXT("GetAppContainerFilePaths"),
+	TEXT("GetRuntimeVersion")
+};
+
+static const TCHAR* const InputMethodNames[] =
+{
+	TEXT("SetActionManifestPath"),
+	TEXT("GetActionSetHandle"),
+	TEXT("GetActionHandle"),
+	TEXT("GetInputSourceHandle"),
+	TEXT("UpdateActionState"),
+	TEXT("GetDigitalActionData"),
+	TEXT("GetAnalogActionData"),
+	TEXT("GetPoseActionDataRelativeToNow"),
+	TEXT("GetPoseActionDataForNextFrame"),
+	TEXT("GetSkeletalActionData"),
+	TEXT("GetBoneCount"),
+	TEXT("GetBoneHierarchy"),
+	TEXT("GetBoneName"),
+	TEXT("GetSkeletalReferenceTransforms"),
+	TEXT("GetSkeletalTrackingLevel"),
+	TEXT("GetSkeletalBoneData"),
+	TEXT("GetSkeletalSummaryData"),
+	TEXT("GetSkeletalBoneDataCompressed"),
+	TEXT("DecompressSkeletalBoneData"),
+	TEXT("TriggerHapticVibrationAction"),
+	TEXT("GetActionOrigins"),
+	TEXT("GetOriginLocalizedName"),
+	TEXT("GetOriginTrackedDeviceInfo"),
+	TEXT("GetActionBindingInfo"),
+	TEXT("ShowActionOrigins"),
+	TEXT("ShowBindingsForActionSet"),
+	TEXT("IsUsingLegacyInput"),
+	TEXT("OpenBindingUI")
+};
+
+static const TCHAR* const CompositorMethodNames[] =
+{
+	TEXT("SetTrackingSpace"),
+	TEXT("GetTrackingSpace"),
+	TEXT("WaitGetPoses"),
+	TEXT("GetLastPoses"),
+	TEXT("GetLastPoseForTrackedDeviceIndex"),
+	TEXT("Submit"),
+	TEXT("ClearLastSubmittedFrame"),
+	TEXT("PostPresentHandoff"),
+	TEXT("GetFrameTiming"),
+	TEXT("GetFrameTimings"),
+	TEXT("GetFrameTimeRemaining"),
+	TEXT("GetCumulativeStats"),
+	TEXT("FadeToColor"),
+	TEXT("GetCurrentFadeColor"),
+	TEXT("FadeGrid"),
+	TEXT("GetCurrentGridAlpha"),
+	TEXT("SetSkyboxOverride"),
+	TEXT("ClearSkyboxOverride"),
+	TEXT("CompositorBringToFront"),
+	TEXT("CompositorGoToBack"),
+	TEXT("CompositorQuit"),
+	TEXT("IsFullscreen"),
+	TEXT("GetCurrentSceneFocusProcess"),
+	TEXT("GetLastFrameRenderer"),
+	TEXT("CanRenderScene"),
+	TEXT("ShowMirrorWindow"),
+	TEXT("HideMirrorWindow"),
+	TEXT("IsMirrorWindowVisible"),
+	TEXT("CompositorDumpImages"),
+	TEXT("ShouldAppRenderWithLowResources"),
+	TEXT("ForceInterleavedReprojectionOn"),
+	TEXT("ForceReconnectProcess"),
+	TEXT("SuspendRendering"),
+	TEXT("GetMirrorTextureD3D11"),
+	TEXT("ReleaseMirrorTextureD3D11"),
+	TEXT("GetMirrorTextureGL"),
+	TEXT("ReleaseSharedGLTexture"),
+	TEXT("LockGLSharedTextureForAccess"),
+	TEXT("UnlockGLSharedTextureForAccess"),
+	TEXT("GetVulkanInstanceExtensionsRequired"),
+	TEXT("GetVulkanDeviceExtensionsRequired"),
+	TEXT("SetExplicitTimingMode"),
+	TEXT("SubmitExplicitTimingData"),
+	TEXT("IsMotionSmoothingEnabled"),
+	TEXT("IsMotionSmoothingSupported"),
+	TEXT("IsCurrentSceneFocusAppLoading")
+};
+
+static const TCHAR* const* const InterfaceMethodNames[VRInterface_Count] = { SystemMethodNames, InputMethodNames, CompositorMethodNames };
+static const int32 InterfaceMethodCounts[VRInterface_Count] = { ARRAY_COUNT(SystemMethodNames), ARRAY_COUNT(InputMethodNames), ARRAY_COUNT(CompositorMethodNames) };
+static_assert(ARRAY_COUNT(SystemMethodNames) <= CALL_COUNTER_MAX_METHODS && ARRAY_COUNT(InputMethodNames) <= CALL_COUNTER_MAX_METHODS && ARRAY_COUNT(CompositorMethodNames) <= CALL_COUNTER_MAX_METHODS, "CALL_COUNTER_MAX_METHODS is too small");
+
+static FSteamVRCountingSystem CountingSystem;
+static FSteamVRCountingInput CountingInput;
+static FSteamVRCountingCompositor CountingCompositor;
+
+bool FSteamVRInputCallCounter::bIsCounting = false;
+FThreadSafeCounter FSteamVRInputCallCounter::CallCounts[VRInterface_Count][CALL_COUNTER_MAX_METHODS];
+int32 FSteamVRInputCallCounter::FrameCallCounts[VRInterface_Count][CALL_COUNTER_MAX_METHODS] = {};
+uint64 FSteamVRInputCallCounter::TotalCallCounts[VRInterface_Count][CALL_COUNTER_MAX_METHODS] = {};
+
+void FSteamVRInputCallCounter::SetEnabled(bool bIsEnabled)
+{
+	bIsCounting = bIsEnabled;
+	if (bIsCounting)
+	{
+		FSteamVRInputRuntime::SetCountingInterfaces(&CountingSystem, &CountingInput, &CountingCompositor);
+	}
+	else
+	{
+		FSteamVRInputRuntime::SetCountingInterfaces(nullptr, nullptr, nullptr);
+	}
+}
+
+void FSteamVRInputCallCounter::EndFrame()
+{
+#if CSV_PROFILER
+	// Method stat names are built once, e.g. IVRInput_GetDigitalActionData
+	static TArray<FName> MethodStatNames[VRInterface_Count];
+	if (MethodStatNames[0].Num() == 0)
+	{
+		for (int32 InterfaceIndex = 0; InterfaceIndex < VRInterface_Count; ++InterfaceIndex)
+		{
+			for (int32 MethodIndex = 0; MethodIndex < InterfaceMethodCounts[InterfaceIndex]; ++MethodIndex)
+			{
+				MethodStatNames[InterfaceIndex].Add(FName(*FString::Printf(TEXT("%s_%s"), GetInterfaceName((ESteamVRInterface)InterfaceIndex), InterfaceMethodNames[InterfaceIndex][MethodIndex])));
+			}
+		}
+	}
+#endif
+
+	for (int32 InterfaceIndex = 0; InterfaceIndex < VRInterface_Count; ++InterfaceIndex)
+	{
+		for (int32 MethodIndex = 0; MethodIndex < InterfaceMethodCounts[InterfaceIndex]; ++MethodIndex)
+		{
+			const int32 CallCount = CallCounts[InterfaceIndex][MethodIndex].Reset();
+			FrameCallCounts[InterfaceIndex][MethodIndex] = CallCount;
+			TotalCallCounts[InterfaceIndex][MethodIndex] += CallCount;
+
+#if CSV_PROFILER
+			// Methods get a column once they are first called
+			if (TotalCallCounts[InterfaceIndex][MethodIndex] > 0)
+			{
+				FCsvProfiler::RecordCustomStat(MethodStatNames[InterfaceIndex][MethodIndex], CSV_CATEGORY_INDEX(SteamVRInput), CallCount, ECsvCustomStatOp::Set);
+			}
+#endif
+		}
+	}
+
+	const int32 SystemCalls = GetFrameCallCount(VRInterface_System);
+	const int32 InputCalls = GetFrameCallCount(VRInterface_Input);
+	const int32 CompositorCalls = GetFrameCallCount(VRInterface_Compositor);
+
+	INC_DWORD_STAT_BY(STAT_SteamVRInput_SystemCalls, SystemCalls);
+	INC_DWORD_STAT_BY(STAT_SteamVRInput_InputCalls, InputCalls);
+	INC_DWORD_STAT_BY(STAT_SteamVRInput_CompositorCalls, CompositorCalls);
+
+	CSV_CUSTOM_STAT(SteamVRInput, SystemCalls, SystemCalls, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SteamVRInput, InputCalls, InputCalls, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SteamVRInput, CompositorCalls, CompositorCalls, ECsvCustomStatOp::Set);
+}
+
+const TCHAR* FSteamVRInputCallCounter::GetInterfaceName(ESteamVRInterface Interface)
+{
+	switch (Interface)
+	{
+	case VRInterface_System:		return TEXT("IVRSystem");
+	case VRInterface_Input:			return TEXT("IVRInput");
+	case VRInterface_Compositor:	return TEXT("IVRCompositor");
+	default:						return TEXT("Unknown");
+	}
+}
+
+int32 FSteamVRInputCallCounter::GetMethodCount(ESteamVRInterface Interface)
+{
+	return Interface < VRInterface_Count ? InterfaceMethodCounts[Interface] : 0;
+}
+
+const TCHAR* FSteamVRInputCallCounter::GetMethodName(ESteamVRInterface Interface, int32 MethodIndex)
+{
+	return (MethodIndex >= 0 && MethodIndex < GetMethodCount(Interface)) ? InterfaceMethodNames[Interface][MethodIndex] : TEXT("Unknown");
+}
+
+int32 FSteamVRInputCallCounter::GetFrameCallCount(ESteamVRInterface Interface)
+{
+	int32 CallCount = 0;
+	for (int32 MethodIndex = 0; MethodIndex < GetMethodCount(Interface); ++MethodIndex)
+	{
+		CallCount += FrameCallCounts[Interface][MethodIndex];
+	}
+	return CallCount;
+}
+
+void FSteamVRInputCallCounter::Reset()
+{
+	for (int32 InterfaceIndex = 0; InterfaceIndex < VRInterface_Count; ++InterfaceIndex)
+	{
+		for (int32 MethodIndex = 0; MethodIndex < CALL_COUNTER_MAX_METHODS; ++MethodIndex)
+		{
+			CallCounts[InterfaceIndex][MethodIndex].Reset();
+			FrameCallCounts[InterfaceIndex][MethodIndex] = 0;
+			TotalCallCounts[InterfaceIndex][MethodIndex] = 0;
+		}
+	}
+}
+
+void FSteamVRCountingSystem::GetRecommendedRenderTargetSize(uint32_t* pnWidth, uint32_t* pnHeight)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 0);
+	return FSteamVRInputRuntime::ResolveSystem()->GetRecommendedRenderTargetSize(pnWidth, pnHeight);
+}
+
+HmdMatrix44_t FSteamVRCountingSystem::GetProjectionMatrix(EVREye eEye, float fNearZ, float fFarZ)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 1);
+	return FSteamVRInputRuntime::ResolveSystem()->GetProjectionMatrix(eEye, fNearZ, fFarZ);
+}
+
+void FSteamVRCountingSystem::GetProjectionRaw(EVREye eEye, float* pfLeft, float* pfRight, float* pfTop, float* pfBottom)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 2);
+	return FSteamVRInputRuntime::ResolveSystem()->GetProjectionRaw(eEye, pfLeft, pfRight, pfTop, pfBottom);
+}
+
+bool FSteamVRCountingSystem::ComputeDistortion(EVREye eEye, float fU, float fV, DistortionCoordinates_t* pDistortionCoordinates)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 3);
+	return FSteamVRInputRuntime::ResolveSystem()->ComputeDistortion(eEye, fU, fV, pDistortionCoordinates);
+}
+
+HmdMatrix34_t FSteamVRCountingSystem::GetEyeToHeadTransform(EVREye eEye)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 4);
+	return FSteamVRInputRuntime::ResolveSystem()->GetEyeToHeadTransform(eEye);
+}
+
+bool FSteamVRCountingSystem::GetTimeSinceLastVsync(float* pfSecondsSinceLastVsync, uint64_t* pulFrameCounter)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 5);
+	return FSteamVRInputRuntime::ResolveSystem()->GetTimeSinceLastVsync(pfSecondsSinceLastVsync, pulFrameCounter);
+}
+
+int32_t FSteamVRCountingSystem::GetD3D9AdapterIndex()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 6);
+	return FSteamVRInputRuntime::ResolveSystem()->GetD3D9AdapterIndex();
+}
+
+void FSteamVRCountingSystem::GetDXGIOutputInfo(int32_t* pnAdapterIndex)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 7);
+	return FSteamVRInputRuntime::ResolveSystem()->GetDXGIOutputInfo(pnAdapterIndex);
+}
+
+void FSteamVRCountingSystem::GetOutputDevice(uint64_t* pnDevice, ETextureType textureType, VkInstance_T* pInstance)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 8);
+	return FSteamVRInputRuntime::ResolveSystem()->GetOutputDevice(pnDevice, textureType, pInstance);
+}
+
+bool FSteamVRCountingSystem::IsDisplayOnDesktop()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 9);
+	return FSteamVRInputRuntime::ResolveSystem()->IsDisplayOnDesktop();
+}
+
+bool FSteamVRCountingSystem::SetDisplayVisibility(bool bIsVisibleOnDesktop)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 10);
+	return FSteamVRInputRuntime::ResolveSystem()->SetDisplayVisibility(bIsVisibleOnDesktop);
+}
+
+void FSteamVRCountingSystem::GetDeviceToAbsoluteTrackingPose(ETrackingUniverseOrigin eOrigin, float fPredictedSecondsToPhotonsFromNow, TrackedDevicePose_t* pTrackedDevicePoseArray, uint32_t unTrackedDevicePoseArrayCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 11);
+	return FSteamVRInputRuntime::ResolveSystem()->GetDeviceToAbsoluteTrackingPose(eOrigin, fPredictedSecondsToPhotonsFromNow, pTrackedDevicePoseArray, unTrackedDevicePoseArrayCount);
+}
+
+void FSteamVRCountingSystem::ResetSeatedZeroPose()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 12);
+	return FSteamVRInputRuntime::ResolveSystem()->ResetSeatedZeroPose();
+}
+
+HmdMatrix34_t FSteamVRCountingSystem::GetSeatedZeroPoseToStandingAbsoluteTrackingPose()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 13);
+	return FSteamVRInputRuntime::ResolveSystem()->GetSeatedZeroPoseToStandingAbsoluteTrackingPose();
+}
+
+HmdMatrix34_t FSteamVRCountingSystem::GetRawZeroPoseToStandingAbsoluteTrackingPose()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 14);
+	return FSteamVRInputRuntime::ResolveSystem()->GetRawZeroPoseToStandingAbsoluteTrackingPose();
+}
+
+uint32_t FSteamVRCountingSystem::GetSortedTrackedDeviceIndicesOfClass(ETrackedDeviceClass eTrackedDeviceClass, TrackedDeviceIndex_t* punTrackedDeviceIndexArray, uint32_t unTrackedDeviceIndexArrayCount, TrackedDeviceIndex_t unRelativeToTrackedDeviceIndex)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 15);
+	return FSteamVRInputRuntime::ResolveSystem()->GetSortedTrackedDeviceIndicesOfClass(eTrackedDeviceClass, punTrackedDeviceIndexArray, unTrackedDeviceIndexArrayCount, unRelativeToTrackedDeviceIndex);
+}
+
+EDeviceActivityLevel FSteamVRCountingSystem::GetTrackedDeviceActivityLevel(TrackedDeviceIndex_t unDeviceId)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 16);
+	return FSteamVRInputRuntime::ResolveSystem()->GetTrackedDeviceActivityLevel(unDeviceId);
+}
+
+void FSteamVRCountingSystem::ApplyTransform(TrackedDevicePose_t* pOutputPose, const TrackedDevicePose_t* pTrackedDevicePose, const HmdMatrix34_t* pTransform)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 17);
+	return FSteamVRInputRuntime::ResolveSystem()->ApplyTransform(pOutputPose, pTrackedDevicePose, pTransform);
+}
+
+TrackedDeviceIndex_t FSteamVRCountingSystem::GetTrackedDeviceIndexForControllerRole(ETrackedControllerRole unDeviceType)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 18);
+	return FSteamVRInputRuntime::ResolveSystem()->GetTrackedDeviceIndexForControllerRole(unDeviceType);
+}
+
+ETrackedControllerRole FSteamVRCountingSystem::GetControllerRoleForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 19);
+	return FSteamVRInputRuntime::ResolveSystem()->GetControllerRoleForTrackedDeviceIndex(unDeviceIndex);
+}
+
+ETrackedDeviceClass FSteamVRCountingSystem::GetTrackedDeviceClass(TrackedDeviceIndex_t unDeviceIndex)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 20);
+	return FSteamVRInputRuntime::ResolveSystem()->GetTrackedDeviceClass(unDeviceIndex);
+}
+
+bool FSteamVRCountingSystem::IsTrackedDeviceConnected(TrackedDeviceIndex_t unDeviceIndex)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 21);
+	return FSteamVRInputRuntime::ResolveSystem()->IsTrackedDeviceConnected(unDeviceIndex);
+}
+
+bool FSteamVRCountingSystem::GetBoolTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 22);
+	return FSteamVRInputRuntime::ResolveSystem()->GetBoolTrackedDeviceProperty(unDeviceIndex, prop, pError);
+}
+
+float FSteamVRCountingSystem::GetFloatTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 23);
+	return FSteamVRInputRuntime::ResolveSystem()->GetFloatTrackedDeviceProperty(unDeviceIndex, prop, pError);
+}
+
+int32_t FSteamVRCountingSystem::GetInt32TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 24);
+	return FSteamVRInputRuntime::ResolveSystem()->GetInt32TrackedDeviceProperty(unDeviceIndex, prop, pError);
+}
+
+uint64_t FSteamVRCountingSystem::GetUint64TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 25);
+	return FSteamVRInputRuntime::ResolveSystem()->GetUint64TrackedDeviceProperty(unDeviceIndex, prop, pError);
+}
+
+HmdMatrix34_t FSteamVRCountingSystem::GetMatrix34TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 26);
+	return FSteamVRInputRuntime::ResolveSystem()->GetMatrix34TrackedDeviceProperty(unDeviceIndex, prop, pError);
+}
+
+uint32_t FSteamVRCountingSystem::GetArrayTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, PropertyTypeTag_t propType, void* pBuffer, uint32_t unBufferSize, ETrackedPropertyError* pError)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 27);
+	return FSteamVRInputRuntime::ResolveSystem()->GetArrayTrackedDeviceProperty(unDeviceIndex, prop, propType, pBuffer, unBufferSize, pError);
+}
+
+uint32_t FSteamVRCountingSystem::GetStringTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, char* pchValue, uint32_t unBufferSize, ETrackedPropertyError* pError)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 28);
+	return FSteamVRInputRuntime::ResolveSystem()->GetStringTrackedDeviceProperty(unDeviceIndex, prop, pchValue, unBufferSize, pError);
+}
+
+const char* FSteamVRCountingSystem::GetPropErrorNameFromEnum(ETrackedPropertyError error)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 29);
+	return FSteamVRInputRuntime::ResolveSystem()->GetPropErrorNameFromEnum(error);
+}
+
+bool FSteamVRCountingSystem::PollNextEvent(VREvent_t* pEvent, uint32_t uncbVREvent)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 30);
+	return FSteamVRInputRuntime::ResolveSystem()->PollNextEvent(pEvent, uncbVREvent);
+}
+
+bool FSteamVRCountingSystem::PollNextEventWithPose(ETrackingUniverseOrigin eOrigin, VREvent_t* pEvent, uint32_t uncbVREvent, TrackedDevicePose_t* pTrackedDevicePose)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 31);
+	return FSteamVRInputRuntime::ResolveSystem()->PollNextEventWithPose(eOrigin, pEvent, uncbVREvent, pTrackedDevicePose);
+}
+
+const char* FSteamVRCountingSystem::GetEventTypeNameFromEnum(EVREventType eType)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 32);
+	return FSteamVRInputRuntime::ResolveSystem()->GetEventTypeNameFromEnum(eType);
+}
+
+HiddenAreaMesh_t FSteamVRCountingSystem::GetHiddenAreaMesh(EVREye eEye, EHiddenAreaMeshType type)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 33);
+	return FSteamVRInputRuntime::ResolveSystem()->GetHiddenAreaMesh(eEye, type);
+}
+
+bool FSteamVRCountingSystem::GetControllerState(TrackedDeviceIndex_t unControllerDeviceIndex, VRControllerState_t* pControllerState, uint32_t unControllerStateSize)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 34);
+	return FSteamVRInputRuntime::ResolveSystem()->GetControllerState(unControllerDeviceIndex, pControllerState, unControllerStateSize);
+}
+
+bool FSteamVRCountingSystem::GetControllerStateWithPose(ETrackingUniverseOrigin eOrigin, TrackedDeviceIndex_t unControllerDeviceIndex, VRControllerState_t* pControllerState, uint32_t unControllerStateSize, TrackedDevicePose_t* pTrackedDevicePose)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 35);
+	return FSteamVRInputRuntime::ResolveSystem()->GetControllerStateWithPose(eOrigin, unControllerDeviceIndex, pControllerState, unControllerStateSize, pTrackedDevicePose);
+}
+
+void FSteamVRCountingSystem::TriggerHapticPulse(TrackedDeviceIndex_t unControllerDeviceIndex, uint32_t unAxisId, unsigned short usDurationMicroSec)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 36);
+	return FSteamVRInputRuntime::ResolveSystem()->TriggerHapticPulse(unControllerDeviceIndex, unAxisId, usDurationMicroSec);
+}
+
+const char* FSteamVRCountingSystem::GetButtonIdNameFromEnum(EVRButtonId eButtonId)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 37);
+	return FSteamVRInputRuntime::ResolveSystem()->GetButtonIdNameFromEnum(eButtonId);
+}
+
+const char* FSteamVRCountingSystem::GetControllerAxisTypeNameFromEnum(EVRControllerAxisType eAxisType)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 38);
+	return FSteamVRInputRuntime::ResolveSystem()->GetControllerAxisTypeNameFromEnum(eAxisType);
+}
+
+bool FSteamVRCountingSystem::IsInputAvailable()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 39);
+	return FSteamVRInputRuntime::ResolveSystem()->IsInputAvailable();
+}
+
+bool FSteamVRCountingSystem::IsSteamVRDrawingControllers()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 40);
+	return FSteamVRInputRuntime::ResolveSystem()->IsSteamVRDrawingControllers();
+}
+
+bool FSteamVRCountingSystem::ShouldApplicationPause()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 41);
+	return FSteamVRInputRuntime::ResolveSystem()->ShouldApplicationPause();
+}
+
+bool FSteamVRCountingSystem::ShouldApplicationReduceRenderingWork()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 42);
+	return FSteamVRInputRuntime::ResolveSystem()->ShouldApplicationReduceRenderingWork();
+}
+
+EVRFirmwareError FSteamVRCountingSystem::PerformFirmwareUpdate(TrackedDeviceIndex_t unDeviceIndex)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 43);
+	return FSteamVRInputRuntime::ResolveSystem()->PerformFirmwareUpdate(unDeviceIndex);
+}
+
+void FSteamVRCountingSystem::AcknowledgeQuit_Exiting()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 44);
+	return FSteamVRInputRuntime::ResolveSystem()->AcknowledgeQuit_Exiting();
+}
+
+uint32_t FSteamVRCountingSystem::GetAppContainerFilePaths(char* pchBuffer, uint32_t unBufferSize)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 45);
+	return FSteamVRInputRuntime::ResolveSystem()->GetAppContainerFilePaths(pchBuffer, unBufferSize);
+}
+
+const char* FSteamVRCountingSystem::GetRuntimeVersion()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_System, 46);
+	return FSteamVRInputRuntime::ResolveSystem()->GetRuntimeVersion();
+}
+
+EVRInputError FSteamVRCountingInput::SetActionManifestPath(const char* pchActionManifestPath)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 0);
+	return FSteamVRInputRuntime::ResolveInput()->SetActionManifestPath(pchActionManifestPath);
+}
+
+EVRInputError FSteamVRCountingInput::GetActionSetHandle(const char* pchActionSetName, VRActionSetHandle_t* pHandle)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 1);
+	return FSteamVRInputRuntime::ResolveInput()->GetActionSetHandle(pchActionSetName, pHandle);
+}
+
+EVRInputError FSteamVRCountingInput::GetActionHandle(const char* pchActionName, VRActionHandle_t* pHandle)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 2);
+	return FSteamVRInputRuntime::ResolveInput()->GetActionHandle(pchActionName, pHandle);
+}
+
+EVRInputError FSteamVRCountingInput::GetInputSourceHandle(const char* pchInputSourcePath, VRInputValueHandle_t* pHandle)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 3);
+	return FSteamVRInputRuntime::ResolveInput()->GetInputSourceHandle(pchInputSourcePath, pHandle);
+}
+
+EVRInputError FSteamVRCountingInput::UpdateActionState(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 4);
+	return FSteamVRInputRuntime::ResolveInput()->UpdateActionState(pSets, unSizeOfVRSelectedActionSet_t, unSetCount);
+}
+
+EVRInputError FSteamVRCountingInput::GetDigitalActionData(VRActionHandle_t action, InputDigitalActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 5);
+	return FSteamVRInputRuntime::ResolveInput()->GetDigitalActionData(action, pActionData, unActionDataSize, ulRestrictToDevice);
+}
+
+EVRInputError FSteamVRCountingInput::GetAnalogActionData(VRActionHandle_t action, InputAnalogActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 6);
+	return FSteamVRInputRuntime::ResolveInput()->GetAnalogActionData(action, pActionData, unActionDataSize, ulRestrictToDevice);
+}
+
+EVRInputError FSteamVRCountingInput::GetPoseActionDataRelativeToNow(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, float fPredictedSecondsFromNow, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 7);
+	return FSteamVRInputRuntime::ResolveInput()->GetPoseActionDataRelativeToNow(action, eOrigin, fPredictedSecondsFromNow, pActionData, unActionDataSize, ulRestrictToDevice);
+}
+
+EVRInputError FSteamVRCountingInput::GetPoseActionDataForNextFrame(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 8);
+	return FSteamVRInputRuntime::ResolveInput()->GetPoseActionDataForNextFrame(action, eOrigin, pActionData, unActionDataSize, ulRestrictToDevice);
+}
+
+EVRInputError FSteamVRCountingInput::GetSkeletalActionData(VRActionHandle_t action, InputSkeletalActionData_t* pActionData, uint32_t unActionDataSize)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 9);
+	return FSteamVRInputRuntime::ResolveInput()->GetSkeletalActionData(action, pActionData, unActionDataSize);
+}
+
+EVRInputError FSteamVRCountingInput::GetBoneCount(VRActionHandle_t action, uint32_t* pBoneCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 10);
+	return FSteamVRInputRuntime::ResolveInput()->GetBoneCount(action, pBoneCount);
+}
+
+EVRInputError FSteamVRCountingInput::GetBoneHierarchy(VRActionHandle_t action, BoneIndex_t* pParentIndices, uint32_t unIndexArayCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 11);
+	return FSteamVRInputRuntime::ResolveInput()->GetBoneHierarchy(action, pParentIndices, unIndexArayCount);
+}
+
+EVRInputError FSteamVRCountingInput::GetBoneName(VRActionHandle_t action, BoneIndex_t nBoneIndex, char* pchBoneName, uint32_t unNameBufferSize)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 12);
+	return FSteamVRInputRuntime::ResolveInput()->GetBoneName(action, nBoneIndex, pchBoneName, unNameBufferSize);
+}
+
+EVRInputError FSteamVRCountingInput::GetSkeletalReferenceTransforms(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalReferencePose eReferencePose, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 13);
+	return FSteamVRInputRuntime::ResolveInput()->GetSkeletalReferenceTransforms(action, eTransformSpace, eReferencePose, pTransformArray, unTransformArrayCount);
+}
+
+EVRInputError FSteamVRCountingInput::GetSkeletalTrackingLevel(VRActionHandle_t action, EVRSkeletalTrackingLevel* pSkeletalTrackingLevel)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 14);
+	return FSteamVRInputRuntime::ResolveInput()->GetSkeletalTrackingLevel(action, pSkeletalTrackingLevel);
+}
+
+EVRInputError FSteamVRCountingInput::GetSkeletalBoneData(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalMotionRange eMotionRange, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 15);
+	return FSteamVRInputRuntime::ResolveInput()->GetSkeletalBoneData(action, eTransformSpace, eMotionRange, pTransformArray, unTransformArrayCount);
+}
+
+EVRInputError FSteamVRCountingInput::GetSkeletalSummaryData(VRActionHandle_t action, EVRSummaryType eSummaryType, VRSkeletalSummaryData_t* pSkeletalSummaryData)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 16);
+	return FSteamVRInputRuntime::ResolveInput()->GetSkeletalSummaryData(action, eSummaryType, pSkeletalSummaryData);
+}
+
+EVRInputError FSteamVRCountingInput::GetSkeletalBoneDataCompressed(VRActionHandle_t action, EVRSkeletalMotionRange eMotionRange, void* pvCompressedData, uint32_t unCompressedSize, uint32_t* punRequiredCompressedSize)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 17);
+	return FSteamVRInputRuntime::ResolveInput()->GetSkeletalBoneDataCompressed(action, eMotionRange, pvCompressedData, unCompressedSize, punRequiredCompressedSize);
+}
+
+EVRInputError FSteamVRCountingInput::DecompressSkeletalBoneData(const void* pvCompressedBuffer, uint32_t unCompressedBufferSize, EVRSkeletalTransformSpace eTransformSpace, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 18);
+	return FSteamVRInputRuntime::ResolveInput()->DecompressSkeletalBoneData(pvCompressedBuffer, unCompressedBufferSize, eTransformSpace, pTransformArray, unTransformArrayCount);
+}
+
+EVRInputError FSteamVRCountingInput::TriggerHapticVibrationAction(VRActionHandle_t action, float fStartSecondsFromNow, float fDurationSeconds, float fFrequency, float fAmplitude, VRInputValueHandle_t ulRestrictToDevice)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 19);
+	return FSteamVRInputRuntime::ResolveInput()->TriggerHapticVibrationAction(action, fStartSecondsFromNow, fDurationSeconds, fFrequency, fAmplitude, ulRestrictToDevice);
+}
+
+EVRInputError FSteamVRCountingInput::GetActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t digitalActionHandle, VRInputValueHandle_t* originsOut, uint32_t originOutCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 20);
+	return FSteamVRInputRuntime::ResolveInput()->GetActionOrigins(actionSetHandle, digitalActionHandle, originsOut, originOutCount);
+}
+
+EVRInputError FSteamVRCountingInput::GetOriginLocalizedName(VRInputValueHandle_t origin, char* pchNameArray, uint32_t unNameArraySize, int32_t unStringSectionsToInclude)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 21);
+	return FSteamVRInputRuntime::ResolveInput()->GetOriginLocalizedName(origin, pchNameArray, unNameArraySize, unStringSectionsToInclude);
+}
+
+EVRInputError FSteamVRCountingInput::GetOriginTrackedDeviceInfo(VRInputValueHandle_t origin, InputOriginInfo_t* pOriginInfo, uint32_t unOriginInfoSize)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 22);
+	return FSteamVRInputRuntime::ResolveInput()->GetOriginTrackedDeviceInfo(origin, pOriginInfo, unOriginInfoSize);
+}
+
+EVRInputError FSteamVRCountingInput::GetActionBindingInfo(VRActionHandle_t action, InputBindingInfo_t* pOriginInfo, uint32_t unBindingInfoSize, uint32_t unBindingInfoCount, uint32_t* punReturnedBindingInfoCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 23);
+	return FSteamVRInputRuntime::ResolveInput()->GetActionBindingInfo(action, pOriginInfo, unBindingInfoSize, unBindingInfoCount, punReturnedBindingInfoCount);
+}
+
+EVRInputError FSteamVRCountingInput::ShowActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t ulActionHandle)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 24);
+	return FSteamVRInputRuntime::ResolveInput()->ShowActionOrigins(actionSetHandle, ulActionHandle);
+}
+
+EVRInputError FSteamVRCountingInput::ShowBindingsForActionSet(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount, VRInputValueHandle_t originToHighlight)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 25);
+	return FSteamVRInputRuntime::ResolveInput()->ShowBindingsForActionSet(pSets, unSizeOfVRSelectedActionSet_t, unSetCount, originToHighlight);
+}
+
+bool FSteamVRCountingInput::IsUsingLegacyInput()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 26);
+	return FSteamVRInputRuntime::ResolveInput()->IsUsingLegacyInput();
+}
+
+EVRInputError FSteamVRCountingInput::OpenBindingUI(const char* pchAppKey, VRActionSetHandle_t ulActionSetHandle, VRInputValueHandle_t ulDeviceHandle, bool bShowOnDesktop)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Input, 27);
+	return FSteamVRInputRuntime::ResolveInput()->OpenBindingUI(pchAppKey, ulActionSetHandle, ulDeviceHandle, bShowOnDesktop);
+}
+
+void FSteamVRCountingCompositor::SetTrackingSpace(ETrackingUniverseOrigin eOrigin)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 0);
+	return FSteamVRInputRuntime::ResolveCompositor()->SetTrackingSpace(eOrigin);
+}
+
+ETrackingUniverseOrigin FSteamVRCountingCompositor::GetTrackingSpace()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 1);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetTrackingSpace();
+}
+
+EVRCompositorError FSteamVRCountingCompositor::WaitGetPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 2);
+	return FSteamVRInputRuntime::ResolveCompositor()->WaitGetPoses(pRenderPoseArray, unRenderPoseArrayCount, pGamePoseArray, unGamePoseArrayCount);
+}
+
+EVRCompositorError FSteamVRCountingCompositor::GetLastPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 3);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetLastPoses(pRenderPoseArray, unRenderPoseArrayCount, pGamePoseArray, unGamePoseArrayCount);
+}
+
+EVRCompositorError FSteamVRCountingCompositor::GetLastPoseForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex, TrackedDevicePose_t* pOutputPose, TrackedDevicePose_t* pOutputGamePose)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 4);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetLastPoseForTrackedDeviceIndex(unDeviceIndex, pOutputPose, pOutputGamePose);
+}
+
+EVRCompositorError FSteamVRCountingCompositor::Submit(EVREye eEye, const Texture_t* pTexture, const VRTextureBounds_t* pBounds, EVRSubmitFlags nSubmitFlags)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 5);
+	return FSteamVRInputRuntime::ResolveCompositor()->Submit(eEye, pTexture, pBounds, nSubmitFlags);
+}
+
+void FSteamVRCountingCompositor::ClearLastSubmittedFrame()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 6);
+	return FSteamVRInputRuntime::ResolveCompositor()->ClearLastSubmittedFrame();
+}
+
+void FSteamVRCountingCompositor::PostPresentHandoff()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 7);
+	return FSteamVRInputRuntime::ResolveCompositor()->PostPresentHandoff();
+}
+
+bool FSteamVRCountingCompositor::GetFrameTiming(Compositor_FrameTiming* pTiming, uint32_t unFramesAgo)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 8);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetFrameTiming(pTiming, unFramesAgo);
+}
+
+uint32_t FSteamVRCountingCompositor::GetFrameTimings(Compositor_FrameTiming* pTiming, uint32_t nFrames)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 9);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetFrameTimings(pTiming, nFrames);
+}
+
+float FSteamVRCountingCompositor::GetFrameTimeRemaining()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 10);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetFrameTimeRemaining();
+}
+
+void FSteamVRCountingCompositor::GetCumulativeStats(Compositor_CumulativeStats* pStats, uint32_t nStatsSizeInBytes)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 11);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetCumulativeStats(pStats, nStatsSizeInBytes);
+}
+
+void FSteamVRCountingCompositor::FadeToColor(float fSeconds, float fRed, float fGreen, float fBlue, float fAlpha, bool bBackground)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 12);
+	return FSteamVRInputRuntime::ResolveCompositor()->FadeToColor(fSeconds, fRed, fGreen, fBlue, fAlpha, bBackground);
+}
+
+HmdColor_t FSteamVRCountingCompositor::GetCurrentFadeColor(bool bBackground)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 13);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetCurrentFadeColor(bBackground);
+}
+
+void FSteamVRCountingCompositor::FadeGrid(float fSeconds, bool bFadeIn)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 14);
+	return FSteamVRInputRuntime::ResolveCompositor()->FadeGrid(fSeconds, bFadeIn);
+}
+
+float FSteamVRCountingCompositor::GetCurrentGridAlpha()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 15);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetCurrentGridAlpha();
+}
+
+EVRCompositorError FSteamVRCountingCompositor::SetSkyboxOverride(const Texture_t* pTextures, uint32_t unTextureCount)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 16);
+	return FSteamVRInputRuntime::ResolveCompositor()->SetSkyboxOverride(pTextures, unTextureCount);
+}
+
+void FSteamVRCountingCompositor::ClearSkyboxOverride()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 17);
+	return FSteamVRInputRuntime::ResolveCompositor()->ClearSkyboxOverride();
+}
+
+void FSteamVRCountingCompositor::CompositorBringToFront()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 18);
+	return FSteamVRInputRuntime::ResolveCompositor()->CompositorBringToFront();
+}
+
+void FSteamVRCountingCompositor::CompositorGoToBack()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 19);
+	return FSteamVRInputRuntime::ResolveCompositor()->CompositorGoToBack();
+}
+
+void FSteamVRCountingCompositor::CompositorQuit()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 20);
+	return FSteamVRInputRuntime::ResolveCompositor()->CompositorQuit();
+}
+
+bool FSteamVRCountingCompositor::IsFullscreen()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 21);
+	return FSteamVRInputRuntime::ResolveCompositor()->IsFullscreen();
+}
+
+uint32_t FSteamVRCountingCompositor::GetCurrentSceneFocusProcess()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 22);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetCurrentSceneFocusProcess();
+}
+
+uint32_t FSteamVRCountingCompositor::GetLastFrameRenderer()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 23);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetLastFrameRenderer();
+}
+
+bool FSteamVRCountingCompositor::CanRenderScene()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 24);
+	return FSteamVRInputRuntime::ResolveCompositor()->CanRenderScene();
+}
+
+void FSteamVRCountingCompositor::ShowMirrorWindow()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 25);
+	return FSteamVRInputRuntime::ResolveCompositor()->ShowMirrorWindow();
+}
+
+void FSteamVRCountingCompositor::HideMirrorWindow()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 26);
+	return FSteamVRInputRuntime::ResolveCompositor()->HideMirrorWindow();
+}
+
+bool FSteamVRCountingCompositor::IsMirrorWindowVisible()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 27);
+	return FSteamVRInputRuntime::ResolveCompositor()->IsMirrorWindowVisible();
+}
+
+void FSteamVRCountingCompositor::CompositorDumpImages()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 28);
+	return FSteamVRInputRuntime::ResolveCompositor()->CompositorDumpImages();
+}
+
+bool FSteamVRCountingCompositor::ShouldAppRenderWithLowResources()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 29);
+	return FSteamVRInputRuntime::ResolveCompositor()->ShouldAppRenderWithLowResources();
+}
+
+void FSteamVRCountingCompositor::ForceInterleavedReprojectionOn(bool bOverride)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 30);
+	return FSteamVRInputRuntime::ResolveCompositor()->ForceInterleavedReprojectionOn(bOverride);
+}
+
+void FSteamVRCountingCompositor::ForceReconnectProcess()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 31);
+	return FSteamVRInputRuntime::ResolveCompositor()->ForceReconnectProcess();
+}
+
+void FSteamVRCountingCompositor::SuspendRendering(bool bSuspend)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 32);
+	return FSteamVRInputRuntime::ResolveCompositor()->SuspendRendering(bSuspend);
+}
+
+EVRCompositorError FSteamVRCountingCompositor::GetMirrorTextureD3D11(EVREye eEye, void* pD3D11DeviceOrResource, void* *ppD3D11ShaderResourceView)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 33);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetMirrorTextureD3D11(eEye, pD3D11DeviceOrResource, ppD3D11ShaderResourceView);
+}
+
+void FSteamVRCountingCompositor::ReleaseMirrorTextureD3D11(void* pD3D11ShaderResourceView)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 34);
+	return FSteamVRInputRuntime::ResolveCompositor()->ReleaseMirrorTextureD3D11(pD3D11ShaderResourceView);
+}
+
+EVRCompositorError FSteamVRCountingCompositor::GetMirrorTextureGL(EVREye eEye, glUInt_t* pglTextureId, glSharedTextureHandle_t* pglSharedTextureHandle)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 35);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetMirrorTextureGL(eEye, pglTextureId, pglSharedTextureHandle);
+}
+
+bool FSteamVRCountingCompositor::ReleaseSharedGLTexture(glUInt_t glTextureId, glSharedTextureHandle_t glSharedTextureHandle)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 36);
+	return FSteamVRInputRuntime::ResolveCompositor()->ReleaseSharedGLTexture(glTextureId, glSharedTextureHandle);
+}
+
+void FSteamVRCountingCompositor::LockGLSharedTextureForAccess(glSharedTextureHandle_t glSharedTextureHandle)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 37);
+	return FSteamVRInputRuntime::ResolveCompositor()->LockGLSharedTextureForAccess(glSharedTextureHandle);
+}
+
+void FSteamVRCountingCompositor::UnlockGLSharedTextureForAccess(glSharedTextureHandle_t glSharedTextureHandle)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 38);
+	return FSteamVRInputRuntime::ResolveCompositor()->UnlockGLSharedTextureForAccess(glSharedTextureHandle);
+}
+
+uint32_t FSteamVRCountingCompositor::GetVulkanInstanceExtensionsRequired(char* pchValue, uint32_t unBufferSize)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 39);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetVulkanInstanceExtensionsRequired(pchValue, unBufferSize);
+}
+
+uint32_t FSteamVRCountingCompositor::GetVulkanDeviceExtensionsRequired(VkPhysicalDevice_T* pPhysicalDevice, char* pchValue, uint32_t unBufferSize)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 40);
+	return FSteamVRInputRuntime::ResolveCompositor()->GetVulkanDeviceExtensionsRequired(pPhysicalDevice, pchValue, unBufferSize);
+}
+
+void FSteamVRCountingCompositor::SetExplicitTimingMode(EVRCompositorTimingMode eTimingMode)
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 41);
+	return FSteamVRInputRuntime::ResolveCompositor()->SetExplicitTimingMode(eTimingMode);
+}
+
+EVRCompositorError FSteamVRCountingCompositor::SubmitExplicitTimingData()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 42);
+	return FSteamVRInputRuntime::ResolveCompositor()->SubmitExplicitTimingData();
+}
+
+bool FSteamVRCountingCompositor::IsMotionSmoothingEnabled()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 43);
+	return FSteamVRInputRuntime::ResolveCompositor()->IsMotionSmoothingEnabled();
+}
+
+bool FSteamVRCountingCompositor::IsMotionSmoothingSupported()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 44);
+	return FSteamVRInputRuntime::ResolveCompositor()->IsMotionSmoothingSupported();
+}
+
+bool FSteamVRCountingCompositor::IsCurrentSceneFocusAppLoading()
+{
+	FSteamVRInputCallCounter::Count(VRInterface_Compositor, 45);
+	return FSteamVRInputRuntime::ResolveCompositor()->IsCurrentSceneFocusAppLoading();
+}
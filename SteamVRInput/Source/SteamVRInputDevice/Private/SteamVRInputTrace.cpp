@@ -0,0 +1,145 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "SteamVRInputTrace.h"
+#include "SteamVRInputStats.h"
+
+#if STEAMVR_INPUT_TRACE_CHANNEL
+
+UE_TRACE_CHANNEL_DEFINE(SteamVRInputChannel)
+
+UE_TRACE_EVENT_BEGIN(SteamVRInput, DigitalAction)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, ActionHandle)
+	UE_TRACE_EVENT_FIELD(float, UpdateTime)
+	UE_TRACE_EVENT_FIELD(uint8, State)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SteamVRInput, AnalogAction)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, ActionHandle)
+	UE_TRACE_EVENT_FIELD(float, UpdateTime)
+	UE_TRACE_EVENT_FIELD(float, X)
+	UE_TRACE_EVENT_FIELD(float, Y)
+	UE_TRACE_EVENT_FIELD(float, Z)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SteamVRInput, Pose)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, ActionHandle)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+	UE_TRACE_EVENT_FIELD(float, PredictedSecondsFromNow)
+	UE_TRACE_EVENT_FIELD(float, X)
+	UE_TRACE_EVENT_FIELD(float, Y)
+	UE_TRACE_EVENT_FIELD(float, Z)
+	UE_TRACE_EVENT_FIELD(uint8, TrackingResult)
+	UE_TRACE_EVENT_FIELD(uint8, Valid)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SteamVRInput, Haptic)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint8, HandIndex)
+	UE_TRACE_EVENT_FIELD(float, StartSecondsFromNow)
+	UE_TRACE_EVENT_FIELD(float, DurationSeconds)
+	UE_TRACE_EVENT_FIELD(float, Frequency)
+	UE_TRACE_EVENT_FIELD(float, Amplitude)
+UE_TRACE_EVENT_END()
+
+#else
+
+bool FSteamVRInputTrace::bIsEnabled = false;
+FAutoConsoleVariableRef FSteamVRInputTrace::EnabledVariable(
+	TEXT("steamvr.input.trace"),
+	FSteamVRInputTrace::bIsEnabled,
+	TEXT("Record SteamVR input events (digital transitions, analog changes, pose samples and haptic calls) as events of the SteamVRInput CSV category while capturing"));
+
+#endif
+
+void FSteamVRInputTrace::TraceDigitalAction(VRActionHandle_t ActionHandle, const FName& ActionName, bool bState, float UpdateTime)
+{
+#if STEAMVR_INPUT_TRACE_CHANNEL
+	UE_TRACE_LOG(SteamVRInput, DigitalAction, SteamVRInputChannel)
+		<< DigitalAction.Cycle(FPlatformTime::Cycles64())
+		<< DigitalAction.ActionHandle(ActionHandle)
+		<< DigitalAction.UpdateTime(UpdateTime)
+		<< DigitalAction.State(bState ? 1 : 0);
+#else
+	CSV_EVENT(SteamVRInput, TEXT("Digital %s %s %.4f"), *ActionName.ToString(), bState ? TEXT("Pressed") : TEXT("Released"), UpdateTime);
+#endif
+}
+
+void FSteamVRInputTrace::TraceAnalogAction(VRActionHandle_t ActionHandle, const FName& ActionName, const FVector& Value, float UpdateTime)
+{
+#if STEAMVR_INPUT_TRACE_CHANNEL
+	UE_TRACE_LOG(SteamVRInput, AnalogAction, SteamVRInputChannel)
+		<< AnalogAction.Cycle(FPlatformTime::Cycles64())
+		<< AnalogAction.ActionHandle(ActionHandle)
+		<< AnalogAction.UpdateTime(UpdateTime)
+		<< AnalogAction.X(Value.X)
+		<< AnalogAction.Y(Value.Y)
+		<< AnalogAction.Z(Value.Z);
+#else
+	CSV_EVENT(SteamVRInput, TEXT("Analog %s %.3f %.3f %.3f %.4f"), *ActionName.ToString(), Value.X, Value.Y, Value.Z, UpdateTime);
+#endif
+}
+
+void FSteamVRInputTrace::TracePose(VRActionHandle_t ActionHandle, const InputPoseActionData_t& PoseData, float PredictedSecondsFromNow)
+{
+	const HmdMatrix34_t& Matrix = PoseData.pose.mDeviceToAbsoluteTracking;
+#if STEAMVR_INPUT_TRACE_CHANNEL
+	UE_TRACE_LOG(SteamVRInput, Pose, SteamVRInputChannel)
+		<< Pose.Cycle(FPlatformTime::Cycles64())
+		<< Pose.ActionHandle(ActionHandle)
+		<< Pose.ThreadId(FPlatformTLS::GetCurrentThreadId())
+		<< Pose.PredictedSecondsFromNow(PredictedSecondsFromNow)
+		<< Pose.X(Matrix.m[0][3])
+		<< Pose.Y(Matrix.m[1][3])
+		<< Pose.Z(Matrix.m[2][3])
+		<< Pose.TrackingResult((uint8)PoseData.pose.eTrackingResult)
+		<< Pose.Valid(PoseData.pose.bPoseIsValid ? 1 : 0);
+#else
+	CSV_EVENT(SteamVRInput, TEXT("Pose %llu %s %.4f %.3f %.3f %.3f %s"), ActionHandle, IsInGameThread() ? TEXT("Game") : TEXT("Render"),
+		PredictedSecondsFromNow, Matrix.m[0][3], Matrix.m[1][3], Matrix.m[2][3], PoseData.pose.bPoseIsValid ? TEXT("Valid") : TEXT("Invalid"));
+#endif
+}
+
+void FSteamVRInputTrace::TraceHaptic(int32 HandIndex, float StartSecondsFromNow, float DurationSeconds, float Frequency, float Amplitude)
+{
+#if STEAMVR_INPUT_TRACE_CHANNEL
+	UE_TRACE_LOG(SteamVRInput, Haptic, SteamVRInputChannel)
+		<< Haptic.Cycle(FPlatformTime::Cycles64())
+		<< Haptic.HandIndex((uint8)HandIndex)
+		<< Haptic.StartSecondsFromNow(StartSecondsFromNow)
+		<< Haptic.DurationSeconds(DurationSeconds)
+		<< Haptic.Frequency(Frequency)
+		<< Haptic.Amplitude(Amplitude);
+#else
+	CSV_EVENT(SteamVRInput, TEXT("Haptic %s %.4f %.4f %.1f %.3f"), HandIndex == 0 ? TEXT("Left") : TEXT("Right"), StartSecondsFromNow, DurationSeconds, Frequency, Amplitude);
+#endif
+}
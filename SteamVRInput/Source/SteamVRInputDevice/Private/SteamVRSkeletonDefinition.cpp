@@ -144,6 +144,11 @@ namespace SteamVRSkeleton
 		return g_BoneParentMap[nBoneIndex];
 	}
 
+	const int32* GetParentIndices()
+	{
+		return g_BoneParentMap;
+	}
+
 	int32 GetChildCount(int32 nBoneIndex)
 	{
 		check(nBoneIndex >= 0 && nBoneIndex < GetBoneCount());
@@ -158,4 +163,24 @@ namespace SteamVRSkeleton
 
 		return kBoneChildList[nBoneIndex][nChildIndex];
 	}
+
+	void CalcComponentSpaceTransforms(const FTransform* BoneTransformsLS, const int32* ParentIndices, int32 BoneCount, FTransform* OutBoneTransformsCS)
+	{
+		check(BoneTransformsLS != nullptr && ParentIndices != nullptr && OutBoneTransformsCS != nullptr);
+		check(BoneTransformsLS != OutBoneTransformsCS);
+
+		for (int32 BoneIndex = 0; BoneIndex < BoneCount; ++BoneIndex)
+		{
+			const int32 ParentIndex = ParentIndices[BoneIndex];
+			if (ParentIndex != -1)
+			{
+				checkSlow(ParentIndex < BoneIndex);
+				OutBoneTransformsCS[BoneIndex] = BoneTransformsLS[BoneIndex] * OutBoneTransformsCS[ParentIndex];
+			}
+			else
+			{
+				OutBoneTransformsCS[BoneIndex] = BoneTransformsLS[BoneIndex];
+			}
+		}
+	}
 }
@@ -30,6 +30,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "SteamVRTrackingRefComponent.h"
 #include "../../OpenVRSDK/headers/openvr.h"
 #include "SteamVRInput.h"
+#include "SteamVRInputRuntime.h"
 
 using namespace vr;
 DEFINE_LOG_CATEGORY_STATIC(LogSteamVRTrackingRefComponent, Log, All);
@@ -48,7 +49,7 @@ bool USteamVRTrackingReferences::ShowTrackingReferences(UStaticMesh* TrackingRef
 		return false;
 	}
 
-	if (VRSystem() && VRCompositor())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRCompositor())
 	{
 		// Remove any existing tracking references in-world
 		HideTrackingReferences();
@@ -60,18 +61,18 @@ bool USteamVRTrackingReferences::ShowTrackingReferences(UStaticMesh* TrackingRef
 		// Find all SteamVR Tracking References
 		for (unsigned int id = 0; id < k_unMaxTrackedDeviceCount; ++id)
 		{
-			ETrackedDeviceClass trackedDeviceClass = VRSystem()->GetTrackedDeviceClass(id);
+			ETrackedDeviceClass trackedDeviceClass = FSteamVRInputRuntime::VRSystem()->GetTrackedDeviceClass(id);
 			
 			if (trackedDeviceClass == ETrackedDeviceClass::TrackedDeviceClass_TrackingReference)
 			{
 				// Extraneous call, used for Debugging
 				//char buf[k_unMaxPropertyStringSize];
-				//uint32 StringBytes = VRSystem()->GetStringTrackedDeviceProperty(id, ETrackedDeviceProperty::Prop_ModelNumber_String, buf, sizeof(buf));
+				//uint32 StringBytes = FSteamVRInputRuntime::VRSystem()->GetStringTrackedDeviceProperty(id, ETrackedDeviceProperty::Prop_ModelNumber_String, buf, sizeof(buf));
 				//FString stringCache = *FString(UTF8_TO_TCHAR(buf));
 				//UE_LOG(LogSteamVRTrackingRefComponent, Warning, TEXT("[TRACKING REFERENCE] Found the following tracking device: [%i] %s"), id, *stringCache);
 
 				TrackedDevicePose_t TrackedDevicePose = { 0 };
-				VRCompositor()->GetLastPoseForTrackedDeviceIndex(id, &TrackedDevicePose, nullptr);
+				FSteamVRInputRuntime::VRCompositor()->GetLastPoseForTrackedDeviceIndex(id, &TrackedDevicePose, nullptr);
 
 				// Get SteamVR Transform Matrix for this tracking reference
 				HmdMatrix34_t Matrix = TrackedDevicePose.mDeviceToAbsoluteTracking;
@@ -172,12 +173,12 @@ void USteamVRTrackingReferences::TickComponent(float DeltaTime, ELevelTick TickT
 	}
 
 	// Check for any newly activated tracked devices
-	if (VRSystem() && VRInput())
+	if (FSteamVRInputRuntime::VRSystem() && FSteamVRInputRuntime::VRInput())
 	{
 		// Find all SteamVR Tracking References
 		for (unsigned int id = 0; id < k_unMaxTrackedDeviceCount; ++id)
 		{
-			ETrackedDeviceClass TrackedDeviceClass = VRSystem()->GetTrackedDeviceClass(id);
+			ETrackedDeviceClass TrackedDeviceClass = FSteamVRInputRuntime::VRSystem()->GetTrackedDeviceClass(id);
 
 			if (TrackedDeviceClass != TrackedDeviceClass_Invalid && 
 				(TrackedDeviceClass == TrackedDeviceClass_Controller || 
@@ -201,7 +202,7 @@ void USteamVRTrackingReferences::TickComponent(float DeltaTime, ELevelTick TickT
 
 				// Get device model info
 				char buf[k_unMaxPropertyStringSize];
-				uint32 StringBytes = VRSystem()->GetStringTrackedDeviceProperty(id, ETrackedDeviceProperty::Prop_ModelNumber_String, buf, sizeof(buf));
+				uint32 StringBytes = FSteamVRInputRuntime::VRSystem()->GetStringTrackedDeviceProperty(id, ETrackedDeviceProperty::Prop_ModelNumber_String, buf, sizeof(buf));
 				FString DeviceModel = *FString(UTF8_TO_TCHAR(buf));
 
 				UE_LOG(LogSteamVRTrackingRefComponent, Warning, TEXT("Found device [%i] %s"), id, *DeviceModel);
@@ -212,14 +213,14 @@ void USteamVRTrackingReferences::TickComponent(float DeltaTime, ELevelTick TickT
 		for (int32 i = 0; i < ActiveTrackingDevices.Num(); i++)
 		{
 			// If a device is flagged as inactive but SteamVR reports it connected, trigger a connected event
-			if (!ActiveTrackingDevices[i].bActivated && VRSystem()->IsTrackedDeviceConnected(ActiveTrackingDevices[i].id))
+			if (!ActiveTrackingDevices[i].bActivated && FSteamVRInputRuntime::VRSystem()->IsTrackedDeviceConnected(ActiveTrackingDevices[i].id))
 			{
 				// Get Device Class
 				FName DeviceClass = GetDeviceClass(ActiveTrackingDevices[i].id);
 
 				// Get device model info
 				char buf[k_unMaxPropertyStringSize];
-				uint32 StringBytes = VRSystem()->GetStringTrackedDeviceProperty(ActiveTrackingDevices[i].id, ETrackedDeviceProperty::Prop_ModelNumber_String, buf, sizeof(buf));
+				uint32 StringBytes = FSteamVRInputRuntime::VRSystem()->GetStringTrackedDeviceProperty(ActiveTrackingDevices[i].id, ETrackedDeviceProperty::Prop_ModelNumber_String, buf, sizeof(buf));
 				FString DeviceModel = *FString(UTF8_TO_TCHAR(buf));
 
 				// Broadcast activated event
@@ -232,14 +233,14 @@ void USteamVRTrackingReferences::TickComponent(float DeltaTime, ELevelTick TickT
 			}
 
 			// If however a device is flagged as inactive but SteamVR reports it as disconnected, trigger a disconnected event
-			else if (ActiveTrackingDevices[i].bActivated && !VRSystem()->IsTrackedDeviceConnected(ActiveTrackingDevices[i].id))
+			else if (ActiveTrackingDevices[i].bActivated && !FSteamVRInputRuntime::VRSystem()->IsTrackedDeviceConnected(ActiveTrackingDevices[i].id))
 			{
 				// Get Device Class
 				FName DeviceClass = GetDeviceClass(ActiveTrackingDevices[i].id);
 
 				// Get device model info
 				char buf[k_unMaxPropertyStringSize];
-				uint32 StringBytes = VRSystem()->GetStringTrackedDeviceProperty(ActiveTrackingDevices[i].id, ETrackedDeviceProperty::Prop_ModelNumber_String, buf, sizeof(buf));
+				uint32 StringBytes = FSteamVRInputRuntime::VRSystem()->GetStringTrackedDeviceProperty(ActiveTrackingDevices[i].id, ETrackedDeviceProperty::Prop_ModelNumber_String, buf, sizeof(buf));
 				FString DeviceModel = *FString(UTF8_TO_TCHAR(buf));
 
 				// Broadcast deactivated event
@@ -257,7 +258,7 @@ void USteamVRTrackingReferences::TickComponent(float DeltaTime, ELevelTick TickT
 FName USteamVRTrackingReferences::GetDeviceClass(unsigned int id)
 {
 	// Get device class
-	ETrackedDeviceClass TrackedDeviceClass = VRSystem()->GetTrackedDeviceClass(id);
+	ETrackedDeviceClass TrackedDeviceClass = FSteamVRInputRuntime::VRSystem()->GetTrackedDeviceClass(id);
 
 	// Get Device Class
 	FName DeviceClass;
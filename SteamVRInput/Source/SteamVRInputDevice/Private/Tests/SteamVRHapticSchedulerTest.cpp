@@ -0,0 +1,264 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "SteamVRHapticScheduler.h"
+#include "SteamVRInputMockRuntime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SteamVRHapticSchedulerTest
+{
+	/** Tolerance of the times and amplitudes the scheduler sends, they go to SteamVR as floats */
+	static const float Tolerance = 0.0001f;
+
+	/** An arbitrary time far from zero, so the float offsets sent to SteamVR are checked against double time */
+	static const double StartTime = 1000.0;
+
+	/** A haptic vibration as SteamVR received it */
+	struct FVibrationCall
+	{
+		VRActionHandle_t Action;
+		float StartSecondsFromNow;
+		float DurationSeconds;
+		float Frequency;
+		float Amplitude;
+		double Now;
+	};
+
+	/** The mock runtime's IVRInput, recording every haptic vibration it is sent */
+	class FRecordingInput : public FSteamVRMockInput
+	{
+	public:
+		explicit FRecordingInput(FSteamVRMockRuntime& InRuntime) : FSteamVRMockInput(InRuntime) {}
+
+		virtual EVRInputError TriggerHapticVibrationAction(VRActionHandle_t action, float fStartSecondsFromNow, float fDurationSeconds, float fFrequency, float fAmplitude, VRInputValueHandle_t ulRestrictToDevice) override
+		{
+			Calls.Add({ action, fStartSecondsFromNow, fDurationSeconds, fFrequency, fAmplitude, Now });
+			return FSteamVRMockInput::TriggerHapticVibrationAction(action, fStartSecondsFromNow, fDurationSeconds, fFrequency, fAmplitude, ulRestrictToDevice);
+		}
+
+		/** The time of the flush being recorded */
+		double Now = 0.0;
+
+		TArray<FVibrationCall> Calls;
+	};
+
+	/** A scheduler flushing into a recording mock IVRInput, with vibration actions for both hands */
+	struct FFixture
+	{
+		FSteamVRMockRuntime Runtime;
+		FRecordingInput Input;
+		FSteamVRHapticScheduler Scheduler;
+		VRActionHandle_t VibrationActions[2] = { k_ulInvalidActionHandle, k_ulInvalidActionHandle };
+
+		FFixture()
+			: Input(Runtime)
+		{
+			Input.GetActionHandle("/actions/main/out/vibrateleft", &VibrationActions[0]);
+			Input.GetActionHandle("/actions/main/out/vibrateright", &VibrationActions[1]);
+		}
+
+		int32 Flush(double Now)
+		{
+			Input.Now = Now;
+			return Scheduler.Flush(&Input, VibrationActions, Now);
+		}
+	};
+
+	/** Check a recorded vibration against when it should play, relative to StartTime, and how strong */
+	static void TestCall(FAutomationTestBase& Test, const TCHAR* What, const FVibrationCall& Call, VRActionHandle_t Action, double Start, double Duration, float Amplitude)
+	{
+		Test.TestEqual(FString::Printf(TEXT("%s action"), What), (uint64)Call.Action, (uint64)Action);
+		Test.TestEqual(FString::Printf(TEXT("%s start"), What), (float)(Call.Now - StartTime) + Call.StartSecondsFromNow, (float)Start, Tolerance);
+		Test.TestEqual(FString::Printf(TEXT("%s duration"), What), Call.DurationSeconds, (float)Duration, Tolerance);
+		Test.TestEqual(FString::Printf(TEXT("%s amplitude"), What), Call.Amplitude, Amplitude, Tolerance);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSteamVRHapticSchedulerSingleCallTest, "SteamVRInput.HapticScheduler.ConstantPatternIsOneCall", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSteamVRHapticSchedulerSingleCallTest::RunTest(const FString& Parameters)
+{
+	using namespace SteamVRHapticSchedulerTest;
+	FFixture Fixture;
+
+	// A constant pattern longer than the lookahead is sent whole, once, however often the scheduler is flushed
+	TArray<FSteamVRHapticSegment> Segments;
+	Segments.Add(FSteamVRHapticSegment(0.2f, 160.f, 0.5f));
+	Fixture.Scheduler.Play(1, Segments, StartTime);
+
+	for (double Time = 0.0; Time < 0.3; Time += 1.0 / 90.0)
+	{
+		Fixture.Flush(StartTime + Time);
+	}
+
+	if (TestEqual(TEXT("Vibrations sent"), Fixture.Input.Calls.Num(), 1))
+	{
+		TestCall(*this, TEXT("Pattern"), Fixture.Input.Calls[0], Fixture.VibrationActions[1], 0.0, 0.2, 0.5f);
+		TestEqual(TEXT("Pattern frequency"), Fixture.Input.Calls[0].Frequency, 160.f, Tolerance);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSteamVRHapticSchedulerMergeTest, "SteamVRInput.HapticScheduler.OverlappingPatternsAreMerged", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSteamVRHapticSchedulerMergeTest::RunTest(const FString& Parameters)
+{
+	using namespace SteamVRHapticSchedulerTest;
+	FFixture Fixture;
+	Fixture.Scheduler.SetMixMode(HapticMix_Max);
+
+	// A quiet 100 ms pattern with a louder 50 ms one on top of it from 20 ms on
+	TArray<FSteamVRHapticSegment> Quiet;
+	Quiet.Add(FSteamVRHapticSegment(0.1f, 160.f, 0.5f));
+	TArray<FSteamVRHapticSegment> Loud;
+	Loud.Add(FSteamVRHapticSegment(0.05f, 160.f, 0.8f));
+	Fixture.Scheduler.Play(0, Quiet, StartTime);
+	Fixture.Scheduler.Play(0, Loud, StartTime + 0.02);
+
+	// The first flush sends everything that starts within the lookahead, the louder pattern whole
+	TestEqual(TEXT("Vibrations sent by the first flush"), Fixture.Flush(StartTime), 2);
+
+	// Nothing new starts until the louder pattern ends
+	TestEqual(TEXT("Vibrations sent before the lookahead reaches the end of the louder pattern"), Fixture.Flush(StartTime + 0.01), 0);
+	TestEqual(TEXT("Vibrations sent once the lookahead reaches the end of the louder pattern"), Fixture.Flush(StartTime + 0.03), 1);
+	TestEqual(TEXT("Vibrations sent after the patterns end"), Fixture.Flush(StartTime + 0.2), 0);
+
+	const TArray<FVibrationCall>& Calls = Fixture.Input.Calls;
+	if (TestEqual(TEXT("Vibrations sent"), Calls.Num(), 3))
+	{
+		TestCall(*this, TEXT("Quiet start"), Calls[0], Fixture.VibrationActions[0], 0.0, 0.02, 0.5f);
+		TestCall(*this, TEXT("Loud"), Calls[1], Fixture.VibrationActions[0], 0.02, 0.05, 0.8f);
+		TestCall(*this, TEXT("Quiet end"), Calls[2], Fixture.VibrationActions[0], 0.07, 0.03, 0.5f);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSteamVRHapticSchedulerContinuousTest, "SteamVRInput.HapticScheduler.ContinuousVibrationIsBatched", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSteamVRHapticSchedulerContinuousTest::RunTest(const FString& Parameters)
+{
+	using namespace SteamVRHapticSchedulerTest;
+	FFixture Fixture;
+
+	// An unchanged vibration set every frame for a second
+	const int32 FrameCount = 90;
+	for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+	{
+		const double Now = StartTime + Frame / 90.0;
+		Fixture.Scheduler.SetContinuous(0, 0.6f, 200.f, Now);
+		Fixture.Flush(Now);
+	}
+
+	// It is sent as a few long vibrations that play back to back, not one per frame
+	const TArray<FVibrationCall>& Calls = Fixture.Input.Calls;
+	TestTrue(FString::Printf(TEXT("%d vibrations sent for %d frames"), Calls.Num(), FrameCount), Calls.Num() > 0 && Calls.Num() <= FrameCount / 4);
+
+	double PreviousEnd = 0.0;
+	for (int32 CallIndex = 0; CallIndex < Calls.Num(); ++CallIndex)
+	{
+		const FVibrationCall& Call = Calls[CallIndex];
+		const double Start = Call.Now - StartTime + Call.StartSecondsFromNow;
+		TestCall(*this, *FString::Printf(TEXT("Vibration %d"), CallIndex), Call, Fixture.VibrationActions[0], PreviousEnd, Call.DurationSeconds, 0.6f);
+		PreviousEnd = Start + Call.DurationSeconds;
+	}
+
+	TestTrue(TEXT("Vibration covers every frame"), PreviousEnd >= (FrameCount - 1) / 90.0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSteamVRHapticSchedulerStopTest, "SteamVRInput.HapticScheduler.StopSilencesWhatWasSent", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSteamVRHapticSchedulerStopTest::RunTest(const FString& Parameters)
+{
+	using namespace SteamVRHapticSchedulerTest;
+	FFixture Fixture;
+
+	TArray<FSteamVRHapticSegment> Segments;
+	Segments.Add(FSteamVRHapticSegment(0.2f, 160.f, 0.5f));
+	Fixture.Scheduler.Play(0, Segments, StartTime);
+	Fixture.Flush(StartTime);
+
+	// The vibration already sent keeps playing unless it is replaced with silence up to its end
+	Fixture.Scheduler.StopAll(0);
+	TestFalse(TEXT("Playing after StopAll"), Fixture.Scheduler.IsPlaying(0));
+	TestEqual(TEXT("Vibrations sent by the flush after StopAll"), Fixture.Flush(StartTime + 0.05), 1);
+	TestEqual(TEXT("Vibrations sent by later flushes"), Fixture.Flush(StartTime + 0.1), 0);
+
+	const TArray<FVibrationCall>& Calls = Fixture.Input.Calls;
+	if (TestEqual(TEXT("Vibrations sent"), Calls.Num(), 2))
+	{
+		TestCall(*this, TEXT("Silence"), Calls[1], Fixture.VibrationActions[0], 0.05, 0.15, 0.f);
+	}
+
+	// Nothing is sent without an IVRInput or to a hand without a vibration action
+	TArray<FSteamVRHapticSegment> Pattern;
+	Pattern.Add(FSteamVRHapticSegment(0.1f, 160.f, 1.f));
+	Fixture.Scheduler.Play(0, Pattern, StartTime + 0.3);
+	Fixture.Scheduler.Play(1, Pattern, StartTime + 0.3);
+	TestEqual(TEXT("Vibrations sent without an IVRInput"), Fixture.Scheduler.Flush(nullptr, Fixture.VibrationActions, StartTime + 0.3), 0);
+
+	const VRActionHandle_t NoVibrationActions[2] = { k_ulInvalidActionHandle, k_ulInvalidActionHandle };
+	TestEqual(TEXT("Vibrations sent without vibration actions"), Fixture.Scheduler.Flush(&Fixture.Input, NoVibrationActions, StartTime + 0.3), 0);
+	TestEqual(TEXT("Vibrations recorded"), Calls.Num(), 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSteamVRHapticSchedulerZeroDurationTest, "SteamVRInput.HapticScheduler.ZeroDurationIsShortestPulse", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSteamVRHapticSchedulerZeroDurationTest::RunTest(const FString& Parameters)
+{
+	using namespace SteamVRHapticSchedulerTest;
+	FFixture Fixture;
+
+	// PlaySteamVR_HapticFeedback with a duration of 0 asks for SteamVR's shortest pulse, it is not dropped
+	TArray<FSteamVRHapticSegment> Segments;
+	Segments.Add(FSteamVRHapticSegment(0.f, 160.f, 0.7f));
+	TestNotEqual(TEXT("Pattern id of a zero duration pulse"), Fixture.Scheduler.Play(0, Segments, StartTime), (int32)INDEX_NONE);
+
+	Fixture.Flush(StartTime);
+	if (TestEqual(TEXT("Vibrations sent"), Fixture.Input.Calls.Num(), 1))
+	{
+		TestCall(*this, TEXT("Pulse"), Fixture.Input.Calls[0], Fixture.VibrationActions[0], 0.0, HAPTIC_MIN_PULSE_DURATION, 0.7f);
+	}
+
+	// Negative durations are still rejected
+	Segments[0].Duration = -1.f;
+	TestEqual(TEXT("Pattern id of a negative duration"), Fixture.Scheduler.Play(0, Segments, StartTime), (int32)INDEX_NONE);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,115 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "SteamVRInputBenchmark.h"
+#include "SteamVRInputDevice.h"
+#include "SteamVRInputDeviceFunctionLibrary.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSteamVRInputBenchmarkScalingTest, "SteamVRInput.Benchmark.InputPathsScale", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FSteamVRInputBenchmarkScalingTest::RunTest(const FString& Parameters)
+{
+	FSteamVRInputDevice* SteamVRInputDevice = USteamVRInputDeviceFunctionLibrary::GetSteamVRInputDevice();
+	if (SteamVRInputDevice == nullptr)
+	{
+		AddWarning(TEXT("No SteamVR Input device to pause while the benchmark runs, skipped"));
+		return true;
+	}
+
+	FSteamVRInputBenchmark Benchmark(*SteamVRInputDevice);
+	if (!Benchmark.RunScenarios())
+	{
+		AddWarning(TEXT("Input is being recorded or replayed, skipped"));
+		return true;
+	}
+
+	if (!TestTrue(TEXT("Scenarios ran against the mock runtime"), Benchmark.GetResults().Num() > 0))
+	{
+		return true;
+	}
+
+	// Machines differ too much for absolute budgets to fail a test, only how each path grows is checked
+	for (const FSteamVRInputBenchmarkResult& Result : Benchmark.GetResults())
+	{
+		if (!Result.IsWithinBudget())
+		{
+			AddWarning(FString::Printf(TEXT("%s with %d actions and %d trackers took %.2f us per frame, over its budget of %.2f us"),
+				FSteamVRInputBenchmark::GetPathName(Result.Path), Result.ActionCount, Result.TrackerCount, Result.MicrosecondsPerFrame, Result.BudgetMicroseconds));
+		}
+	}
+
+	for (const FSteamVRInputBenchmarkScaling& PathScaling : Benchmark.GetScaling())
+	{
+		TestTrue(FString::Printf(TEXT("%s per call from %d to %d %s grew %.2fx (%.2f to %.2f us), expected up to %.2fx"),
+			FSteamVRInputBenchmark::GetPathName(PathScaling.Path), PathScaling.BaseCount, PathScaling.ScaledCount, PathScaling.bScalesWithActions ? TEXT("actions") : TEXT("trackers"),
+			PathScaling.GetRatio(), PathScaling.BaseMicroseconds, PathScaling.ScaledMicroseconds, PathScaling.ExpectedRatio * BENCHMARK_SCALING_TOLERANCE), PathScaling.IsWithinTolerance());
+	}
+
+	// A snapshot nothing reads must not cost a round trip to SteamVR
+	TestEqual(TEXT("Skeletal calls into SteamVR while nothing read the input snapshot"), Benchmark.GetIdleSkeletalCallCount(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSteamVRInputBenchmarkSkeletonTest, "SteamVRInput.Benchmark.SkeletonConversion", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FSteamVRInputBenchmarkSkeletonTest::RunTest(const FString& Parameters)
+{
+	FSteamVRInputDevice* SteamVRInputDevice = USteamVRInputDeviceFunctionLibrary::GetSteamVRInputDevice();
+	if (SteamVRInputDevice == nullptr)
+	{
+		AddWarning(TEXT("No SteamVR Input device, skipped"));
+		return true;
+	}
+
+	FSteamVRInputBenchmark Benchmark(*SteamVRInputDevice);
+	Benchmark.RunSkeletonConversion(*GLog);
+
+	// The vectorized conversion has to give the bones the scalar path gave. Timings of a few microseconds are too noisy to fail on, they are only reported
+	const FSteamVRSkeletonConversionResult& Result = Benchmark.GetSkeletonConversionResult();
+	TestTrue(FString::Printf(TEXT("Vectorized and scalar bones differ by at most %g, differed by %g"), BENCHMARK_SKELETON_TOLERANCE, Result.MaxError), Result.IsMatching());
+
+	const FString TimeRatio = FString::Printf(TEXT("Vectorized conversion took %.3f us per skeleton, scalar path %.3f us"), Result.VectorizedMicroseconds, Result.ScalarMicroseconds);
+	if (Result.IsWithinTimeRatio())
+	{
+		AddInfo(TimeRatio);
+	}
+	else
+	{
+		AddWarning(TimeRatio + TEXT(", slower than the scalar path"));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -114,6 +114,11 @@ namespace UE4HandSkeleton
 		return g_BoneParentMap[nBoneIndex];
 	}
 
+	const int32* GetParentIndices()
+	{
+		return g_BoneParentMap;
+	}
+
 	int32 GetChildCount(int32 nBoneIndex)
 	{
 		check(nBoneIndex >= 0 && nBoneIndex < GetBoneCount());
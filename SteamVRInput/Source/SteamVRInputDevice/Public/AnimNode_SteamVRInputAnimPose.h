@@ -34,8 +34,39 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "Animation/AnimNodeBase.h"
 #include "SteamVRInputDeviceFunctionLibrary.h"
 #include "SteamVRSkeletonDefinition.h"
+#include "UE4HandSkeletonDefinition.h"
 #include "AnimNode_SteamVRInputAnimPose.generated.h"
 
+/**
+* Bone lookups for posing a skeleton from SteamVR skeletal input, compiled once per bone container
+*/
+struct FSteamVRRetargetPlan
+{
+	/** Whether the plan has been built for the current bone container */
+	bool bIsValid = false;
+
+	/** Compact pose index of each SteamVR skeleton bone, INDEX_NONE if the bone is not required */
+	int32 SteamVRCompactIndices[STEAMVR_SKELETON_BONE_COUNT];
+
+	/** Compact pose index of each UE4 hand skeleton bone, INDEX_NONE if the bone is not required */
+	int32 UE4CompactIndices[EUE4HandBone_Count];
+
+	/** Parent of each UE4 hand skeleton bone, -1 for the wrist */
+	int32 UE4ParentIndices[EUE4HandBone_Count];
+
+	/** Reference pose local rotation of each UE4 hand skeleton bone */
+	FQuat UE4RefRotations[EUE4HandBone_Count];
+
+	/** Local direction from each UE4 hand skeleton bone to its first child in the reference pose */
+	FVector UE4ForwardsLS[EUE4HandBone_Count];
+
+	/** SteamVR bone that drives each UE4 hand skeleton bone */
+	int32 SteamVRBoneIndices[EUE4HandBone_Count];
+
+	/** First child of the SteamVR bone that drives each UE4 hand skeleton bone, -1 if it has none */
+	int32 SteamVRChildIndices[EUE4HandBone_Count];
+};
+
 /**
 * Custom animation node to retrieve poses from the Skeletal Input System
 */
@@ -68,6 +99,9 @@ struct STEAMVRINPUTDEVICE_API FAnimNode_SteamVRInputAnimPose : public FAnimNode_
 	UPROPERTY()
 	FUE4RetargettingRefs UE4RetargettingRefs;
 
+	/** Bone lookups for the current bone container, rebuilt in CacheBones_AnyThread */
+	FSteamVRRetargetPlan RetargetPlan;
+
 public:
 
 	// FAnimNode_Base interface
@@ -85,10 +119,14 @@ public:
 	*/
 	void PoseUE4HandSkeleton(FCompactPose& Pose, const FTransform* BoneTransformsLS, int32 BoneTransformCount);
 
+	/** Compile the bone lookups used every frame to pose the hand skeleton for the given bone container */
+	void BuildRetargetPlan(const FBoneContainer& RequiredBones);
+
 	/** Retrieve the first active SteamVRInput device present in this game */
 	FSteamVRInputDevice* GetSteamVRInputDevice();
 
-	/** Recursively calculate the model-space transform of the given bone from the local-space transforms on the given pose */
+	/** Calculate the model-space transform of the given bone from the local-space transforms on the given pose */
+	UE_DEPRECATED(4.23, "Gather the local-space transforms and build all model-space transforms in one sweep with SteamVRSkeleton::CalcComponentSpaceTransforms instead.")
 	FTransform CalcModelSpaceTransform(const FCompactPose& Pose, FCompactPoseBoneIndex BoneIndex);
 
 };
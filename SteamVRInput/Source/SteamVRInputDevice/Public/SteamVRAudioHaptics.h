@@ -0,0 +1,144 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Templates/Atomic.h"
+#include "Sound/SoundSubmix.h"
+#include "UObject/WeakObjectPtr.h"
+#include "SteamVRInputTypes.h"
+
+class USoundWave;
+class FSteamVRHapticScheduler;
+
+/**
+* Converts audio to haptics. The amplitude (windowed RMS) and dominant frequency of the sound are extracted off the game thread,
+* then played through the haptic scheduler slightly ahead of time. Hand masks select the left (1), right (2) or both (3) hands
+*/
+class STEAMVRINPUTDEVICE_API FSteamVRAudioHaptics : public ISubmixBufferListener
+{
+public:
+	FSteamVRAudioHaptics();
+	virtual ~FSteamVRAudioHaptics();
+
+	/**
+	* Extract the haptic envelope of an audio buffer, one constant segment per window, merging windows that feel the same
+	* @param Samples - Interleaved audio samples in [-1..1]
+	* @param NumFrames - How many samples each channel has
+	* @param NumChannels - How many channels are interleaved in Samples
+	* @param SampleRate - Samples per second of each channel
+	* @param Gain - Scale applied to the amplitude before it is clamped to [0..1]
+	* @param OutSegments - Will hold the haptic envelope
+	*/
+	static void ExtractEnvelope(const float* Samples, int32 NumFrames, int32 NumChannels, int32 SampleRate, float Gain, TArray<FSteamVRHapticSegment>& OutSegments);
+
+	/**
+	* Play a sound wave as haptics. Its envelope is extracted on a worker thread the first time, then cached
+	* @param HandMask - Which hands to play on
+	* @param SoundWave - The sound to convert, needs either decompressed PCM data or its editor source data
+	* @param Gain - Scale applied to the amplitude of the sound
+	* @param StartTime - When the sound starts, in FPlatformTime::Seconds() time
+	* @return Whether or not the sound wave has audio data that can be converted
+	*/
+	bool PlaySoundWave(int32 HandMask, USoundWave* SoundWave, float Gain, double StartTime);
+
+	/**
+	* Stream the output of a submix as haptics, replacing the current stream if any
+	* @param HandMask - Which hands to play on
+	* @param Submix - The submix to listen to, the master submix if null
+	* @param Gain - Scale applied to the amplitude of the audio
+	* @return Whether or not the submix could be listened to
+	*/
+	bool StartSubmixStream(int32 HandMask, USoundSubmix* Submix, float Gain);
+
+	/** Stop streaming submix audio as haptics. Waits for the audio thread to unregister the listener, so no submix buffer arrives afterwards */
+	void StopSubmixStream();
+
+	/** Pass the envelopes extracted since the last tick on to the haptic scheduler. Game thread only */
+	void Tick(FSteamVRHapticScheduler& Scheduler, double Now);
+
+	// ISubmixBufferListener interface, called from the audio render thread
+	virtual void OnNewSubmixBuffer(const USoundSubmix* OwningSubmix, float* AudioData, int32 NumSamples, int32 NumChannels, const int32 SampleRate, double AudioClock) override;
+
+private:
+	struct FExtractedEnvelope
+	{
+		TWeakObjectPtr<USoundWave> SoundWave;
+		TArray<FSteamVRHapticSegment> Segments;
+	};
+
+	struct FPendingSoundWave
+	{
+		TWeakObjectPtr<USoundWave> SoundWave;
+		int32 HandMask;
+		float Gain;
+		double StartTime;
+	};
+
+	/** Outlives this object for worker threads that are still extracting */
+	struct FSharedState
+	{
+		TQueue<FExtractedEnvelope, EQueueMode::Mpsc> ExtractedEnvelopes;
+	};
+
+	/** Play the part of an envelope that is still ahead of now on every hand of the mask */
+	void PlayEnvelope(FSteamVRHapticScheduler& Scheduler, int32 HandMask, const TArray<FSteamVRHapticSegment>& Segments, float Gain, double StartTime, double Now) const;
+
+	TSharedRef<FSharedState, ESPMode::ThreadSafe> SharedState;
+
+	/** Envelopes of the sound waves played so far, extracted with a gain of 1. Those of unloaded sound waves are pruned when another one is extracted */
+	TMap<TWeakObjectPtr<USoundWave>, TArray<FSteamVRHapticSegment>> CachedEnvelopes;
+
+	/** Sound waves whose envelope is being extracted on a worker thread */
+	TArray<TWeakObjectPtr<USoundWave>> ExtractingSoundWaves;
+
+	/** Sound waves waiting for their envelope to be extracted */
+	TArray<FPendingSoundWave> PendingSoundWaves;
+
+	/** The submix being streamed, if any */
+	TWeakObjectPtr<USoundSubmix> StreamSubmix;
+
+	/** Whether submix audio is being streamed, checked from the audio render thread */
+	FThreadSafeBool bIsStreaming;
+
+	/** Which hands the submix audio is played on */
+	int32 StreamHandMask = 0;
+
+	/** Scale applied to the amplitude of the submix audio, read from the audio render thread */
+	TAtomic<float> StreamGain { 1.f };
+
+	/** Envelopes of submix buffers, produced by the audio render thread and consumed by the game thread */
+	TQueue<TArray<FSteamVRHapticSegment>, EQueueMode::Spsc> StreamedEnvelopes;
+
+	/** When the streamed haptics scheduled so far end, for the left [0] and right [1] hands */
+	double StreamEndTime[2] = { 0.0, 0.0 };
+};
@@ -0,0 +1,123 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamVRInputTypes.h"
+
+/**
+* Plays multi-segment haptic patterns on the left [0] and right [1] hands.
+* Overlapping patterns on a hand are mixed (loudest or summed), and the mixed timeline is sent to SteamVR
+* as few future-dated vibrations as possible, a short lookahead at a time. Game thread only
+*/
+class STEAMVRINPUTDEVICE_API FSteamVRHapticScheduler
+{
+public:
+	/**
+	* Schedule a haptic pattern
+	* @param HandIndex - Which hand to play the pattern on, left [0] or right [1]
+	* @param Segments - The amplitude and frequency envelope of the pattern, played back to back
+	* @param StartTime - When the pattern starts, in FPlatformTime::Seconds() time
+	* @return An id to stop the pattern with, INDEX_NONE if there was nothing to play
+	*/
+	int32 Play(int32 HandIndex, const TArray<FSteamVRHapticSegment>& Segments, double StartTime);
+
+	/**
+	* Stop a haptic pattern before it ends
+	* @param PatternId - The id returned when the pattern was scheduled
+	* @return Whether or not the pattern was still playing
+	*/
+	bool Stop(int32 PatternId);
+
+	/** Stop all haptic patterns of a hand, left [0] or right [1] */
+	void StopAll(int32 HandIndex);
+
+	/** Whether any haptic pattern is playing or scheduled on a hand, left [0] or right [1] */
+	bool IsPlaying(int32 HandIndex) const;
+
+	/**
+	* Set the continuous vibration of a hand, for effects that are updated every frame.
+	* An unchanged vibration keeps playing seamlessly, without sending anything new to SteamVR until it runs out
+	* @param HandIndex - Which hand to vibrate, left [0] or right [1]
+	* @param Amplitude - Vibration amplitude [0..1], 0 stops the continuous vibration
+	* @param Frequency - Vibration frequency
+	* @param Now - The current time, in FPlatformTime::Seconds() time
+	* @param HoldSeconds - How long the vibration keeps playing unless it is set again
+	*/
+	void SetContinuous(int32 HandIndex, float Amplitude, float Frequency, double Now, float HoldSeconds = HAPTIC_CONTINUOUS_HOLD);
+
+	/** Set how overlapping patterns of a hand are mixed */
+	void SetMixMode(EHapticMixMode InMixMode);
+
+	/** Retrieve how overlapping patterns of a hand are mixed */
+	EHapticMixMode GetMixMode() const { return MixMode; }
+
+	/**
+	* Send the merged patterns that start within the lookahead to SteamVR
+	* @param VRInputInterface - Where the vibrations are sent to
+	* @param VibrationActions - The vibration action of the left [0] and right [1] hands
+	* @param Now - The current time, in FPlatformTime::Seconds() time
+	* @param Lookahead - How far ahead of now vibrations are sent, in seconds
+	* @return How many vibrations were sent
+	*/
+	int32 Flush(IVRInput* VRInputInterface, const VRActionHandle_t (&VibrationActions)[2], double Now, float Lookahead = HAPTIC_SCHEDULE_LOOKAHEAD);
+
+private:
+	struct FPattern
+	{
+		int32 Id;
+		double StartTime;
+		double EndTime;
+		TArray<FSteamVRHapticSegment> Segments;
+	};
+
+	struct FHandTimeline
+	{
+		TArray<FPattern> Patterns;
+		double ScheduledUntil = 0.0;	// Everything before this was already sent to SteamVR
+		double CommittedUntil = 0.0;	// When the last vibration sent to SteamVR ends
+		bool bDirty = false;			// Patterns were added or removed, so what was sent has to be replaced from now on
+		int32 ContinuousPatternId = INDEX_NONE;
+	};
+
+	/**
+	* Sample the mixed patterns of a hand at a given time
+	* @param OutFrequency - Will hold the frequency of the loudest pattern
+	* @return Whether or not any pattern is playing at that time
+	*/
+	bool Sample(const FHandTimeline& Timeline, double Time, float& OutAmplitude, float& OutFrequency) const;
+
+	/** Retrieve the next time after Time where the merged output of a hand may change, TNumericLimits<double>::Max() if it never does */
+	static double NextChangeTime(const FHandTimeline& Timeline, double Time);
+
+	FHandTimeline Hands[2];
+	int32 NextPatternId = 1;
+	EHapticMixMode MixMode = HapticMix_Max;
+};
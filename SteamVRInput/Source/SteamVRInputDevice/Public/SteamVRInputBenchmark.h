@@ -0,0 +1,195 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamVRInputTypes.h"
+
+class FSteamVRInputDevice;
+
+/** An input path measured by FSteamVRInputBenchmark */
+enum ESteamVRBenchmarkPath : uint8
+{
+	BenchmarkPath_SendControllerEvents,
+	BenchmarkPath_ProcessActionEvents,
+	BenchmarkPath_GetControllerOrientationAndPosition,
+	BenchmarkPath_GetControllerTrackingStatus,
+	BenchmarkPath_GetSkeletalData,
+	BenchmarkPath_GetFingerCurlsAndSplays,
+	BenchmarkPath_Count
+};
+
+/** How much each input path may cost per frame, in microseconds. Read from [SteamVRInput] BenchmarkBudget<Path> in the game config */
+struct FSteamVRInputBenchmarkBudgets
+{
+	float Microseconds[BenchmarkPath_Count];
+
+	FSteamVRInputBenchmarkBudgets();
+};
+
+/** What one input path cost in one scenario */
+struct FSteamVRInputBenchmarkResult
+{
+	ESteamVRBenchmarkPath Path = BenchmarkPath_SendControllerEvents;
+	int32 ActionCount = 0;
+	int32 TrackerCount = 0;
+
+	/** How many times the path ran per frame, e.g. once per motion source */
+	int32 CallsPerFrame = 0;
+
+	double MicrosecondsPerCall = 0.0;
+	double MicrosecondsPerFrame = 0.0;
+	double MaxMicrosecondsPerFrame = 0.0;
+	double BudgetMicroseconds = 0.0;
+
+	/** Whether the average frame stayed within budget */
+	bool IsWithinBudget() const { return MicrosecondsPerFrame <= BudgetMicroseconds; }
+};
+
+/** What converting a skeleton to UE4 space cost through the vectorized kernel and through the scalar reference path */
+struct FSteamVRSkeletonConversionResult
+{
+	double VectorizedMicroseconds = 0.0;	// Per skeleton, through ConvertSteamVRSkeleton
+	double ScalarMicroseconds = 0.0;		// Per skeleton, through the separate scalar mirror and convert passes
+	float MaxError = 0.f;					// Largest difference between a rotation or translation component converted by both paths
+
+	/** Whether both paths produced the same bones */
+	bool IsMatching() const { return MaxError <= BENCHMARK_SKELETON_TOLERANCE; }
+
+	/** Whether the vectorized path was no slower than the scalar path, give or take timer noise */
+	bool IsWithinTimeRatio() const { return VectorizedMicroseconds <= ScalarMicroseconds * BENCHMARK_SKELETON_TIME_RATIO; }
+};
+
+/** How the cost of one call of an input path grew from the smallest scenario to the largest, against how it is expected to grow */
+struct FSteamVRInputBenchmarkScaling
+{
+	ESteamVRBenchmarkPath Path = BenchmarkPath_SendControllerEvents;
+
+	/** Whether the number of actions was scaled, otherwise the number of trackers */
+	bool bScalesWithActions = false;
+
+	int32 BaseCount = 0;
+	int32 ScaledCount = 0;
+	double BaseMicroseconds = 0.0;		// Per call, in the smallest scenario
+	double ScaledMicroseconds = 0.0;	// Per call, in the largest scenario
+
+	/** How many times more a call is expected to cost in the largest scenario, e.g. the ratio of action counts for paths reading every action */
+	double ExpectedRatio = 1.0;
+
+	/** Retrieve how many times more a call cost in the largest scenario, with timings too small to compare raised to BENCHMARK_SCALING_FLOOR */
+	double GetRatio() const { return FMath::Max(ScaledMicroseconds, BENCHMARK_SCALING_FLOOR) / FMath::Max(BaseMicroseconds, BENCHMARK_SCALING_FLOOR); }
+
+	/** Whether the path grew no more than expected, within BENCHMARK_SCALING_TOLERANCE */
+	bool IsWithinTolerance() const { return GetRatio() <= ExpectedRatio * BENCHMARK_SCALING_TOLERANCE; }
+};
+
+/**
+* Measures the per-frame cost of the input paths against the mock runtime, scaling the number of actions (10 to 1000)
+* and generic trackers (2 to 64), and checks each against its budget and how each grows against how it is expected to grow,
+* and that publishing the input snapshot makes no skeletal calls into SteamVR while nothing reads it.
+* Then compares the vectorized skeleton conversion with the scalar path it replaced.
+* Every scenario runs on a device of its own, isolated from the engine, so the input of the game is left alone.
+* Run with the steamvr.input.benchmark console command, -SteamVRInputBenchmark to run once and exit with
+* a non-zero code when a budget is exceeded, or the SteamVRInput.Benchmark automation tests, which only check the relative thresholds
+*/
+class FSteamVRInputBenchmark
+{
+public:
+	/** @param InEngineDevice - The device of the engine, whose polling is paused while scenarios run. Nothing is run while it records or replays input */
+	explicit FSteamVRInputBenchmark(FSteamVRInputDevice& InEngineDevice);
+
+	/**
+	* Run every scenario and log the results. Game thread only, while nothing is being recorded or replayed
+	* @param Ar - Receives the results, one line per path and scenario
+	* @param FrameCount - How many frames each scenario runs
+	* @return Whether every path stayed within budget in every scenario and grew no more than expected
+	*/
+	bool Run(FOutputDevice& Ar, int32 FrameCount = BENCHMARK_FRAME_COUNT);
+
+	/**
+	* Run every scenario without logging, for GetResults and GetScaling. Game thread only
+	* @param FrameCount - How many frames each scenario runs
+	* @return Whether the scenarios ran, they don't while the engine device records or replays input
+	*/
+	bool RunScenarios(int32 FrameCount = BENCHMARK_FRAME_COUNT);
+
+	/**
+	* Convert the same random skeletons, mirrored and unmirrored, through the vectorized kernel and the scalar reference path, and compare them
+	* @param Ar - Receives the results
+	* @param IterationCount - How many skeletons each path converts for each mirroring
+	* @return Whether both paths produced the same bones
+	*/
+	bool RunSkeletonConversion(FOutputDevice& Ar, int32 IterationCount = BENCHMARK_SKELETON_ITERATIONS);
+
+	/** Retrieve the results of the last run */
+	const TArray<FSteamVRInputBenchmarkResult>& GetResults() const { return Results; }
+
+	/** Retrieve how each path grew with the number of actions, then with the number of trackers, in the last run */
+	const TArray<FSteamVRInputBenchmarkScaling>& GetScaling() const { return Scaling; }
+
+	/** Retrieve how many skeletal calls into SteamVR were made in the last run while frames were sent with nothing reading the snapshot, INDEX_NONE if that did not run */
+	int32 GetIdleSkeletalCallCount() const { return IdleSkeletalCallCount; }
+
+	/** Retrieve the result of the last skeleton conversion comparison */
+	const FSteamVRSkeletonConversionResult& GetSkeletonConversionResult() const { return SkeletonConversionResult; }
+
+	/** Retrieve the name of an input path, e.g. SendControllerEvents */
+	static const TCHAR* GetPathName(ESteamVRBenchmarkPath Path);
+
+private:
+	/** Run one scenario on an isolated device against a fresh mock runtime, adding its results */
+	void RunScenario(int32 ActionCount, int32 TrackerCount, int32 FrameCount);
+
+	/**
+	* Add synthetic digital and analog actions to the first action set of a device, read every frame like bound actions
+	* @param Device - The isolated device the scenario runs on
+	* @param ActionCount - How many actions to add
+	*/
+	static void AddBenchmarkActions(FSteamVRInputDevice& Device, int32 ActionCount);
+
+	/** Send frames on an isolated device with nothing reading its input snapshot, counting the skeletal calls into SteamVR it makes */
+	void RunIdleSnapshot(int32 FrameCount);
+
+	/** Make a device the engine knows nothing about, for one scenario to run on */
+	static TUniquePtr<FSteamVRInputDevice> MakeIsolatedDevice();
+
+	/** Compare per call costs between the smallest and largest scenario of each path, once actions then trackers were scaled */
+	void ComputeScaling();
+
+	/** Retrieve the result of a path in a scenario, or null if that scenario did not run */
+	const FSteamVRInputBenchmarkResult* FindResult(ESteamVRBenchmarkPath Path, int32 ActionCount, int32 TrackerCount) const;
+
+	FSteamVRInputDevice& EngineDevice;
+	FSteamVRInputBenchmarkBudgets Budgets;
+	TArray<FSteamVRInputBenchmarkResult> Results;
+	TArray<FSteamVRInputBenchmarkScaling> Scaling;
+	FSteamVRSkeletonConversionResult SkeletonConversionResult;
+	int32 IdleSkeletalCallCount = INDEX_NONE;
+};
@@ -42,7 +42,13 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "Serialization/JsonSerializer.h"
 #include "SteamVRInputTypes.h"
 #include "SteamVRInputPublic.h"
+#include "SteamVRInputPoller.h"
+#include "SteamVRHapticScheduler.h"
+#include "SteamVRAudioHaptics.h"
+#include "SteamVRInputReplay.h"
+#include "SteamVRInputMockRuntime.h"
 #include "Misc/MessageDialog.h"
+#include "Async/Future.h"
 
 class STEAMVRINPUTDEVICE_API FSteamVRInputDevice : public IInputDevice, public FXRMotionControllerBase, public IHapticDevice
 {
@@ -86,8 +92,17 @@ public:
 	*/
 	FName GetMotionSourceName(const EControllerHand MotionSource) const;
 
-	/** Initialize the SteamVR System. Will cause a reconnect if one is already active  */
-	void InitSteamVRSystem();
+	/**
+	* Initialize the SteamVR System. Will cause a reconnect if one is already active. A failed connection is retried with exponential backoff
+	* @return Whether or not SteamVR (or a mock runtime or input replay standing in for it) is available
+	*/
+	bool InitSteamVRSystem();
+
+	/** Where the input device stands with SteamVR */
+	ESteamVRConnectionState GetConnectionState() const { return ConnectionState; }
+
+	/** Whether the action manifest started at startup is still being written and registered in the background. Input comes online when it completes */
+	bool IsInitializingInput() const { return AsyncInitialization.IsValid(); }
 
 	/**
 	* Retrieve the skeletal input from SteamVR
@@ -100,6 +115,58 @@ public:
 	*/
 	bool GetSkeletalData(bool bLeftHand, bool bMirror, EVRSkeletalMotionRange MotionRange, FTransform* OutBoneTransform, int32 OutBoneTransformCount);
 
+	/**
+	* Retrieve this frame's skeletal input from SteamVR. Bones are read once per frame for each hand and motion range,
+	* and each mirrored or unmirrored variant is converted to UE4 space only once. The bones are copied out under the cache lock,
+	* so another thread fetching the next frame can't overwrite them while they are read
+	* @param bLeftHand - Whether or not retrieve values for the Left Hand instead of the Right Hand
+	* @param bMirror - Will mirror the pose read from SteamVR to fit the skeleton of the opposite hand
+	* @param MotionRange - Whether to retrieve skeletal anim values with or without controllers
+	* @param OutBoneTransform - Receives the STEAMVR_SKELETON_BONE_COUNT bone transforms in parent space
+	* @return Whether or not skeletal data was available
+	*/
+	bool GetCachedSkeletalData(bool bLeftHand, bool bMirror, EVRSkeletalMotionRange MotionRange, FTransform* OutBoneTransform);
+
+	/**
+	* Retrieve skeletal input from the last snapshot published by the game thread. Safe to call from any thread.
+	* Reading asks for the bones in the following snapshots; until one carries them they are read directly from SteamVR
+	* @param bLeftHand - Whether or not retrieve values for the Left Hand instead of the Right Hand
+	* @param bMirror - Will mirror the pose read from SteamVR to fit the skeleton of the opposite hand
+	* @param MotionRange - Whether to retrieve skeletal anim values with or without controllers
+	* @param OutBoneTransform - The transform for each bone as defined in the SteamVR Skeleton
+	* @param OutBoneTransformCount - The number of elements in OutBoneTransform
+	* @return Whether or not the snapshot held skeletal data for this hand
+	*/
+	bool GetSkeletalDataSnapshot(bool bLeftHand, bool bMirror, EVRSkeletalMotionRange MotionRange, FTransform* OutBoneTransform, int32 OutBoneTransformCount);
+
+	/**
+	* Retrieve finger curls and splays from the last published snapshot. Safe to call from any thread.
+	* Like the bones, they are only published once something reads them
+	* @param bLeftHand - Whether or not retrieve values for the Left Hand instead of the Right Hand
+	* @param SummaryType - Whether to read values computed from the animation or directly from the device
+	* @param OutSummaryData - Will hold the curls and splays for this hand
+	* @return Whether or not the snapshot held summary data for this hand
+	*/
+	bool GetSkeletalSummarySnapshot(bool bLeftHand, EVRSummaryType SummaryType, VRSkeletalSummaryData_t& OutSummaryData) const;
+
+	/**
+	* Retrieve a hand's controller pose from the last published snapshot. Safe to call from any thread.
+	* Like the bones, it is only published once something reads it
+	* @param bLeftHand - Whether or not retrieve values for the Left Hand instead of the Right Hand
+	* @param OutPoseData - Will hold the raw SteamVR pose of the controller
+	* @return Whether or not the snapshot held a pose for this hand
+	*/
+	bool GetControllerPoseSnapshot(bool bLeftHand, InputPoseActionData_t& OutPoseData) const;
+
+	/**
+	* Retrieve an action's state from the last published snapshot. Safe to call from any thread
+	* @param ActionName - The SteamVR name of the action
+	* @param bOutState - The digital value of the action
+	* @param OutValue - The analog value of the action
+	* @return Whether or not the action was found in the snapshot
+	*/
+	bool GetActionStateSnapshot(FName ActionName, bool& bOutState, FVector& OutValue) const;
+
 	/**
 	* Retrieve the left hand pose information - position, orientation and velocities
 	* @return Position - Translation from the pose data matrix in UE coordinates
@@ -129,6 +196,192 @@ public:
 	/** Retrieve skeletal tracking level for all controllers */
 	void GetControllerFidelity();
 
+	/**
+	* Read a hand's finger curls and splays from SteamVR, if its skeletal controller is present and its skeletal action is active. Any thread
+	* @param bLeftHand - Whether or not retrieve values for the Left Hand instead of the Right Hand
+	* @param SummaryType - Whether to read values computed from the animation or directly from the device
+	* @param OutSummaryData - Will hold the curls and splays for this hand
+	* @return Whether or not SteamVR returned summary data for this hand
+	*/
+	bool GetSkeletalSummaryData(bool bLeftHand, EVRSummaryType SummaryType, VRSkeletalSummaryData_t& OutSummaryData) const;
+
+	/**
+	* Make calls into IVRInput that aren't wrapped by this device, holding the lock that keeps them from racing its polling thread and render thread pose reads
+	* @param Call - Callable making the calls, with no arguments
+	* @return What Call returned
+	*/
+	template<typename CallType>
+	auto CallInputRuntime(CallType Call) const -> decltype(Call())
+	{
+		FScopeLock InputRuntimeScopeLock(&InputRuntimeLock);
+		return Call();
+	}
+
+	/**
+	* Activate or deactivate an action set. Actions of inactive action sets are not polled or sent to the engine.
+	* Activating puts the action set on top of the action set stack like PushActionSet, deactivating takes it off the stack
+	* @param ActionSetName - The full name of the action set (e.g. /actions/main)
+	* @param bActive - Whether the action set should be active
+	* @return Whether or not the action set was found
+	*/
+	bool SetActionSetActive(FName ActionSetName, bool bActive);
+
+	/**
+	* Check whether an action set is active
+	* @param ActionSetName - The full name of the action set (e.g. /actions/main)
+	* @return Whether or not the action set was found and is active
+	*/
+	bool IsActionSetActive(FName ActionSetName) const;
+
+	/**
+	* Activate an action set on top of the currently active ones, optionally restricted to a single device
+	* @param ActionSetName - The full name of the action set (e.g. /actions/vehicle)
+	* @param RestrictedToDevicePath - Device path the action set is restricted to (e.g. /user/hand/left), empty for all devices
+	* @return Whether or not the action set was found
+	*/
+	bool PushActionSet(FName ActionSetName, const FString& RestrictedToDevicePath = FString());
+
+	/**
+	* Deactivate a pushed action set
+	* @param ActionSetName - The full name of the action set to deactivate, NAME_None for the most recently pushed one
+	* @return Whether or not an action set was deactivated
+	*/
+	bool PopActionSet(FName ActionSetName = NAME_None);
+
+	/**
+	* Set how far an analog action has to move before its new value is sent to the engine
+	* @param ActionName - The SteamVR name of the action
+	* @param Deadband - The minimum change in value, 0 sends any change
+	* @return Whether or not the action was found
+	*/
+	bool SetAnalogDeadband(FName ActionName, float Deadband);
+
+	/**
+	* Retrieve when SteamVR reported an action's latest events, with sub-frame precision, in FPlatformTime::Seconds() time.
+	* Times are updated before the matching event is sent to the engine, so they can be queried from input handlers
+	* @param ActionName - The SteamVR name of the action
+	* @param OutLastPressedTime - When the action was last pressed, 0 if never
+	* @param OutLastReleasedTime - When the action was last released, 0 if never
+	* @param OutLastEventTime - When the action's state or value last changed, 0 if never
+	* @return Whether or not the action was found
+	*/
+	bool GetActionEventTimes(FName ActionName, double& OutLastPressedTime, double& OutLastReleasedTime, double& OutLastEventTime) const;
+
+	/** Retrieve the counters of analog events sent to, and held back from, the engine */
+	const FSteamVRInputDispatchStats& GetDispatchStats() const { return DispatchStats; }
+
+	/** Reset the analog event counters */
+	void ResetDispatchStats();
+
+	/**
+	* Read digital actions on a dedicated thread so presses and releases shorter than a frame are not lost
+	* @param PollingRate - How many times per second digital actions are read, 0 reads them once per frame on the game thread
+	*/
+	void SetInputPollingRate(float PollingRate);
+
+	/** Retrieve how many times per second digital actions are read on the polling thread, 0 if they are read once per frame */
+	float GetInputPollingRate() const;
+
+	/**
+	* Play a multi-segment haptic pattern. Overlapping patterns on the same hand are merged and sent to SteamVR as future-dated vibrations
+	* @param Hand - Which hand to play the pattern on (left or right)
+	* @param Segments - The amplitude and frequency envelope of the pattern, played back to back
+	* @param StartSecondsFromNow - When to start the pattern
+	* @return An id to stop the pattern with, INDEX_NONE if it could not be scheduled
+	*/
+	int32 PlayHapticPattern(EControllerHand Hand, const TArray<FSteamVRHapticSegment>& Segments, float StartSecondsFromNow = 0.f);
+
+	/**
+	* Stop a haptic pattern before it ends
+	* @param PatternId - The id returned by PlayHapticPattern
+	* @return Whether or not the pattern was still playing
+	*/
+	bool StopHapticPattern(int32 PatternId);
+
+	/** Stop all haptic patterns playing on a hand */
+	void StopHapticPatterns(EControllerHand Hand);
+
+	/** Set how haptic requests and patterns that overlap on the same hand are mixed: the loudest plays, or they add up */
+	void SetHapticMixMode(EHapticMixMode MixMode);
+
+	/** Retrieve how haptic requests and patterns that overlap on the same hand are mixed */
+	EHapticMixMode GetHapticMixMode() const { return HapticScheduler.GetMixMode(); }
+
+	/**
+	* Play a sound as haptics. Its amplitude and frequency envelope is extracted on a worker thread the first time it is played
+	* @param Hand - Which hand to play on (left, right, or any for both)
+	* @param SoundWave - The sound to convert, needs either decompressed audio data or its editor source data
+	* @param Gain - Scale applied to the amplitude of the sound
+	* @param StartSecondsFromNow - When the sound starts playing
+	* @return Whether or not the sound can be converted
+	*/
+	bool PlayAudioHaptics(EControllerHand Hand, USoundWave* SoundWave, float Gain = 1.f, float StartSecondsFromNow = 0.f);
+
+	/**
+	* Stream the output of a submix as haptics, replacing the current stream if any. Requires the audio mixer
+	* @param Hand - Which hand to play on (left, right, or any for both)
+	* @param Submix - The submix to listen to, the master submix if null
+	* @param Gain - Scale applied to the amplitude of the audio
+	* @return Whether or not the submix could be listened to
+	*/
+	bool StartAudioHapticsStream(EControllerHand Hand, USoundSubmix* Submix, float Gain = 1.f);
+
+	/** Stop streaming submix audio as haptics */
+	void StopAudioHapticsStream();
+
+	/**
+	* Record everything read from SteamVR input, frame by frame, until StopInputRecording. Also started with -SteamVRInputRecord=<File>
+	* @param FilePath - Where the recording is written, relative to the project's Saved directory unless absolute
+	* @return Whether or not recording started
+	*/
+	bool StartInputRecording(const FString& FilePath);
+
+	/**
+	* Stop recording input and write the recording
+	* @return Whether or not a recording was written
+	*/
+	bool StopInputRecording();
+
+	/**
+	* Serve input from a recording instead of SteamVR, one recorded frame per frame, until StopInputReplay. Also started with -SteamVRInputReplay=<File>
+	* @param FilePath - The recording to replay, relative to the project's Saved directory unless absolute
+	* @return Whether or not the recording could be loaded
+	*/
+	bool StartInputReplay(const FString& FilePath);
+
+	/** Stop replaying input and go back to SteamVR */
+	void StopInputReplay();
+
+	/** Whether input is being recorded */
+	bool IsRecordingInput() const { return InputRecorder.IsValid(); }
+
+	/** Whether input is being served from a recording */
+	bool IsReplayingInput() const { return InputReplay.IsValid(); }
+
+	/**
+	* Serve every OpenVR call from a simulated headset, controllers and trackers instead of SteamVR, until StopMockRuntime.
+	* Also started with -SteamVRInputMock, -SteamVRInputMockTrackers=<Count> for generic trackers and -SteamVRInputMockFixedStep=<Seconds> for a fixed delta time
+	* @param Settings - What to simulate
+	* @return Whether or not the mock runtime started
+	*/
+	bool StartMockRuntime(const FSteamVRMockRuntimeSettings& Settings = FSteamVRMockRuntimeSettings());
+
+	/** Stop the mock runtime, and any recording of it, and go back to SteamVR */
+	void StopMockRuntime();
+
+	/** Retrieve the mock runtime, to drive its devices and actions, or null if it is not running */
+	FSteamVRMockRuntime* GetMockRuntime() { return MockRuntime.Get(); }
+
+	/**
+	* Set whether analog actions and finger curls/splays are only sent to the engine when their value moves beyond its deadband.
+	* Also read from [SteamVRInput] SendAnalogChangesOnly in the game config
+	* @param bChangesOnly - Whether to hold back values that did not move, false sends every value every frame
+	*/
+	void SetSendAnalogChangesOnly(bool bChangesOnly) { bSendAnalogChangesOnly = bChangesOnly; }
+
+	/** Whether analog actions and finger curls/splays are only sent to the engine when their value moves beyond its deadband */
+	bool GetSendAnalogChangesOnly() const { return bSendAnalogChangesOnly; }
+
 #if WITH_EDITOR
 	/** Have the action manifest regenerated. Used by the plugin Editor UI */
 	void RegenerateActionManifest();
@@ -197,12 +450,24 @@ public:
 	/** Holds the action sets that will be fed in to OpenVR  */
 	VRActiveActionSet_t ActiveActionSets[MAX_ACTION_SETS];
 
+	/** Number of entries in ActiveActionSets that are fed in to OpenVR  */
+	uint32 ActiveActionSetCount = 0;
+
+	/** Additional action sets declared in the project's game config  */
+	TArray<FSteamVRInputActionSetDefinition> ActionSetDefinitions;
+
+	/** Names of the action sets activated with PushActionSet or SetActionSetActive, most recent last. Deactivated action sets are removed */
+	TArray<FName> ActionSetStack;
+
 	/** Holds the actions that will be handled by the SteamVR Input System  */
 	TArray<FSteamVRInputAction> Actions;
 
 	/** Holds the actions that will be handled by the SteamVR Input System  */
 	TArray<FSteamVRInputAction> ActionEvents;
 
+	/** Handle and dispatch kind of each action event, in action events order, walked when processing controller events */
+	TArray<FSteamVRActionDispatch> ActionDispatchList;
+
 	/** A list of supported controller types that Controller Binding files will be generated for  */
 	TArray<FControllerType> ControllerTypes;
 
@@ -276,10 +541,13 @@ public:
 	VRActionHandle_t VRSkeletalHandleRight;
 
 	/** The handle for the vibration of the right hand  */
-	VRActionHandle_t VRVibrationLeft;
+	VRActionHandle_t VRVibrationLeft = k_ulInvalidActionHandle;
 
 	/** The handle for the vibration of the right hand  */
-	VRActionHandle_t VRVibrationRight;
+	VRActionHandle_t VRVibrationRight = k_ulInvalidActionHandle;
+
+	/** Motion source name to pose action handle lookup, rebuilt whenever action handles are (re)resolved  */
+	TMap<FName, FSteamVRMotionSourceHandles> MotionSourceHandles;
 
 	/** Current skeletal summary input values of the left hand  */
 	VRSkeletalSummaryData_t VRSkeletalSummaryDataLeft;
@@ -368,7 +636,150 @@ private:
 	void InitControllerKeys();
 
 	/** Process all input action events for a give action set */
-	void ProcessActionEvents(FSteamVRInputActionSet SteamVRInputActionSet);
+	void ProcessActionEvents(const FSteamVRInputActionSet& SteamVRInputActionSet);
+
+	/** Rebuild the action sets fed in to OpenVR from the currently active action sets */
+	void RebuildActiveActionSets();
+
+	/** Assign each action event to the action set its path belongs to */
+	void PartitionActionEvents();
+
+	/** Whether an analog value should be sent to the engine given the last value sent and its deadband */
+	bool ShouldSendAnalogValue(float NewValue, float LastSentValue, float Deadband) const;
+
+	/** Send a zero for any analog axis of the action that was left at a non-zero value */
+	void ZeroAnalogAction(FSteamVRInputAction& Action, EActionDispatchKind DispatchKind);
+
+	/** Send a zero for every analog action of the action set that was left at a non-zero value */
+	void ZeroActionSetAnalogs(const FSteamVRInputActionSet& SteamVRInputActionSet);
+
+	/**
+	* Release every digital action of the action set that is held and zero its analog actions, as they are no longer read once it is inactive.
+	* The polling thread's last seen states are reset too, so it sees a held button as a new press when the action set comes back. ActionStateLock must be held
+	*/
+	void ReleaseActionSetInputs(const FSteamVRInputActionSet& SteamVRInputActionSet);
+
+	/** Deactivate an action set, lift its device restriction, take it off the action set stack and release its inputs. ActionStateLock must be held */
+	void DeactivateActionSet(FSteamVRInputActionSet& SteamVRInputActionSet);
+
+	/** Counters of analog events sent to, and held back from, the engine */
+	FSteamVRInputDispatchStats DispatchStats;
+
+	friend class FSteamVRInputPoller;
+	friend class FSteamVRInputBenchmark;
+
+	/** Plays haptic patterns, flushed to SteamVR every Tick */
+	FSteamVRHapticScheduler HapticScheduler;
+
+	/** Converts sounds and submix audio to haptic patterns */
+	FSteamVRAudioHaptics AudioHaptics;
+
+	/** Reads digital actions between frames when a polling rate is set */
+	TUniquePtr<FSteamVRInputPoller> InputPoller;
+
+	/** Records what is read from SteamVR input while recording */
+	TUniquePtr<FSteamVRInputRecorder> InputRecorder;
+
+	/** Where the input recording is written once stopped */
+	FString InputRecordingPath;
+
+	/** Serves input from a recording while replaying */
+	TUniquePtr<FSteamVRInputReplay> InputReplay;
+
+	/** Whether the end of the input replay was reached */
+	bool bInputReplayEnded = false;
+
+	/** Simulates SteamVR while the mock runtime is running */
+	TUniquePtr<FSteamVRMockRuntime> MockRuntime;
+
+	/**
+	 * A device isolated from the engine, made by the input benchmark: dormant until a mock runtime is started on it, and not registered as a modular feature
+	 * @param InMessageHandler - Receives the controller events of the isolated device
+	 * @param bInIsIsolated - Whether to isolate the device from the engine
+	 */
+	FSteamVRInputDevice(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler, bool bInIsIsolated);
+
+	/** Whether the input benchmark runs on the next Tick, then exits (-SteamVRInputBenchmark) */
+	bool bRunBenchmarkOnTick = false;
+
+	/** Whether this device was made by the benchmark to run against a mock runtime, unknown to the engine */
+	bool bIsIsolated = false;
+
+	/** The startup action manifest build, written and registered with SteamVR on a worker thread. Not touched on the game thread until AsyncInitialization is ready */
+	TSharedPtr<FSteamVRActionManifestBuild, ESPMode::ThreadSafe> AsyncManifestBuild;
+
+	/** Completes when AsyncManifestBuild is ready to be applied, invalid when no build is in flight */
+	TFuture<void> AsyncInitialization;
+
+	/** Where the input device stands with SteamVR, dormant for the whole session with -nohmd */
+	ESteamVRConnectionState ConnectionState = SteamVRConnection_Disconnected;
+
+	/** When SteamVR is probed again while disconnected, in FPlatformTime::Seconds */
+	double NextReconnectTime = 0.0;
+
+	/** How long to wait after the next failed connection before probing again */
+	double ReconnectInterval = RECONNECT_INTERVAL_MIN;
+
+	/** The OpenVR init token when SteamVR connected, it changes when the HMD module shuts SteamVR down or reinitializes it after a restart */
+	uint32 ConnectedInitToken = 0;
+
+	/** Guards the action lists and action sets the polling thread reads, and the polled digital states it publishes to */
+	mutable FCriticalSection ActionStateLock;
+
+	/**
+	* Serializes single calls that update or read SteamVR action state between the polling thread and the game and render threads,
+	* and keeps the polling thread out of SteamVR while the runtime is switched or reloaded. Taken after ActionStateLock when both are needed
+	*/
+	mutable FCriticalSection InputRuntimeLock;
+
+	/** Last digital state seen by the polling thread, indexed like ActionEvents. Guarded by ActionStateLock */
+	TArray<bool> PolledDigitalStates;
+
+	/** Bumped whenever the action lists, active action sets or polled states change, so a poll that read SteamVR across a change drops its results. Guarded by ActionStateLock */
+	uint32 ActionStateGeneration = 0;
+
+	/** The active action sets the polling thread passes to SteamVR, copied at the start of each poll. Polling thread only */
+	TArray<VRActiveActionSet_t> PolledActionSets;
+
+	/** The digital actions the polling thread reads and what SteamVR reported for them. Polling thread only */
+	TArray<FSteamVRPolledDigitalAction> PolledDigitalActions;
+
+	/** Read the digital actions of all active action sets and queue their transitions. Polling thread only */
+	void PollDigitalActions(FSteamVRInputPoller& Poller);
+
+	/** Send the digital action transitions queued by the polling thread to the engine, in the order they happened */
+	void DrainPolledDigitalEvents();
+
+	/** Drop queued digital action transitions and restart polling from the current action states. Requires ActionStateLock */
+	void ResetPolledDigitalStates();
+
+	/**
+	* Update a digital action and send its transition to the engine
+	* @param Action - The digital action that changed
+	* @param bState - The new state of the action
+	* @param ActiveOrigin - The input value handle of the origin of the transition
+	* @param EventTime - When SteamVR saw the transition, in FPlatformTime::Seconds() time
+	*/
+	void DispatchDigitalAction(FSteamVRInputAction& Action, bool bState, VRInputValueHandle_t ActiveOrigin, double EventTime);
+
+	/** Whether analog actions and finger curls/splays are only sent to the engine when their value moves beyond its deadband */
+	bool bSendAnalogChangesOnly = true;
+
+	/** Last curl value sent to the engine, for the left [0] and right [1] hands, indexed by EVRFinger */
+	float LastCurlValues[2][VRFinger_Count] = {};
+
+	/** Last splay value sent to the engine, for the left [0] and right [1] hands, indexed by EVRFingerSplay */
+	float LastSplayValues[2][VRFingerSplay_Count] = {};
+
+	/** Read the additional action sets declared in the project's game config */
+	void LoadActionSetDefinitions();
+
+	/**
+	* Retrieve the input path of the action set that a project input action or axis belongs to
+	* @param InputName - The name of the project input action or axis
+	* @return The input path of its action set (e.g. /actions/vehicle/in), main if it is not listed in any action set
+	*/
+	FString GetActionPathIn(FName InputName) const;
 
 	/**
 	* Create the action manifest used by the SteamVR Input System
@@ -380,6 +791,54 @@ private:
 	*/
 	void GenerateActionManifest(bool GenerateActions=true, bool GenerateBindings=true, bool RegisterApp=true, bool DeleteBindings=false, bool bRegisterManifestOnly=false);
 
+	/**
+	* Build the action manifest's actions and action sets from the project input settings, registering the temporary keys they need. Game thread only
+	* @param Build - The action manifest being built
+	*/
+	void GatherActionManifest(FSteamVRActionManifestBuild& Build);
+
+	/**
+	* Find and generate the controller bindings, then write the action manifest. Any thread, unless existing bindings are overwritten
+	* @param Build - The action manifest being built
+	* @return Whether or not the action manifest could be written
+	*/
+	bool WriteActionManifest(FSteamVRActionManifestBuild& Build);
+
+	/**
+	* Make the action manifest's handles the ones the input device reads, and rebuild the action events from its actions. Game thread only
+	* @param Build - The action manifest that was built
+	*/
+	void ApplyActionManifest(FSteamVRActionManifestBuild& Build);
+
+	/** Gather the action manifest, then write it, register it and resolve its handles on a worker thread, so startup doesn't wait on file I/O or SteamVR */
+	void BeginAsyncInitialization();
+
+	/**
+	* Serve every OpenVR call from a mock runtime, leaving its handles to be resolved by the caller
+	* @param Settings - What to simulate
+	* @return Whether or not the mock runtime was installed
+	*/
+	bool InstallMockRuntime(const FSteamVRMockRuntimeSettings& Settings);
+
+	/**
+	* Apply the action manifest built at startup once its worker is done, then bring input online. Game thread only
+	* @param bWait - Whether to block until the worker is done
+	* @return Whether or not no build is in flight anymore
+	*/
+	bool FinishAsyncInitialization(bool bWait);
+
+	/**
+	* Record the outcome of a connection attempt, scheduling the next probe with backoff if it failed
+	* @param bIsConnected - Whether or not SteamVR was available
+	*/
+	void SetConnectionResult(bool bIsConnected);
+
+	/** Reconnect once the backoff elapses while disconnected, and detect SteamVR shutting down or restarting while connected. Game thread only */
+	void UpdateConnection();
+
+	/** Whether SteamVR, a mock runtime or input replay can be read without probing for SteamVR */
+	bool IsSteamVRActive() const;
+
 	/**
 	* Create the application manifest for an Editor session
 	* @param ManifestPath - Where the action manifest is located. By default this is under Config/SteamVRBindings
@@ -415,19 +874,96 @@ private:
 	/** Remove any invalid action to Axis mappings so they won#t be generated by the plugin */
 	void SanitizeActions();
 
+	/** Map each supported motion source name to the pose handles that drive it. Called once action handles are known */
+	void BuildMotionSourceHandles();
+
+	/**
+	* Retrieve the pose for an action, honoring the global prediction setting.
+	* On the game thread the pose is read from SteamVR at most once per frame and served from PoseCache afterwards
+	* @param ActionHandle - The pose action to read
+	* @param OutPoseData - Will hold the pose data read from SteamVR
+	* @return The result of the SteamVR Input call
+	*/
+	EVRInputError GetPoseActionData(VRActionHandle_t ActionHandle, InputPoseActionData_t& OutPoseData) const;
+
+	/**
+	* Read the pose for an action directly from SteamVR, bypassing the per-frame cache
+	* @param ActionHandle - The pose action to read
+	* @param OutPoseData - Will hold the pose data read from SteamVR
+	* @return The result of the SteamVR Input call
+	*/
+	EVRInputError QueryPoseActionData(VRActionHandle_t ActionHandle, InputPoseActionData_t& OutPoseData) const;
+
+	/**
+	* Read a hand's finger curls and splays directly from SteamVR. Any thread
+	* @param bLeftHand - Whether or not retrieve values for the Left Hand instead of the Right Hand
+	* @param SummaryType - Whether to read values computed from the animation or directly from the device
+	* @param OutSummaryData - Will hold the curls and splays for this hand
+	* @return Whether or not SteamVR returned summary data for this hand
+	*/
+	bool QuerySkeletalSummaryData(bool bLeftHand, EVRSummaryType SummaryType, VRSkeletalSummaryData_t& OutSummaryData) const;
+
+	/**
+	* Write the runtime in use, the action, controller, skeletal, vibration and tracker handles, and the prediction and dispatch settings (steamvr.input.dump)
+	* @param Ar - Where the report is written
+	*/
+	void DumpInputState(FOutputDevice& Ar);
+
 	/**
-	* Registers an Editor session to the SteamVR system
-	* @param ManifestPath - Path to the Application Manifest that will be generated. By default this will be under the Config folder
+	* Write every action set with its priority, handle and device restriction, and the active action set stack (steamvr.input.sets)
+	* @param Ar - Where the report is written
 	*/
-	void RegisterApplication(FString ManifestPath, bool bRegisterManifestOnly=false);
+	void DumpActionSets(FOutputDevice& Ar) const;
+
+	/** Poses read this frame, keyed by action handle. Only touched from the game thread */
+	mutable TMap<VRActionHandle_t, FSteamVRCachedPose> PoseCache;
+
+	/** Skeletal bones read this frame, indexed by hand (left, right) and motion range (with, without controller) */
+	FSteamVRCachedSkeleton SkeletalCache[2][2];
+
+	/** Guards SkeletalCache against GetSkeletalData calls made off the game thread */
+	FCriticalSection SkeletalCacheLock;
+
+	/** Per-frame input snapshots. The game thread writes one while readers use the last published one */
+	FSteamVRInputSnapshotBuffer InputSnapshots[INPUT_SNAPSHOT_BUFFER_COUNT];
+
+	/** Index into InputSnapshots of the last complete snapshot, INDEX_NONE until the first one is published */
+	volatile int32 PublishedSnapshotIndex = INDEX_NONE;
+
+	/** Snapshot data read since the last snapshot was published, one bit per hand and variant. Set from any thread */
+	mutable volatile int32 SnapshotRequests = 0;
+
+	/**
+	* Ask for data to be carried by the following snapshots
+	* @param Request - The SnapshotRequests bits of the data being read
+	*/
+	void RequestSnapshotData(int32 Request) const;
+
+	/** Fill the next snapshot buffer with this frame's action states and the requested skeletal and pose data, and publish it to readers. Game thread only */
+	void PublishInputSnapshot();
+
+	/**
+	* Run a reader against the last published snapshot, retrying if the game thread recycled the buffer mid-read
+	* @param Reader - Callable taking a const FSteamVRInputSnapshot& that copies out what it needs and returns whether it found it
+	* @return The reader's result, or false if no consistent snapshot could be read
+	*/
+	template<typename ReaderType>
+	bool ReadInputSnapshot(ReaderType Reader) const;
+
+	/**
+	* Registers an Editor session and the action manifest to the SteamVR system, and resolves the action manifest's handles. Any thread
+	* @param Build - The action manifest being built, receives the resolved handles
+	*/
+	void RegisterApplication(FSteamVRActionManifestBuild& Build);
 
 	/** 
 	* Get the Skeletal Input Handle for a give controller input path
+	* @param Build - The action manifest being registered, receives any error
 	* @param ActionPath - The SteamVR user path for the controller hand we want the skeletal handle for
 	* @param SkeletalHandle - Will hold the skeletal handle if found. k_InvalidHandleValue if an error is encountered
 	* @return Whether or not Whether the Skeletal Handle was successfully read
 	*/	
-	bool SetSkeletalHandle(char* ActionPath, VRActionHandle_t& SkeletalHandle);
+	bool SetSkeletalHandle(FSteamVRActionManifestBuild& Build, char* ActionPath, VRActionHandle_t& SkeletalHandle);
 
 	/**
 	* Look for any Key Mappings defined in the project's DefaultInput.ini 
@@ -456,9 +992,11 @@ private:
 	* Send the axis value for the given controller input
 	* @param TrackedControllerRole - The tracking type/role for this controller
 	* @param AxisButton - The type of button the value is associated with
+	* @param bIsSplay - Whether the value is a splay between two fingers rather than a finger curl
+	* @param FingerIndex - The EVRFinger of a curl, or the EVRFingerSplay of a splay
 	* @param AnalogValue - The input value (float) that is being sent
 	*/
-	void SendAnalogMessage(const ETrackedControllerRole TrackedControllerRole, const FGamepadKeyNames::Type AxisButton, float AnalogValue);
+	void SendAnalogMessage(const ETrackedControllerRole TrackedControllerRole, const FGamepadKeyNames::Type AxisButton, bool bIsSplay, int32 FingerIndex, float AnalogValue);
 
 	/**
 	* Remove any unsupported special characters on a provide string
@@ -474,6 +1012,29 @@ private:
 	*/
 	void MirrorSteamVRSkeleton(VRBoneTransform_t* BoneTransformsLS, int32 BoneTransformCount) const;
 
+	/** Per-bone conversions from SteamVR to UE4 space, unmirrored [0] and mirrored [1] */
+	FSteamVRBoneConversion BoneConversions[2][STEAMVR_SKELETON_BONE_COUNT];
+
+	/** Build BoneConversions from the scalar mirroring and conversion steps */
+	void InitBoneConversions();
+
+	/**
+	* Mirror (optionally) and convert a SteamVR skeleton to UE4 space in a single vectorized pass
+	* @param SteamVRBoneTransforms - The parent space bone transforms read from SteamVR
+	* @param bMirror - Whether to mirror the pose to fit the skeleton of the opposite hand
+	* @param OutBoneTransform - Will hold the STEAMVR_SKELETON_BONE_COUNT converted bone transforms
+	*/
+	void ConvertSteamVRSkeleton(const VRBoneTransform_t* SteamVRBoneTransforms, bool bMirror, FTransform* OutBoneTransform) const;
+
+	/**
+	* Mirror (optionally) and convert a SteamVR skeleton to UE4 space in separate scalar passes, one bone and component at a time.
+	* The reference BoneConversions are built from, and that ConvertSteamVRSkeleton is benchmarked against
+	* @param SteamVRBoneTransforms - The parent space bone transforms read from SteamVR
+	* @param bMirror - Whether to mirror the pose to fit the skeleton of the opposite hand
+	* @param OutBoneTransform - Will hold the STEAMVR_SKELETON_BONE_COUNT converted bone transforms
+	*/
+	void ConvertSteamVRSkeletonScalar(const VRBoneTransform_t* SteamVRBoneTransforms, bool bMirror, FTransform* OutBoneTransform) const;
+
 	/** Our Message handler to direct input from the SteamVRInput System to the game runtime */
 	TSharedRef<FGenericApplicationMessageHandler> MessageHandler;
 
@@ -525,6 +1086,9 @@ private:
 	/** Base Position defined by the XRTrackingSystem */
 	FVector CachedBasePosition;
 
+	/** Tracking space reported by the compositor, refreshed every Tick */
+	ETrackingUniverseOrigin CachedTrackingSpace = TrackingUniverseStanding;
+
 	/**
 	*	Utility function to clear any accidentally saved temporary actions in this project's Input ini
 	*	@param InputSettings - This project's input settings
@@ -532,9 +1096,15 @@ private:
 	*/
 	uint32 ClearTemporaryActions();
 
+	/** Haptic requests made this frame for the left [0] and right [1] hands, mixed and sent to the haptic scheduler at the end of Tick */
+	FSteamVRHapticFrameRequest HapticFrameRequests[2];
+
 	/**
-	* Buffer for current delta time to get an accurate approximation of how long to play haptics for
+	* Mix a haptic request into this frame's requests of the hands it is for
+	* @param Hand - Which hand the request is for, any for both
+	* @param Amplitude - Requested amplitude [0..1], 0 to stop vibrating
+	* @param Frequency - Requested frequency
 	*/
-	float CurrentDeltaTime;
+	void AddHapticFrameRequest(EControllerHand Hand, float Amplitude, float Frequency);
 
 };
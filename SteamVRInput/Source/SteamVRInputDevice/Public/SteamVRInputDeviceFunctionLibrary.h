@@ -310,6 +310,38 @@ struct STEAMVRINPUTDEVICE_API FSteamVRInputBindingInfo
 	}
 };
 
+/** One segment of a haptic pattern. Frequency and amplitude ramp linearly from their start to their end value over the segment */
+USTRUCT(BlueprintType)
+struct STEAMVRINPUTDEVICE_API FSteamVRHapticPatternSegment
+{
+	GENERATED_BODY()
+
+	/** How long this segment plays, in seconds */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SteamVR Input", meta = (ClampMin = "0.0"))
+	float	Duration;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SteamVR Input", meta = (ClampMin = "0.0"))
+	float	StartFrequency;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SteamVR Input", meta = (ClampMin = "0.0"))
+	float	EndFrequency;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SteamVR Input", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float	StartAmplitude;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SteamVR Input", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float	EndAmplitude;
+
+	FSteamVRHapticPatternSegment()
+	{
+		Duration = 0.1f;
+		StartFrequency = 1.f;
+		EndFrequency = 1.f;
+		StartAmplitude = 0.5f;
+		EndAmplitude = 0.5f;
+	}
+};
+
 /** Convenience type for SteamVR Hand designation (Left/Right) */
 UENUM(BlueprintType)	
 enum class ESteamVRHand : uint8
@@ -400,11 +432,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SteamVR Input")
 	static void GetFingerCurlsAndSplays(EHand Hand, FSteamVRFingerCurls& FingerCurls, FSteamVRFingerSplays& FingerSplays, ESkeletalSummaryDataType SummaryDataType = ESkeletalSummaryDataType::VR_SummaryType_FromAnimation);
 
+	/**
+	* Get the finger curl and splay for a give hand in the current frame, from the given SteamVR Input device
+	* @param SteamVRInputDevice - The device whose skeletal actions are read
+	* @param Hand - Which hand to get the finger curls and splay values for
+	* @param FingerCurls - Curl values for each finger pair this frame
+	*/
+	static void GetDeviceFingerCurlsAndSplays(FSteamVRInputDevice* SteamVRInputDevice, EHand Hand, FSteamVRFingerCurls& FingerCurls, FSteamVRFingerSplays& FingerSplays, ESkeletalSummaryDataType SummaryDataType = ESkeletalSummaryDataType::VR_SummaryType_FromAnimation);
+
 	/**
 	* Generate haptic feedback in the requested controller
 	* @param Hand - Which hand to send the controller feedback to
 	* @param StartSecondsFromNow - When to start the haptic feedback
-	* @param DurationSeconds - How long to have the haptic feedback active
+	* @param DurationSeconds - How long to have the haptic feedback active, 0 for the shortest pulse
 	* @param Frequency - Frequency used in the haptic feedback
 	* @param Amplitude - Amplitude used in the haptic feedback
 	*/
@@ -412,6 +452,50 @@ public:
 	static void PlaySteamVR_HapticFeedback(ESteamVRHand Hand, float StartSecondsFromNow, float DurationSeconds = 1.f,
 			float Frequency = 1.f, float Amplitude = 0.5f);
 
+	/**
+	* Play a multi-segment haptic pattern in the requested controller, without having to trigger each pulse every tick.
+	* Overlapping patterns on the same hand are merged, the loudest one plays
+	* @param Hand - Which hand to play the pattern on
+	* @param Segments - The frequency and amplitude envelope of the pattern, played back to back
+	* @param StartSecondsFromNow - When to start the pattern
+	* @return int32 - An id to stop the pattern with, -1 if it could not be played
+	*/
+	UFUNCTION(BlueprintCallable, Category="SteamVR Input")
+	static int32 PlaySteamVR_HapticPattern(ESteamVRHand Hand, const TArray<FSteamVRHapticPatternSegment>& Segments, float StartSecondsFromNow = 0.f);
+
+	/**
+	* Stop a haptic pattern before it ends
+	* @param PatternId - The id returned when the pattern was played
+	* @return bool - Whether or not the pattern was still playing
+	*/
+	UFUNCTION(BlueprintCallable, Category="SteamVR Input")
+	static bool StopSteamVR_HapticPattern(int32 PatternId);
+
+	/**
+	* Play a sound as haptic feedback in the requested controller. The sound's amplitude and frequency are extracted in the background the first time it is played
+	* @param Hand - Which hand to play the sound on
+	* @param SoundWave - The sound to play, needs decompressed audio data (or editor source data when playing in editor)
+	* @param Gain - Scale applied to the amplitude of the sound
+	* @param StartSecondsFromNow - When the sound starts playing
+	* @return bool - Whether or not the sound can be played as haptics
+	*/
+	UFUNCTION(BlueprintCallable, Category="SteamVR Input")
+	static bool PlaySteamVR_AudioHaptics(ESteamVRHand Hand, USoundWave* SoundWave, float Gain = 1.f, float StartSecondsFromNow = 0.f);
+
+	/**
+	* Stream the audio of a submix as haptic feedback in the requested controller, replacing the current stream if any. Requires the audio mixer
+	* @param Hand - Which hand to play the audio on
+	* @param Submix - The submix to listen to. Leave empty for the master submix
+	* @param Gain - Scale applied to the amplitude of the audio
+	* @return bool - Whether or not the submix could be listened to
+	*/
+	UFUNCTION(BlueprintCallable, Category="SteamVR Input")
+	static bool StartSteamVR_AudioHapticsStream(ESteamVRHand Hand, USoundSubmix* Submix, float Gain = 1.f);
+
+	/** Stop streaming submix audio as haptic feedback */
+	UFUNCTION(BlueprintCallable, Category="SteamVR Input")
+	static void StopSteamVR_AudioHapticsStream();
+
 	/**
 	* Check Whether or not Curls and Splay values are being retrieved per frame from the SteamVR Input System
 	* @return LeftHandState - Whether or not curls and splay values are being retrieved from the left hand
@@ -513,6 +597,59 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SteamVR Input")
 	static void GetSteamVR_ActionSetArray(TArray<FSteamVRActionSet>& SteamVRActionSets);
 
+	/**
+	* Activate or deactivate an input action set. Actions in inactive action sets are not polled or sent to the engine
+	* @param ActionSet - The name of the action set (e.g. main). Default is "main"
+	* @param bIsActive - Whether the action set should be active
+	* @return bool - Whether or not the action set was found
+	*/
+	UFUNCTION(BlueprintCallable, Category = "SteamVR Input")
+	static bool SetSteamVR_ActionSetActive(FName ActionSet = FName("main"), bool bIsActive = true);
+
+	/**
+	* Check whether an input action set is active
+	* @param ActionSet - The name of the action set (e.g. main). Default is "main"
+	* @return bool - Whether or not the action set was found and is active
+	*/
+	UFUNCTION(BlueprintCallable, Category = "SteamVR Input")
+	static bool IsSteamVR_ActionSetActive(FName ActionSet = FName("main"));
+
+	/**
+	* Activate an input action set on top of the currently active ones (e.g. when entering a vehicle or opening a menu)
+	* @param ActionSet - The name of the action set (e.g. vehicle)
+	* @param RestrictedToDevicePath - Device path the action set is restricted to (e.g. /user/hand/left). Leave empty for all devices
+	* @return bool - Whether or not the action set was found
+	*/
+	UFUNCTION(BlueprintCallable, Category = "SteamVR Input")
+	static bool PushSteamVR_ActionSet(FName ActionSet, FString RestrictedToDevicePath);
+
+	/**
+	* Deactivate an input action set that was previously pushed
+	* @param ActionSet - The name of the action set (e.g. vehicle). Leave as None for the most recently pushed action set
+	* @return bool - Whether or not an action set was deactivated
+	*/
+	UFUNCTION(BlueprintCallable, Category = "SteamVR Input")
+	static bool PopSteamVR_ActionSet(FName ActionSet = NAME_None);
+
+	/**
+	* Retrieve how long ago SteamVR reported an action as pressed and released, with sub-frame precision.
+	* Use to compensate timing sensitive mechanics for the up to one frame delay before input events are processed
+	* @param ActionName - The name of the action (e.g. Teleport)
+	* @return SecondsSincePressed - Seconds since the action was last pressed, negative if it never was
+	* @return SecondsSinceReleased - Seconds since the action was last released, negative if it never was
+	* @return bool - Whether or not the action was found
+	*/
+	UFUNCTION(BlueprintCallable, Category = "SteamVR Input")
+	static bool GetSteamVR_ActionEventTimes(FName ActionName, float& SecondsSincePressed, float& SecondsSinceReleased);
+
+	/**
+	* Read digital actions on a dedicated thread so that presses and releases shorter than a frame are not lost
+	* @param PollingRate - How many times per second digital actions are read (e.g. 1000). 0 reads them once per frame
+	* @return bool - Whether or not the SteamVR input device was found
+	*/
+	UFUNCTION(BlueprintCallable, Category = "SteamVR Input")
+	static bool SetSteamVR_InputPollingRate(float PollingRate = 0.f);
+
 	/**
 	* Returns information about the tracked device associated from the input source.
 	* @param SteamVRAction - The action that's the source of the input
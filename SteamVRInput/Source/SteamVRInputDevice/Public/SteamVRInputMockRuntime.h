@@ -0,0 +1,369 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+#include "SteamVRInputTypes.h"
+#include "SteamVRInputNullRuntime.h"
+
+class FSteamVRMockRuntime;
+
+/** A tracked device simulated by FSteamVRMockRuntime */
+struct FSteamVRMockDevice
+{
+	ETrackedDeviceClass DeviceClass = TrackedDeviceClass_Invalid;
+	ETrackedControllerRole ControllerRole = TrackedControllerRole_Invalid;
+
+	/** Reported as Prop_ModelNumber_String */
+	FString ModelNumber;
+
+	/** Reported as Prop_SerialNumber_String */
+	FString SerialNumber;
+
+	/** The input source path of the device, e.g. /user/hand/left, empty if it has no inputs */
+	FString InputSourcePath;
+
+	/** Where the device is, in meters in OpenVR's tracking space */
+	TrackedDevicePose_t Pose;
+
+	/** Whether the simulation moves the device, cleared once its pose is set explicitly */
+	bool bIsAnimated = true;
+
+	FSteamVRMockDevice()
+	{
+		FMemory::Memzero(Pose);
+	}
+};
+
+/** What FSteamVRMockRuntime simulates */
+struct FSteamVRMockRuntimeSettings
+{
+	/** How many generic trackers to simulate besides the headset and both controllers */
+	int32 TrackerCount = 0;
+
+	/** How many base stations to simulate */
+	int32 TrackingReferenceCount = 2;
+
+	/** Whether the controllers report hand skeletons */
+	bool bHasSkeletalHands = true;
+
+	/** Whether devices move, fingers curl and actions that were not set explicitly change on every Tick */
+	bool bIsAnimated = true;
+
+	/** Seconds every Tick advances the simulation by whatever the frame took, so runs animate the same frame by frame. 0 follows the frame's delta time */
+	float FixedDeltaTime = 0.f;
+};
+
+/** An action of the mock runtime, created the first time its handle is requested */
+struct FSteamVRMockAction
+{
+	/** The action path, lower case */
+	FString Path;
+
+	/** The device the pose, skeleton and origin of the action come from, k_unTrackedDeviceIndexInvalid for none */
+	TrackedDeviceIndex_t DeviceIndex = k_unTrackedDeviceIndexInvalid;
+
+	/** Whether the simulation changes the state of the action, cleared once its state is set explicitly */
+	bool bIsAnimated = true;
+
+	/** The state the next UpdateActionState reads */
+	bool bPendingState = false;
+	FVector PendingValue = FVector::ZeroVector;
+
+	/** The state as of the last UpdateActionState */
+	bool bState = false;
+	bool bChanged = false;
+	FVector Value = FVector::ZeroVector;
+	FVector Delta = FVector::ZeroVector;
+
+	/** Simulation time the state last changed */
+	double LastChangeTime = 0.0;
+};
+
+/** The IVRSystem of FSteamVRMockRuntime, reporting its simulated devices */
+class STEAMVRINPUTDEVICE_API FSteamVRMockSystem : public FSteamVRNullSystem
+{
+public:
+	explicit FSteamVRMockSystem(FSteamVRMockRuntime& InRuntime) : Runtime(InRuntime) {}
+
+	// IVRSystem interface
+	virtual void GetDeviceToAbsoluteTrackingPose(ETrackingUniverseOrigin eOrigin, float fPredictedSecondsToPhotonsFromNow, TrackedDevicePose_t* pTrackedDevicePoseArray, uint32_t unTrackedDevicePoseArrayCount) override;
+	virtual uint32_t GetSortedTrackedDeviceIndicesOfClass(ETrackedDeviceClass eTrackedDeviceClass, TrackedDeviceIndex_t* punTrackedDeviceIndexArray, uint32_t unTrackedDeviceIndexArrayCount, TrackedDeviceIndex_t unRelativeToTrackedDeviceIndex) override;
+	virtual EDeviceActivityLevel GetTrackedDeviceActivityLevel(TrackedDeviceIndex_t unDeviceId) override;
+	virtual TrackedDeviceIndex_t GetTrackedDeviceIndexForControllerRole(ETrackedControllerRole unDeviceType) override;
+	virtual ETrackedControllerRole GetControllerRoleForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex) override;
+	virtual ETrackedDeviceClass GetTrackedDeviceClass(TrackedDeviceIndex_t unDeviceIndex) override;
+	virtual bool IsTrackedDeviceConnected(TrackedDeviceIndex_t unDeviceIndex) override;
+	virtual float GetFloatTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual int32_t GetInt32TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual uint32_t GetStringTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, char* pchValue, uint32_t unBufferSize, ETrackedPropertyError* pError) override;
+	virtual bool IsInputAvailable() override;
+	virtual const char* GetRuntimeVersion() override;
+
+private:
+	FSteamVRMockRuntime& Runtime;
+};
+
+/** The IVRCompositor of FSteamVRMockRuntime, reporting the poses of its simulated devices */
+class STEAMVRINPUTDEVICE_API FSteamVRMockCompositor : public FSteamVRNullCompositor
+{
+public:
+	explicit FSteamVRMockCompositor(FSteamVRMockRuntime& InRuntime) : Runtime(InRuntime) {}
+
+	// IVRCompositor interface
+	virtual EVRCompositorError WaitGetPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount) override;
+	virtual EVRCompositorError GetLastPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount) override;
+	virtual EVRCompositorError GetLastPoseForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex, TrackedDevicePose_t* pOutputPose, TrackedDevicePose_t* pOutputGamePose) override;
+
+private:
+	FSteamVRMockRuntime& Runtime;
+};
+
+/** The IVRInput of FSteamVRMockRuntime, reading its simulated actions and hands */
+class STEAMVRINPUTDEVICE_API FSteamVRMockInput : public IVRInput
+{
+public:
+	explicit FSteamVRMockInput(FSteamVRMockRuntime& InRuntime) : Runtime(InRuntime) {}
+	virtual ~FSteamVRMockInput() {}
+
+	// IVRInput interface
+	virtual EVRInputError SetActionManifestPath(const char* pchActionManifestPath) override;
+	virtual EVRInputError GetActionSetHandle(const char* pchActionSetName, VRActionSetHandle_t* pHandle) override;
+	virtual EVRInputError GetActionHandle(const char* pchActionName, VRActionHandle_t* pHandle) override;
+	virtual EVRInputError GetInputSourceHandle(const char* pchInputSourcePath, VRInputValueHandle_t* pHandle) override;
+	virtual EVRInputError UpdateActionState(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount) override;
+	virtual EVRInputError GetDigitalActionData(VRActionHandle_t action, InputDigitalActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetAnalogActionData(VRActionHandle_t action, InputAnalogActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetPoseActionDataRelativeToNow(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, float fPredictedSecondsFromNow, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetPoseActionDataForNextFrame(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetSkeletalActionData(VRActionHandle_t action, InputSkeletalActionData_t* pActionData, uint32_t unActionDataSize) override;
+	virtual EVRInputError GetBoneCount(VRActionHandle_t action, uint32_t* pBoneCount) override;
+	virtual EVRInputError GetBoneHierarchy(VRActionHandle_t action, BoneIndex_t* pParentIndices, uint32_t unIndexArayCount) override;
+	virtual EVRInputError GetBoneName(VRActionHandle_t action, BoneIndex_t nBoneIndex, char* pchBoneName, uint32_t unNameBufferSize) override;
+	virtual EVRInputError GetSkeletalReferenceTransforms(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalReferencePose eReferencePose, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError GetSkeletalTrackingLevel(VRActionHandle_t action, EVRSkeletalTrackingLevel* pSkeletalTrackingLevel) override;
+	virtual EVRInputError GetSkeletalBoneData(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalMotionRange eMotionRange, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError GetSkeletalSummaryData(VRActionHandle_t action, EVRSummaryType eSummaryType, VRSkeletalSummaryData_t* pSkeletalSummaryData) override;
+	virtual EVRInputError GetSkeletalBoneDataCompressed(VRActionHandle_t action, EVRSkeletalMotionRange eMotionRange, void* pvCompressedData, uint32_t unCompressedSize, uint32_t* punRequiredCompressedSize) override;
+	virtual EVRInputError DecompressSkeletalBoneData(const void* pvCompressedBuffer, uint32_t unCompressedBufferSize, EVRSkeletalTransformSpace eTransformSpace, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError TriggerHapticVibrationAction(VRActionHandle_t action, float fStartSecondsFromNow, float fDurationSeconds, float fFrequency, float fAmplitude, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t digitalActionHandle, VRInputValueHandle_t* originsOut, uint32_t originOutCount) override;
+	virtual EVRInputError GetOriginLocalizedName(VRInputValueHandle_t origin, char* pchNameArray, uint32_t unNameArraySize, int32_t unStringSectionsToInclude) override;
+	virtual EVRInputError GetOriginTrackedDeviceInfo(VRInputValueHandle_t origin, InputOriginInfo_t* pOriginInfo, uint32_t unOriginInfoSize) override;
+	virtual EVRInputError GetActionBindingInfo(VRActionHandle_t action, InputBindingInfo_t* pOriginInfo, uint32_t unBindingInfoSize, uint32_t unBindingInfoCount, uint32_t* punReturnedBindingInfoCount) override;
+	virtual EVRInputError ShowActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t ulActionHandle) override;
+	virtual EVRInputError ShowBindingsForActionSet(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount, VRInputValueHandle_t originToHighlight) override;
+	virtual bool IsUsingLegacyInput() override;
+	virtual EVRInputError OpenBindingUI(const char* pchAppKey, VRActionSetHandle_t ulActionSetHandle, VRInputValueHandle_t ulDeviceHandle, bool bShowOnDesktop) override;
+
+private:
+	FSteamVRMockRuntime& Runtime;
+};
+
+/**
+* An in-process stand-in for SteamVR, so the plugin's code paths run without a headset, SteamVR or a GPU.
+* It simulates a headset, two controllers with hand skeletons, base stations and any number of generic trackers,
+* and creates actions on demand: pose and skeletal actions follow the device their path names (left, right, tracker),
+* digital and analog actions hold whatever they are set to. With animation on, every Tick moves the devices, curls
+* the fingers and presses, releases and sweeps the actions that were not set explicitly, deterministically from the
+* time ticked so far. That time only repeats from run to run with a fixed delta time (FixedDeltaTime)
+*/
+class STEAMVRINPUTDEVICE_API FSteamVRMockRuntime
+{
+public:
+	explicit FSteamVRMockRuntime(const FSteamVRMockRuntimeSettings& InSettings = FSteamVRMockRuntimeSettings());
+	~FSteamVRMockRuntime();
+
+	/** Serve every OpenVR call of the plugin from this runtime, in place of SteamVR or whatever served them. Game thread only, while no other thread is using the interfaces */
+	void Install();
+
+	/** Go back to serving OpenVR calls from what served them before Install, SteamVR by default. Game thread only, while no other thread is using the interfaces */
+	void Uninstall();
+
+	/** Whether this runtime serves the OpenVR calls of the plugin */
+	bool IsInstalled() const { return bIsInstalled; }
+
+	/**
+	* Advance the simulation. Game thread only
+	* @param DeltaTime - Seconds since the last tick, ignored when the settings have a fixed delta time
+	*/
+	void Tick(float DeltaTime);
+
+	/** Retrieve the simulation settings */
+	const FSteamVRMockRuntimeSettings& GetSettings() const { return Settings; }
+
+	/**
+	* Set the state of a digital action, it is no longer animated. Read by the next UpdateActionState
+	* @param ActionPath - The action, e.g. /actions/main/in/fire
+	* @param bState - Whether the action is pressed
+	*/
+	void SetDigitalAction(const FString& ActionPath, bool bState);
+
+	/**
+	* Set the value of an analog action, it is no longer animated. Read by the next UpdateActionState
+	* @param ActionPath - The action, e.g. /actions/main/in/move
+	* @param Value - The value of each axis of the action
+	*/
+	void SetAnalogAction(const FString& ActionPath, const FVector& Value);
+
+	/**
+	* Have a pose or skeletal action follow a device, rather than the one its path names
+	* @param ActionPath - The action, e.g. /actions/main/in/tracker_waist
+	* @param DeviceIndex - The tracked device, k_unTrackedDeviceIndexInvalid for none
+	*/
+	void BindActionToDevice(const FString& ActionPath, TrackedDeviceIndex_t DeviceIndex);
+
+	/**
+	* Move a device, it is no longer animated
+	* @param DeviceIndex - The tracked device
+	* @param Position - Where the device is, in meters in OpenVR's tracking space
+	* @param Orientation - Its orientation in OpenVR's tracking space
+	*/
+	void SetDevicePose(TrackedDeviceIndex_t DeviceIndex, const FVector& Position, const FQuat& Orientation);
+
+	/** Connect or disconnect a device */
+	void SetDeviceConnected(TrackedDeviceIndex_t DeviceIndex, bool bIsConnected);
+
+	/**
+	* Curl the fingers of a hand, they are no longer animated
+	* @param HandIndex - 0 for the left hand, 1 for the right
+	* @param Curls - How much each finger is curled, thumb first, from 0 (straight) to 1 (fist)
+	*/
+	void SetFingerCurls(int32 HandIndex, const float (&Curls)[VRFinger_Count]);
+
+	/** Retrieve how many devices are simulated */
+	int32 GetDeviceCount() const;
+
+	/** Retrieve a copy of a simulated device, false if there is no such device */
+	bool GetDevice(TrackedDeviceIndex_t DeviceIndex, FSteamVRMockDevice& OutDevice) const;
+
+	/** Retrieve how many actions were created */
+	int32 GetActionCount() const;
+
+	/** Retrieve how many times action states were updated */
+	uint64 GetUpdateActionStateCount() const;
+
+	/** Retrieve how many haptic vibrations were triggered */
+	uint64 GetHapticVibrationCount() const;
+
+	IVRSystem* GetSystem() { return System.Get(); }
+	IVRInput* GetInput() { return Input.Get(); }
+	IVRCompositor* GetCompositor() { return Compositor.Get(); }
+	IVRApplications* GetApplications() { return &Applications; }
+
+private:
+	friend class FSteamVRMockSystem;
+	friend class FSteamVRMockCompositor;
+	friend class FSteamVRMockInput;
+
+	/** Add a device to the simulation */
+	void AddDevice(ETrackedDeviceClass DeviceClass, ETrackedControllerRole ControllerRole, const TCHAR* ModelNumber, const FString& SerialNumber, const FString& InputSourcePath);
+
+	/** Move the animated devices, curl the animated hands and change the animated actions to where they are at the simulation time. Requires MockLock */
+	void Animate();
+
+	/** Retrieve an action, creating it the first time its path is seen. Requires MockLock */
+	FSteamVRMockAction& FindOrAddAction(const FString& ActionPath);
+
+	/** Retrieve the action a handle was returned for, null if none. Requires MockLock */
+	FSteamVRMockAction* FindAction(VRActionHandle_t ActionHandle);
+
+	/** Retrieve a device, null if there is no such device. Requires MockLock */
+	const FSteamVRMockDevice* FindDevice(TrackedDeviceIndex_t DeviceIndex) const;
+
+	/** Retrieve the input source handle of a device, creating it on first use. Requires MockLock */
+	VRInputValueHandle_t GetDeviceInputSource(TrackedDeviceIndex_t DeviceIndex);
+
+	/** Retrieve the hand a device is, INDEX_NONE if it is not a controller. Requires MockLock */
+	int32 GetDeviceHandIndex(TrackedDeviceIndex_t DeviceIndex) const;
+
+	/**
+	* Build the bones of a simulated hand
+	* @param HandIndex - 0 for the left hand, 1 for the right
+	* @param Curls - How much each finger is curled, thumb first
+	* @param TransformSpace - Whether bones are relative to their parent or to the root
+	* @param OutBoneTransforms - Receives STEAMVR_SKELETON_BONE_COUNT bones
+	*/
+	static void BuildHandBones(int32 HandIndex, const float (&Curls)[VRFinger_Count], EVRSkeletalTransformSpace TransformSpace, VRBoneTransform_t* OutBoneTransforms);
+
+	/** What is simulated */
+	FSteamVRMockRuntimeSettings Settings;
+
+	TUniquePtr<FSteamVRMockSystem> System;
+	TUniquePtr<FSteamVRMockCompositor> Compositor;
+	TUniquePtr<FSteamVRMockInput> Input;
+	FSteamVRNullApplications Applications;
+
+	/** Whether this runtime serves the OpenVR calls of the plugin */
+	bool bIsInstalled = false;
+
+	/** The overrides this runtime replaced when installed, null for SteamVR's interfaces */
+	IVRSystem* PreviousSystem = nullptr;
+	IVRInput* PreviousInput = nullptr;
+	IVRCompositor* PreviousCompositor = nullptr;
+	IVRApplications* PreviousApplications = nullptr;
+
+	/** The simulated devices, indexed by tracked device index */
+	TArray<FSteamVRMockDevice> Devices;
+
+	/** The actions created so far, the handle of each is its index plus one */
+	TArray<FSteamVRMockAction> Actions;
+
+	/** Index of each action by path */
+	TMap<FString, int32> ActionIndices;
+
+	/** Handles of the action sets requested so far, by path */
+	TMap<FString, VRActionSetHandle_t> ActionSetHandles;
+
+	/** Handles of the input sources requested so far, by path */
+	TMap<FString, VRInputValueHandle_t> InputSourceHandles;
+
+	/** The device of each input source handle that belongs to one */
+	TMap<VRInputValueHandle_t, TrackedDeviceIndex_t> InputSourceDevices;
+
+	/** The next generic tracker a tracker action follows */
+	int32 NextTrackerBinding = 0;
+
+	/** How much each finger of each hand is curled */
+	float FingerCurls[2][VRFinger_Count];
+
+	/** Whether the simulation curls the fingers of each hand */
+	bool bIsHandAnimated[2] = { true, true };
+
+	/** Seconds ticked so far */
+	double SimulationTime = 0.0;
+
+	uint64 UpdateActionStateCount = 0;
+	uint64 HapticVibrationCount = 0;
+
+	/** The interfaces are used from the game, render and polling threads */
+	mutable FCriticalSection MockLock;
+};
@@ -0,0 +1,200 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamVRInputTypes.h"
+
+/**
+* An IVRSystem with no devices connected, for serving OpenVR calls when SteamVR is not running.
+* Every query fails the way it would for a disconnected device, and every output is cleared
+*/
+class STEAMVRINPUTDEVICE_API FSteamVRNullSystem : public IVRSystem
+{
+public:
+	virtual ~FSteamVRNullSystem() {}
+
+	// IVRSystem interface
+	virtual void GetRecommendedRenderTargetSize(uint32_t* pnWidth, uint32_t* pnHeight) override;
+	virtual HmdMatrix44_t GetProjectionMatrix(EVREye eEye, float fNearZ, float fFarZ) override;
+	virtual void GetProjectionRaw(EVREye eEye, float* pfLeft, float* pfRight, float* pfTop, float* pfBottom) override;
+	virtual bool ComputeDistortion(EVREye eEye, float fU, float fV, DistortionCoordinates_t* pDistortionCoordinates) override;
+	virtual HmdMatrix34_t GetEyeToHeadTransform(EVREye eEye) override;
+	virtual bool GetTimeSinceLastVsync(float* pfSecondsSinceLastVsync, uint64_t* pulFrameCounter) override;
+	virtual int32_t GetD3D9AdapterIndex() override;
+	virtual void GetDXGIOutputInfo(int32_t* pnAdapterIndex) override;
+	virtual void GetOutputDevice(uint64_t* pnDevice, ETextureType textureType, VkInstance_T* pInstance) override;
+	virtual bool IsDisplayOnDesktop() override;
+	virtual bool SetDisplayVisibility(bool bIsVisibleOnDesktop) override;
+	virtual void GetDeviceToAbsoluteTrackingPose(ETrackingUniverseOrigin eOrigin, float fPredictedSecondsToPhotonsFromNow, TrackedDevicePose_t* pTrackedDevicePoseArray, uint32_t unTrackedDevicePoseArrayCount) override;
+	virtual void ResetSeatedZeroPose() override;
+	virtual HmdMatrix34_t GetSeatedZeroPoseToStandingAbsoluteTrackingPose() override;
+	virtual HmdMatrix34_t GetRawZeroPoseToStandingAbsoluteTrackingPose() override;
+	virtual uint32_t GetSortedTrackedDeviceIndicesOfClass(ETrackedDeviceClass eTrackedDeviceClass, TrackedDeviceIndex_t* punTrackedDeviceIndexArray, uint32_t unTrackedDeviceIndexArrayCount, TrackedDeviceIndex_t unRelativeToTrackedDeviceIndex) override;
+	virtual EDeviceActivityLevel GetTrackedDeviceActivityLevel(TrackedDeviceIndex_t unDeviceId) override;
+	virtual void ApplyTransform(TrackedDevicePose_t* pOutputPose, const TrackedDevicePose_t* pTrackedDevicePose, const HmdMatrix34_t* pTransform) override;
+	virtual TrackedDeviceIndex_t GetTrackedDeviceIndexForControllerRole(ETrackedControllerRole unDeviceType) override;
+	virtual ETrackedControllerRole GetControllerRoleForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex) override;
+	virtual ETrackedDeviceClass GetTrackedDeviceClass(TrackedDeviceIndex_t unDeviceIndex) override;
+	virtual bool IsTrackedDeviceConnected(TrackedDeviceIndex_t unDeviceIndex) override;
+	virtual bool GetBoolTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual float GetFloatTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual int32_t GetInt32TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual uint64_t GetUint64TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual HmdMatrix34_t GetMatrix34TrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, ETrackedPropertyError* pError) override;
+	virtual uint32_t GetArrayTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, PropertyTypeTag_t propType, void* pBuffer, uint32_t unBufferSize, ETrackedPropertyError* pError) override;
+	virtual uint32_t GetStringTrackedDeviceProperty(TrackedDeviceIndex_t unDeviceIndex, ETrackedDeviceProperty prop, char* pchValue, uint32_t unBufferSize, ETrackedPropertyError* pError) override;
+	virtual const char* GetPropErrorNameFromEnum(ETrackedPropertyError error) override;
+	virtual bool PollNextEvent(VREvent_t* pEvent, uint32_t uncbVREvent) override;
+	virtual bool PollNextEventWithPose(ETrackingUniverseOrigin eOrigin, VREvent_t* pEvent, uint32_t uncbVREvent, TrackedDevicePose_t* pTrackedDevicePose) override;
+	virtual const char* GetEventTypeNameFromEnum(EVREventType eType) override;
+	virtual HiddenAreaMesh_t GetHiddenAreaMesh(EVREye eEye, EHiddenAreaMeshType type) override;
+	virtual bool GetControllerState(TrackedDeviceIndex_t unControllerDeviceIndex, VRControllerState_t* pControllerState, uint32_t unControllerStateSize) override;
+	virtual bool GetControllerStateWithPose(ETrackingUniverseOrigin eOrigin, TrackedDeviceIndex_t unControllerDeviceIndex, VRControllerState_t* pControllerState, uint32_t unControllerStateSize, TrackedDevicePose_t* pTrackedDevicePose) override;
+	virtual void TriggerHapticPulse(TrackedDeviceIndex_t unControllerDeviceIndex, uint32_t unAxisId, unsigned short usDurationMicroSec) override;
+	virtual const char* GetButtonIdNameFromEnum(EVRButtonId eButtonId) override;
+	virtual const char* GetControllerAxisTypeNameFromEnum(EVRControllerAxisType eAxisType) override;
+	virtual bool IsInputAvailable() override;
+	virtual bool IsSteamVRDrawingControllers() override;
+	virtual bool ShouldApplicationPause() override;
+	virtual bool ShouldApplicationReduceRenderingWork() override;
+	virtual EVRFirmwareError PerformFirmwareUpdate(TrackedDeviceIndex_t unDeviceIndex) override;
+	virtual void AcknowledgeQuit_Exiting() override;
+	virtual uint32_t GetAppContainerFilePaths(char* pchBuffer, uint32_t unBufferSize) override;
+	virtual const char* GetRuntimeVersion() override;
+};
+
+/**
+* An IVRCompositor that never presents a frame, for serving OpenVR calls when SteamVR is not running.
+* It only keeps the tracking space it is set to, so tracking space dependent code paths still run
+*/
+class STEAMVRINPUTDEVICE_API FSteamVRNullCompositor : public IVRCompositor
+{
+public:
+	/** @param InTrackingSpace - The tracking space reported until another one is set */
+	explicit FSteamVRNullCompositor(ETrackingUniverseOrigin InTrackingSpace = TrackingUniverseStanding)
+		: TrackingSpace(InTrackingSpace)
+	{}
+	virtual ~FSteamVRNullCompositor() {}
+
+	// IVRCompositor interface
+	virtual void SetTrackingSpace(ETrackingUniverseOrigin eOrigin) override;
+	virtual ETrackingUniverseOrigin GetTrackingSpace() override;
+	virtual EVRCompositorError WaitGetPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount) override;
+	virtual EVRCompositorError GetLastPoses(TrackedDevicePose_t* pRenderPoseArray, uint32_t unRenderPoseArrayCount, TrackedDevicePose_t* pGamePoseArray, uint32_t unGamePoseArrayCount) override;
+	virtual EVRCompositorError GetLastPoseForTrackedDeviceIndex(TrackedDeviceIndex_t unDeviceIndex, TrackedDevicePose_t* pOutputPose, TrackedDevicePose_t* pOutputGamePose) override;
+	virtual EVRCompositorError Submit(EVREye eEye, const Texture_t* pTexture, const VRTextureBounds_t* pBounds, EVRSubmitFlags nSubmitFlags) override;
+	virtual void ClearLastSubmittedFrame() override;
+	virtual void PostPresentHandoff() override;
+	virtual bool GetFrameTiming(Compositor_FrameTiming* pTiming, uint32_t unFramesAgo) override;
+	virtual uint32_t GetFrameTimings(Compositor_FrameTiming* pTiming, uint32_t nFrames) override;
+	virtual float GetFrameTimeRemaining() override;
+	virtual void GetCumulativeStats(Compositor_CumulativeStats* pStats, uint32_t nStatsSizeInBytes) override;
+	virtual void FadeToColor(float fSeconds, float fRed, float fGreen, float fBlue, float fAlpha, bool bBackground) override;
+	virtual HmdColor_t GetCurrentFadeColor(bool bBackground) override;
+	virtual void FadeGrid(float fSeconds, bool bFadeIn) override;
+	virtual float GetCurrentGridAlpha() override;
+	virtual EVRCompositorError SetSkyboxOverride(const Texture_t* pTextures, uint32_t unTextureCount) override;
+	virtual void ClearSkyboxOverride() override;
+	virtual void CompositorBringToFront() override;
+	virtual void CompositorGoToBack() override;
+	virtual void CompositorQuit() override;
+	virtual bool IsFullscreen() override;
+	virtual uint32_t GetCurrentSceneFocusProcess() override;
+	virtual uint32_t GetLastFrameRenderer() override;
+	virtual bool CanRenderScene() override;
+	virtual void ShowMirrorWindow() override;
+	virtual void HideMirrorWindow() override;
+	virtual bool IsMirrorWindowVisible() override;
+	virtual void CompositorDumpImages() override;
+	virtual bool ShouldAppRenderWithLowResources() override;
+	virtual void ForceInterleavedReprojectionOn(bool bOverride) override;
+	virtual void ForceReconnectProcess() override;
+	virtual void SuspendRendering(bool bSuspend) override;
+	virtual EVRCompositorError GetMirrorTextureD3D11(EVREye eEye, void* pD3D11DeviceOrResource, void* *ppD3D11ShaderResourceView) override;
+	virtual void ReleaseMirrorTextureD3D11(void* pD3D11ShaderResourceView) override;
+	virtual EVRCompositorError GetMirrorTextureGL(EVREye eEye, glUInt_t* pglTextureId, glSharedTextureHandle_t* pglSharedTextureHandle) override;
+	virtual bool ReleaseSharedGLTexture(glUInt_t glTextureId, glSharedTextureHandle_t glSharedTextureHandle) override;
+	virtual void LockGLSharedTextureForAccess(glSharedTextureHandle_t glSharedTextureHandle) override;
+	virtual void UnlockGLSharedTextureForAccess(glSharedTextureHandle_t glSharedTextureHandle) override;
+	virtual uint32_t GetVulkanInstanceExtensionsRequired(char* pchValue, uint32_t unBufferSize) override;
+	virtual uint32_t GetVulkanDeviceExtensionsRequired(VkPhysicalDevice_T* pPhysicalDevice, char* pchValue, uint32_t unBufferSize) override;
+	virtual void SetExplicitTimingMode(EVRCompositorTimingMode eTimingMode) override;
+	virtual EVRCompositorError SubmitExplicitTimingData() override;
+	virtual bool IsMotionSmoothingEnabled() override;
+	virtual bool IsMotionSmoothingSupported() override;
+	virtual bool IsCurrentSceneFocusAppLoading() override;
+
+private:
+	/** The tracking space poses are reported in */
+	ETrackingUniverseOrigin TrackingSpace;
+};
+
+/**
+* An IVRApplications without installed applications, for serving OpenVR calls when SteamVR is not running.
+* Manifests and applications are accepted and ignored, every other query fails
+*/
+class STEAMVRINPUTDEVICE_API FSteamVRNullApplications : public IVRApplications
+{
+public:
+	virtual ~FSteamVRNullApplications() {}
+
+	// IVRApplications interface
+	virtual EVRApplicationError AddApplicationManifest(const char* pchApplicationManifestFullPath, bool bTemporary) override;
+	virtual EVRApplicationError RemoveApplicationManifest(const char* pchApplicationManifestFullPath) override;
+	virtual bool IsApplicationInstalled(const char* pchAppKey) override;
+	virtual uint32_t GetApplicationCount() override;
+	virtual EVRApplicationError GetApplicationKeyByIndex(uint32_t unApplicationIndex, char* pchAppKeyBuffer, uint32_t unAppKeyBufferLen) override;
+	virtual EVRApplicationError GetApplicationKeyByProcessId(uint32_t unProcessId, char* pchAppKeyBuffer, uint32_t unAppKeyBufferLen) override;
+	virtual EVRApplicationError LaunchApplication(const char* pchAppKey) override;
+	virtual EVRApplicationError LaunchTemplateApplication(const char* pchTemplateAppKey, const char* pchNewAppKey, const AppOverrideKeys_t* pKeys, uint32_t unKeys) override;
+	virtual EVRApplicationError LaunchApplicationFromMimeType(const char* pchMimeType, const char* pchArgs) override;
+	virtual EVRApplicationError LaunchDashboardOverlay(const char* pchAppKey) override;
+	virtual bool CancelApplicationLaunch(const char* pchAppKey) override;
+	virtual EVRApplicationError IdentifyApplication(uint32_t unProcessId, const char* pchAppKey) override;
+	virtual uint32_t GetApplicationProcessId(const char* pchAppKey) override;
+	virtual const char* GetApplicationsErrorNameFromEnum(EVRApplicationError error) override;
+	virtual uint32_t GetApplicationPropertyString(const char* pchAppKey, EVRApplicationProperty eProperty, char* pchPropertyValueBuffer, uint32_t unPropertyValueBufferLen, EVRApplicationError* peError) override;
+	virtual bool GetApplicationPropertyBool(const char* pchAppKey, EVRApplicationProperty eProperty, EVRApplicationError* peError) override;
+	virtual uint64_t GetApplicationPropertyUint64(const char* pchAppKey, EVRApplicationProperty eProperty, EVRApplicationError* peError) override;
+	virtual EVRApplicationError SetApplicationAutoLaunch(const char* pchAppKey, bool bAutoLaunch) override;
+	virtual bool GetApplicationAutoLaunch(const char* pchAppKey) override;
+	virtual EVRApplicationError SetDefaultApplicationForMimeType(const char* pchAppKey, const char* pchMimeType) override;
+	virtual bool GetDefaultApplicationForMimeType(const char* pchMimeType, char* pchAppKeyBuffer, uint32_t unAppKeyBufferLen) override;
+	virtual bool GetApplicationSupportedMimeTypes(const char* pchAppKey, char* pchMimeTypesBuffer, uint32_t unMimeTypesBuffer) override;
+	virtual uint32_t GetApplicationsThatSupportMimeType(const char* pchMimeType, char* pchAppKeysThatSupportBuffer, uint32_t unAppKeysThatSupportBuffer) override;
+	virtual uint32_t GetApplicationLaunchArguments(uint32_t unHandle, char* pchArgs, uint32_t unArgs) override;
+	virtual EVRApplicationError GetStartingApplication(char* pchAppKeyBuffer, uint32_t unAppKeyBufferLen) override;
+	virtual EVRSceneApplicationState GetSceneApplicationState() override;
+	virtual EVRApplicationError PerformApplicationPrelaunchCheck(const char* pchAppKey) override;
+	virtual const char* GetSceneApplicationStateNameFromEnum(EVRSceneApplicationState state) override;
+	virtual EVRApplicationError LaunchInternalProcess(const char* pchBinaryPath, const char* pchArguments, const char* pchWorkingDirectory) override;
+	virtual uint32_t GetCurrentSceneProcessId() override;
+};
@@ -0,0 +1,98 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Containers/CircularQueue.h"
+#include "SteamVRInputTypes.h"
+
+class FRunnableThread;
+class FSteamVRInputDevice;
+
+/**
+* Polls SteamVR digital actions on a dedicated thread, independently of the game frame rate.
+* Transitions are queued with the time SteamVR saw them and drained in order on the game thread,
+* so presses and releases that happen between two frames are not lost
+*/
+class FSteamVRInputPoller : public FRunnable
+{
+public:
+	/**
+	* Start polling on a new thread
+	* @param InDevice - The input device that reads the digital actions from SteamVR
+	* @param InPollingRate - How many times per second digital actions are read
+	*/
+	FSteamVRInputPoller(FSteamVRInputDevice* InDevice, float InPollingRate);
+	virtual ~FSteamVRInputPoller();
+
+	// FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	/** Stop polling and wait for the polling thread to exit. Queued transitions can still be dequeued afterwards */
+	void Shutdown();
+
+	/** How many times per second digital actions are read */
+	float GetPollingRate() const { return PollingRate; }
+
+	/**
+	* Queue a digital action transition for the game thread. Polling thread only
+	* @return Whether the transition was queued, a transition that doesn't fit is counted as dropped and should be queued again by the next poll
+	*/
+	bool Enqueue(const FSteamVRDigitalActionEvent& Event);
+
+	/** Retrieve the oldest queued digital action transition. Game thread only */
+	bool Dequeue(FSteamVRDigitalActionEvent& OutEvent);
+
+	/** Retrieve how many transitions were dropped because the game thread did not drain the queue in time */
+	int32 GetDroppedEventCount() const { return DroppedEventCount.GetValue(); }
+
+private:
+	/** The input device that reads the digital actions from SteamVR */
+	FSteamVRInputDevice* Device;
+
+	/** How many times per second digital actions are read */
+	float PollingRate;
+
+	/** Set when the polling thread should exit */
+	FThreadSafeBool bStopping;
+
+	/** Single producer (polling thread), single consumer (game thread) queue of digital action transitions */
+	TCircularQueue<FSteamVRDigitalActionEvent> EventQueue;
+
+	/** Attempts to queue a transition that did not fit in the queue */
+	FThreadSafeCounter DroppedEventCount;
+
+	/** The polling thread */
+	FRunnableThread* Thread = nullptr;
+};
@@ -0,0 +1,283 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+#include "Misc/ScopeLock.h"
+#include "SteamVRInputTypes.h"
+#include "SteamVRInputNullRuntime.h"
+
+/** Identifies an OpenVR input call result: the call, and the arguments that select what it reads */
+struct FSteamVRInputRecordKey
+{
+	/** The call (EInputRecordCall) */
+	uint8 Call = 0;
+
+	/** The action, action set or origin read, or the hash of the path or buffer passed in */
+	uint64 Handle = 0;
+
+	/** The device the call is restricted to, or its second handle */
+	uint64 Extra = 0;
+
+	/** Small arguments of the call packed together, e.g. tracking space, transform space and motion range */
+	uint32 Variant = 0;
+
+	FSteamVRInputRecordKey() {}
+	FSteamVRInputRecordKey(EInputRecordCall InCall, uint64 InHandle, uint64 InExtra, uint32 InVariant)
+		: Call(InCall), Handle(InHandle), Extra(InExtra), Variant(InVariant)
+	{}
+
+	bool operator==(const FSteamVRInputRecordKey& Other) const
+	{
+		return Call == Other.Call && Handle == Other.Handle && Extra == Other.Extra && Variant == Other.Variant;
+	}
+
+	friend uint32 GetTypeHash(const FSteamVRInputRecordKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.Handle), GetTypeHash(Key.Extra)), (Key.Variant << 8) | Key.Call);
+	}
+};
+
+/** The result of an OpenVR input call: the error it returned and the bytes it wrote to its outputs */
+struct FSteamVRInputRecord
+{
+	FSteamVRInputRecordKey Key;
+
+	/** The EVRInputError returned */
+	int32 Error = 0;
+
+	/** The outputs written, exactly as OpenVR wrote them */
+	TArray<uint8> Payload;
+
+	friend FArchive& operator<<(FArchive& Ar, FSteamVRInputRecord& Record)
+	{
+		Ar << Record.Key.Call << Record.Key.Handle << Record.Key.Extra << Record.Key.Variant << Record.Error << Record.Payload;
+		return Ar;
+	}
+};
+
+/**
+* A stream of recorded OpenVR input. Each frame only holds the call results that changed since the frame before,
+* so static data like handles and bone hierarchies is stored once and idle controllers cost next to nothing
+*/
+struct STEAMVRINPUTDEVICE_API FSteamVRInputRecording
+{
+	/** Changed call results of each frame. Frame 0 holds what was read before the first frame, e.g. handles */
+	TArray<TArray<FSteamVRInputRecord>> Frames;
+
+	/** Write the recording to a binary file */
+	bool SaveToFile(const FString& FilePath) const;
+
+	/** Read a recording from a binary file written by SaveToFile */
+	bool LoadFromFile(const FString& FilePath);
+};
+
+/**
+* An IVRInput that forwards every call to another one (SteamVR by default) and records what it reads, frame by frame.
+* Calls that only have side effects (e.g. haptics, binding UI) are forwarded but not recorded.
+* What the game thread reads is what a frame records: reads of the same call from other threads (e.g. the render or polling thread)
+* only fill in calls the game thread did not make that frame, the latest of them kept
+*/
+class STEAMVRINPUTDEVICE_API FSteamVRInputRecorder : public IVRInput
+{
+public:
+	/** @param InSourceInput - The input to forward calls to and record, SteamVR's if null */
+	explicit FSteamVRInputRecorder(IVRInput* InSourceInput = nullptr);
+	virtual ~FSteamVRInputRecorder() {}
+
+	/** Retrieve the input calls are forwarded to, null for SteamVR's */
+	IVRInput* GetSourceInput() const { return SourceInput; }
+
+	/** Close the frame being recorded and start the next one. Call at the start of every frame, game thread only */
+	void BeginFrame();
+
+	/** Retrieve how many frames were recorded, including the frame being recorded */
+	int32 GetFrameCount() const;
+
+	/** Close the frame being recorded and write the recording to a binary file. Stop recording before calling this */
+	bool SaveToFile(const FString& FilePath);
+
+	// IVRInput interface
+	virtual EVRInputError SetActionManifestPath(const char* pchActionManifestPath) override;
+	virtual EVRInputError GetActionSetHandle(const char* pchActionSetName, VRActionSetHandle_t* pHandle) override;
+	virtual EVRInputError GetActionHandle(const char* pchActionName, VRActionHandle_t* pHandle) override;
+	virtual EVRInputError GetInputSourceHandle(const char* pchInputSourcePath, VRInputValueHandle_t* pHandle) override;
+	virtual EVRInputError UpdateActionState(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount) override;
+	virtual EVRInputError GetDigitalActionData(VRActionHandle_t action, InputDigitalActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetAnalogActionData(VRActionHandle_t action, InputAnalogActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetPoseActionDataRelativeToNow(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, float fPredictedSecondsFromNow, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetPoseActionDataForNextFrame(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetSkeletalActionData(VRActionHandle_t action, InputSkeletalActionData_t* pActionData, uint32_t unActionDataSize) override;
+	virtual EVRInputError GetBoneCount(VRActionHandle_t action, uint32_t* pBoneCount) override;
+	virtual EVRInputError GetBoneHierarchy(VRActionHandle_t action, BoneIndex_t* pParentIndices, uint32_t unIndexArayCount) override;
+	virtual EVRInputError GetBoneName(VRActionHandle_t action, BoneIndex_t nBoneIndex, char* pchBoneName, uint32_t unNameBufferSize) override;
+	virtual EVRInputError GetSkeletalReferenceTransforms(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalReferencePose eReferencePose, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError GetSkeletalTrackingLevel(VRActionHandle_t action, EVRSkeletalTrackingLevel* pSkeletalTrackingLevel) override;
+	virtual EVRInputError GetSkeletalBoneData(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalMotionRange eMotionRange, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError GetSkeletalSummaryData(VRActionHandle_t action, EVRSummaryType eSummaryType, VRSkeletalSummaryData_t* pSkeletalSummaryData) override;
+	virtual EVRInputError GetSkeletalBoneDataCompressed(VRActionHandle_t action, EVRSkeletalMotionRange eMotionRange, void* pvCompressedData, uint32_t unCompressedSize, uint32_t* punRequiredCompressedSize) override;
+	virtual EVRInputError DecompressSkeletalBoneData(const void* pvCompressedBuffer, uint32_t unCompressedBufferSize, EVRSkeletalTransformSpace eTransformSpace, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError TriggerHapticVibrationAction(VRActionHandle_t action, float fStartSecondsFromNow, float fDurationSeconds, float fFrequency, float fAmplitude, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t digitalActionHandle, VRInputValueHandle_t* originsOut, uint32_t originOutCount) override;
+	virtual EVRInputError GetOriginLocalizedName(VRInputValueHandle_t origin, char* pchNameArray, uint32_t unNameArraySize, int32_t unStringSectionsToInclude) override;
+	virtual EVRInputError GetOriginTrackedDeviceInfo(VRInputValueHandle_t origin, InputOriginInfo_t* pOriginInfo, uint32_t unOriginInfoSize) override;
+	virtual EVRInputError GetActionBindingInfo(VRActionHandle_t action, InputBindingInfo_t* pOriginInfo, uint32_t unBindingInfoSize, uint32_t unBindingInfoCount, uint32_t* punReturnedBindingInfoCount) override;
+	virtual EVRInputError ShowActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t ulActionHandle) override;
+	virtual EVRInputError ShowBindingsForActionSet(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount, VRInputValueHandle_t originToHighlight) override;
+	virtual bool IsUsingLegacyInput() override;
+	virtual EVRInputError OpenBindingUI(const char* pchAppKey, VRActionSetHandle_t ulActionSetHandle, VRInputValueHandle_t ulDeviceHandle, bool bShowOnDesktop) override;
+
+private:
+	/** Retrieve the input calls are forwarded to, null if SteamVR is not running */
+	IVRInput* GetForwardedInput() const { return SourceInput != nullptr ? SourceInput : vr::VRInput(); }
+
+	/** Keep the tracking space the poses of the frame being recorded are read in */
+	void RecordTrackingSpace();
+
+	/** Keep the result of a call in the frame being recorded, unless the game thread already recorded the same call this frame */
+	void Record(EInputRecordCall Call, uint64 Handle, uint64 Extra, uint32 Variant, EVRInputError Error, const void* Data, uint32 DataSize);
+
+	/** Add the results of the frame being recorded that changed since the last frame to the recording. Requires RecordLock */
+	void CommitFrame();
+
+	/** The input calls are forwarded to, SteamVR's if null */
+	IVRInput* SourceInput;
+
+	/** The frames recorded so far */
+	FSteamVRInputRecording Recording;
+
+	/** The latest result of every call, as of the last committed frame */
+	TMap<FSteamVRInputRecordKey, FSteamVRInputRecord> CommittedRecords;
+
+	/** The results of the frame being recorded */
+	TMap<FSteamVRInputRecordKey, FSteamVRInputRecord> FrameRecords;
+
+	/** The calls of the frame being recorded whose result was read by the game thread */
+	TSet<FSteamVRInputRecordKey> GameThreadFrameKeys;
+
+	/** Recording happens on the game, render and polling threads */
+	mutable FCriticalSection RecordLock;
+};
+
+/**
+* An IVRInput that serves a recording made by FSteamVRInputRecorder, frame by frame, without SteamVR.
+* Every call returns what was recorded for the same arguments as of the current frame, or VRInputError_NoData if the call was never recorded.
+* It comes with a system that has no devices and a compositor that reports the recorded tracking space, so a replay
+* gives byte-identical input whether or not SteamVR and a headset are present
+*/
+class STEAMVRINPUTDEVICE_API FSteamVRInputReplay : public IVRInput
+{
+public:
+	FSteamVRInputReplay() {}
+	virtual ~FSteamVRInputReplay() {}
+
+	/** Load a recording and serve its first frame. Game thread only */
+	bool LoadFromFile(const FString& FilePath);
+
+	/**
+	* Serve the next recorded frame. Call at the start of every frame, game thread only
+	* @return Whether or not there was a frame left, the last frame keeps being served once the recording ends
+	*/
+	bool BeginFrame();
+
+	/** Retrieve the index of the frame being served */
+	int32 GetFrameIndex() const { return FrameIndex; }
+
+	/** Retrieve how many frames were recorded */
+	int32 GetFrameCount() const { return Recording.Frames.Num(); }
+
+	/** Retrieve the system to serve alongside the replay */
+	IVRSystem* GetSystem() { return &NullSystem; }
+
+	/** Retrieve the compositor to serve alongside the replay */
+	IVRCompositor* GetCompositor() { return &NullCompositor; }
+
+	// IVRInput interface
+	virtual EVRInputError SetActionManifestPath(const char* pchActionManifestPath) override;
+	virtual EVRInputError GetActionSetHandle(const char* pchActionSetName, VRActionSetHandle_t* pHandle) override;
+	virtual EVRInputError GetActionHandle(const char* pchActionName, VRActionHandle_t* pHandle) override;
+	virtual EVRInputError GetInputSourceHandle(const char* pchInputSourcePath, VRInputValueHandle_t* pHandle) override;
+	virtual EVRInputError UpdateActionState(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount) override;
+	virtual EVRInputError GetDigitalActionData(VRActionHandle_t action, InputDigitalActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetAnalogActionData(VRActionHandle_t action, InputAnalogActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetPoseActionDataRelativeToNow(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, float fPredictedSecondsFromNow, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetPoseActionDataForNextFrame(VRActionHandle_t action, ETrackingUniverseOrigin eOrigin, InputPoseActionData_t* pActionData, uint32_t unActionDataSize, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetSkeletalActionData(VRActionHandle_t action, InputSkeletalActionData_t* pActionData, uint32_t unActionDataSize) override;
+	virtual EVRInputError GetBoneCount(VRActionHandle_t action, uint32_t* pBoneCount) override;
+	virtual EVRInputError GetBoneHierarchy(VRActionHandle_t action, BoneIndex_t* pParentIndices, uint32_t unIndexArayCount) override;
+	virtual EVRInputError GetBoneName(VRActionHandle_t action, BoneIndex_t nBoneIndex, char* pchBoneName, uint32_t unNameBufferSize) override;
+	virtual EVRInputError GetSkeletalReferenceTransforms(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalReferencePose eReferencePose, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError GetSkeletalTrackingLevel(VRActionHandle_t action, EVRSkeletalTrackingLevel* pSkeletalTrackingLevel) override;
+	virtual EVRInputError GetSkeletalBoneData(VRActionHandle_t action, EVRSkeletalTransformSpace eTransformSpace, EVRSkeletalMotionRange eMotionRange, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError GetSkeletalSummaryData(VRActionHandle_t action, EVRSummaryType eSummaryType, VRSkeletalSummaryData_t* pSkeletalSummaryData) override;
+	virtual EVRInputError GetSkeletalBoneDataCompressed(VRActionHandle_t action, EVRSkeletalMotionRange eMotionRange, void* pvCompressedData, uint32_t unCompressedSize, uint32_t* punRequiredCompressedSize) override;
+	virtual EVRInputError DecompressSkeletalBoneData(const void* pvCompressedBuffer, uint32_t unCompressedBufferSize, EVRSkeletalTransformSpace eTransformSpace, VRBoneTransform_t* pTransformArray, uint32_t unTransformArrayCount) override;
+	virtual EVRInputError TriggerHapticVibrationAction(VRActionHandle_t action, float fStartSecondsFromNow, float fDurationSeconds, float fFrequency, float fAmplitude, VRInputValueHandle_t ulRestrictToDevice) override;
+	virtual EVRInputError GetActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t digitalActionHandle, VRInputValueHandle_t* originsOut, uint32_t originOutCount) override;
+	virtual EVRInputError GetOriginLocalizedName(VRInputValueHandle_t origin, char* pchNameArray, uint32_t unNameArraySize, int32_t unStringSectionsToInclude) override;
+	virtual EVRInputError GetOriginTrackedDeviceInfo(VRInputValueHandle_t origin, InputOriginInfo_t* pOriginInfo, uint32_t unOriginInfoSize) override;
+	virtual EVRInputError GetActionBindingInfo(VRActionHandle_t action, InputBindingInfo_t* pOriginInfo, uint32_t unBindingInfoSize, uint32_t unBindingInfoCount, uint32_t* punReturnedBindingInfoCount) override;
+	virtual EVRInputError ShowActionOrigins(VRActionSetHandle_t actionSetHandle, VRActionHandle_t ulActionHandle) override;
+	virtual EVRInputError ShowBindingsForActionSet(VRActiveActionSet_t* pSets, uint32_t unSizeOfVRSelectedActionSet_t, uint32_t unSetCount, VRInputValueHandle_t originToHighlight) override;
+	virtual bool IsUsingLegacyInput() override;
+	virtual EVRInputError OpenBindingUI(const char* pchAppKey, VRActionSetHandle_t ulActionSetHandle, VRInputValueHandle_t ulDeviceHandle, bool bShowOnDesktop) override;
+
+private:
+	/**
+	* Copy the recorded result of a call to its outputs, clearing whatever the recording does not cover
+	* @param OutData - Where the call writes its outputs
+	* @param OutDataSize - The size of the outputs
+	* @param OutServedSize - Receives how many bytes were copied
+	* @return The recorded error, VRInputError_NoData if the call was never recorded
+	*/
+	EVRInputError Serve(EInputRecordCall Call, uint64 Handle, uint64 Extra, uint32 Variant, void* OutData, uint32 OutDataSize, uint32* OutServedSize = nullptr) const;
+
+	/** Make the results of a recorded frame the ones served. Requires ReplayLock */
+	void ApplyFrame(int32 InFrameIndex);
+
+	/** The recording served, unchanged once loaded */
+	FSteamVRInputRecording Recording;
+
+	/** The latest result of every call as of the frame being served, pointing into Recording */
+	TMap<FSteamVRInputRecordKey, const FSteamVRInputRecord*> ServedRecords;
+
+	/** The frame being served */
+	int32 FrameIndex = INDEX_NONE;
+
+	/** A system without devices to serve alongside the replay */
+	FSteamVRNullSystem NullSystem;
+
+	/** A compositor reporting the recorded tracking space */
+	FSteamVRNullCompositor NullCompositor;
+
+	/** Calls are served on the game, render and polling threads */
+	mutable FCriticalSection ReplayLock;
+};
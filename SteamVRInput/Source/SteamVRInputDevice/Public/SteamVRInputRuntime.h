@@ -0,0 +1,102 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamVRInputTypes.h"
+
+/**
+* The OpenVR interfaces used by the plugin. By default these are SteamVR's, but each one can be overridden
+* by another implementation (e.g. an input recorder or replay) without changing the code paths that use them.
+* While calls are counted, the interfaces returned count each call before passing it on to the resolved interface
+*/
+class STEAMVRINPUTDEVICE_API FSteamVRInputRuntime
+{
+public:
+	static FORCEINLINE IVRSystem* VRSystem() { IVRSystem* System = ResolveSystem(); return (System != nullptr && CountingSystem != nullptr) ? CountingSystem : System; }
+	static FORCEINLINE IVRInput* VRInput() { IVRInput* Input = ResolveInput(); return (Input != nullptr && CountingInput != nullptr) ? CountingInput : Input; }
+	static FORCEINLINE IVRCompositor* VRCompositor() { IVRCompositor* Compositor = ResolveCompositor(); return (Compositor != nullptr && CountingCompositor != nullptr) ? CountingCompositor : Compositor; }
+	static FORCEINLINE IVRApplications* VRApplications() { return OverrideApplications != nullptr ? OverrideApplications : vr::VRApplications(); }
+
+	/** The interfaces calls are served by, without counting them */
+	static FORCEINLINE IVRSystem* ResolveSystem() { return OverrideSystem != nullptr ? OverrideSystem : vr::VRSystem(); }
+	static FORCEINLINE IVRInput* ResolveInput() { return OverrideInput != nullptr ? OverrideInput : vr::VRInput(); }
+	static FORCEINLINE IVRCompositor* ResolveCompositor() { return OverrideCompositor != nullptr ? OverrideCompositor : vr::VRCompositor(); }
+
+	/**
+	* Serve OpenVR calls from other implementations. Game thread only, while no other thread is using the interfaces
+	* @param InSystem - Replaces IVRSystem, null to use SteamVR's
+	* @param InInput - Replaces IVRInput, null to use SteamVR's
+	* @param InCompositor - Replaces IVRCompositor, null to use SteamVR's
+	* @param InApplications - Replaces IVRApplications, null to use SteamVR's
+	*/
+	static void SetOverride(IVRSystem* InSystem, IVRInput* InInput, IVRCompositor* InCompositor = nullptr, IVRApplications* InApplications = nullptr);
+
+	/** Retrieve what replaces IVRSystem, null if SteamVR's is used */
+	static IVRSystem* GetSystemOverride() { return OverrideSystem; }
+
+	/** Retrieve what replaces IVRInput, null if SteamVR's is used */
+	static IVRInput* GetInputOverride() { return OverrideInput; }
+
+	/** Retrieve what replaces IVRCompositor, null if SteamVR's is used */
+	static IVRCompositor* GetCompositorOverride() { return OverrideCompositor; }
+
+	/** Retrieve what replaces IVRApplications, null if SteamVR's is used */
+	static IVRApplications* GetApplicationsOverride() { return OverrideApplications; }
+
+	/**
+	* Serve IVRInput calls from another implementation, leaving the other interfaces as they are. Game thread only, while no other thread is using the interfaces
+	* @param InInput - Replaces IVRInput, null to use SteamVR's
+	*/
+	static void SetInputOverride(IVRInput* InInput) { OverrideInput = InInput; }
+
+	/** Go back to serving OpenVR calls from SteamVR */
+	static void ClearOverride();
+
+	/** Whether any OpenVR interface is currently overridden */
+	static bool IsOverridden();
+
+	/**
+	* Count calls through other implementations that pass them on to the resolved interfaces, or stop counting with nulls. Game thread only
+	* @param InSystem - Counts IVRSystem calls
+	* @param InInput - Counts IVRInput calls
+	* @param InCompositor - Counts IVRCompositor calls
+	*/
+	static void SetCountingInterfaces(IVRSystem* InSystem, IVRInput* InInput, IVRCompositor* InCompositor);
+
+private:
+	static IVRSystem* OverrideSystem;
+	static IVRInput* OverrideInput;
+	static IVRCompositor* OverrideCompositor;
+	static IVRApplications* OverrideApplications;
+	static IVRSystem* CountingSystem;
+	static IVRInput* CountingInput;
+	static IVRCompositor* CountingCompositor;
+};
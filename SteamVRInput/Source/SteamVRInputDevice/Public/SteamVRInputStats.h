@@ -0,0 +1,107 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "SteamVRInputTypes.h"
+
+DECLARE_STATS_GROUP(TEXT("SteamVRInput"), STATGROUP_SteamVRInput, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SendControllerEvents"), STAT_SteamVRInput_SendControllerEvents, STATGROUP_SteamVRInput, STEAMVRINPUTDEVICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ProcessActionEvents"), STAT_SteamVRInput_ProcessActionEvents, STATGROUP_SteamVRInput, STEAMVRINPUTDEVICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pose Query"), STAT_SteamVRInput_PoseQuery, STATGROUP_SteamVRInput, STEAMVRINPUTDEVICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skeletal Data"), STAT_SteamVRInput_SkeletalData, STATGROUP_SteamVRInput, STEAMVRINPUTDEVICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Action Manifest"), STAT_SteamVRInput_ActionManifest, STATGROUP_SteamVRInput, STEAMVRINPUTDEVICE_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("IVRSystem Calls"), STAT_SteamVRInput_SystemCalls, STATGROUP_SteamVRInput, STEAMVRINPUTDEVICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("IVRInput Calls"), STAT_SteamVRInput_InputCalls, STATGROUP_SteamVRInput, STEAMVRINPUTDEVICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("IVRCompositor Calls"), STAT_SteamVRInput_CompositorCalls, STATGROUP_SteamVRInput, STEAMVRINPUTDEVICE_API);
+
+CSV_DECLARE_CATEGORY_EXTERN(SteamVRInput);
+
+/**
+* Counts the plugin's calls into SteamVR, each of which is a round trip to the SteamVR process, per frame and method.
+* Each frame's totals go to the SteamVRInput stats group and CSV category, and each method's count to the CSV category
+*/
+class STEAMVRINPUTDEVICE_API FSteamVRInputCallCounter
+{
+public:
+	/** Count a call to a method of an interface. Any thread */
+	static FORCEINLINE void Count(ESteamVRInterface Interface, int32 MethodIndex)
+	{
+		CallCounts[Interface][MethodIndex].Increment();
+	}
+
+	/** Start or stop counting calls. Game thread only */
+	static void SetEnabled(bool bIsEnabled);
+
+	/** Whether calls are being counted */
+	static bool IsEnabled() { return bIsCounting; }
+
+	/** Close the frame: keep its counts, add them to stats and the CSV profile, and start counting the next one. Game thread only, once per frame */
+	static void EndFrame();
+
+	/** Retrieve the name of an interface, e.g. IVRInput */
+	static const TCHAR* GetInterfaceName(ESteamVRInterface Interface);
+
+	/** Retrieve how many methods an interface has */
+	static int32 GetMethodCount(ESteamVRInterface Interface);
+
+	/** Retrieve the name of a method of an interface, e.g. GetDigitalActionData */
+	static const TCHAR* GetMethodName(ESteamVRInterface Interface, int32 MethodIndex);
+
+	/** Retrieve how many calls were made to a method of an interface in the last frame */
+	static int32 GetFrameCallCount(ESteamVRInterface Interface, int32 MethodIndex) { return FrameCallCounts[Interface][MethodIndex]; }
+
+	/** Retrieve how many calls were made to an interface in the last frame */
+	static int32 GetFrameCallCount(ESteamVRInterface Interface);
+
+	/** Retrieve how many calls were made to a method of an interface since counting started */
+	static uint64 GetTotalCallCount(ESteamVRInterface Interface, int32 MethodIndex) { return TotalCallCounts[Interface][MethodIndex]; }
+
+	/** Forget every count */
+	static void Reset();
+
+private:
+	/** Whether calls are being counted */
+	static bool bIsCounting;
+
+	/** Calls made since the last EndFrame */
+	static FThreadSafeCounter CallCounts[VRInterface_Count][CALL_COUNTER_MAX_METHODS];
+
+	/** Calls made in the last frame */
+	static int32 FrameCallCounts[VRInterface_Count][CALL_COUNTER_MAX_METHODS];
+
+	/** Calls made since counting started */
+	static uint64 TotalCallCounts[VRInterface_Count][CALL_COUNTER_MAX_METHODS];
+};
@@ -0,0 +1,107 @@
+/*
+Copyright 2019 Valve Corporation under https://opensource.org/licenses/BSD-3-Clause
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+   may be used to endorse or promote products derived from this software
+   without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "SteamVRInputTypes.h"
+
+/** Whether the engine has trace channels for Unreal Insights (4.25 and up), input events go to CSV profiles as events otherwise */
+#define STEAMVR_INPUT_TRACE_CHANNEL (ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION >= 25)
+
+#if STEAMVR_INPUT_TRACE_CHANNEL
+#include "Trace/Trace.h"
+UE_TRACE_CHANNEL_EXTERN(SteamVRInputChannel, STEAMVRINPUTDEVICE_API)
+#else
+#include "HAL/IConsoleManager.h"
+#endif
+
+/**
+* Traces input as it arrives from SteamVR: digital transitions, analog changes, pose samples and haptic calls, so input
+* arrival can be lined up with game and render thread frames. Events go to SteamVRInputChannel in Unreal Insights,
+* or on engines without trace channels to the SteamVRInput CSV category while steamvr.input.trace is set.
+* Callers check IsEnabled before gathering anything to trace, so tracing costs a branch while it is off
+*/
+class STEAMVRINPUTDEVICE_API FSteamVRInputTrace
+{
+public:
+	/** Whether input events are being traced */
+	static FORCEINLINE bool IsEnabled()
+	{
+#if STEAMVR_INPUT_TRACE_CHANNEL
+		return UE_TRACE_CHANNELEXPR_IS_ENABLED(SteamVRInputChannel);
+#else
+		return bIsEnabled;
+#endif
+	}
+
+	/**
+	* Trace a digital action transition
+	* @param ActionHandle - The action that changed
+	* @param ActionName - Its name
+	* @param bState - Whether it is now pressed
+	* @param UpdateTime - When SteamVR saw the transition, in seconds relative to now
+	*/
+	static void TraceDigitalAction(VRActionHandle_t ActionHandle, const FName& ActionName, bool bState, float UpdateTime);
+
+	/**
+	* Trace an analog action change
+	* @param ActionHandle - The action that changed
+	* @param ActionName - Its name
+	* @param Value - Its new value on each axis
+	* @param UpdateTime - When SteamVR saw the change, in seconds relative to now
+	*/
+	static void TraceAnalogAction(VRActionHandle_t ActionHandle, const FName& ActionName, const FVector& Value, float UpdateTime);
+
+	/**
+	* Trace a pose read from SteamVR
+	* @param ActionHandle - The pose action
+	* @param PoseData - The pose SteamVR returned
+	* @param PredictedSecondsFromNow - How far ahead the pose was predicted, or -9999 or less for the next frame's pose
+	*/
+	static void TracePose(VRActionHandle_t ActionHandle, const InputPoseActionData_t& PoseData, float PredictedSecondsFromNow);
+
+	/**
+	* Trace a haptic vibration sent to SteamVR
+	* @param HandIndex - 0 for the left hand, 1 for the right
+	* @param StartSecondsFromNow - When the vibration starts
+	* @param DurationSeconds - How long it lasts
+	* @param Frequency - Its frequency in Hz
+	* @param Amplitude - Its amplitude, 0 silences the hand
+	*/
+	static void TraceHaptic(int32 HandIndex, float StartSecondsFromNow, float DurationSeconds, float Frequency, float Amplitude);
+
+#if !STEAMVR_INPUT_TRACE_CHANNEL
+private:
+	/** Set with steamvr.input.trace */
+	static bool bIsEnabled;
+	static FAutoConsoleVariableRef EnabledVariable;
+#endif
+};
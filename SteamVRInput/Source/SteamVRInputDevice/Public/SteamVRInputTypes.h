@@ -33,6 +33,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "openvr.h"
 #include "GameFramework/InputSettings.h"
 #include "InputCoreTypes.h"
+#include "Dom/JsonObject.h"
 
 using namespace vr;
 
@@ -45,7 +46,41 @@ using namespace vr;
 #define KNUCKLES_LOWER_HAND_GRIP_AXIS	4
 #define STEAMVR_SKELETON_BONE_COUNT		31
 #define DOT_45DEG						0.707f
+#define INPUT_SNAPSHOT_BUFFER_COUNT		3
+#define INPUT_SNAPSHOT_MAX_ACTIONS		512
 #define TOUCHPAD_DEADZONE				0.0f
+#define ANALOG_DISPATCH_DEADBAND		0.001f
+#define INPUT_POLLING_QUEUE_SIZE		1024
+#define INPUT_POLLING_RATE_MIN			60.f
+#define INPUT_POLLING_RATE_MAX			2000.f
+#define HAPTIC_SCHEDULE_LOOKAHEAD		0.05f
+#define HAPTIC_SCHEDULE_RAMP_STEP		0.01f
+#define HAPTIC_CONTINUOUS_HOLD			0.1f
+#define HAPTIC_MIN_PULSE_DURATION		0.005f
+#define HAPTIC_AUDIO_WINDOW				0.01f
+#define HAPTIC_AUDIO_LOOKAHEAD			0.1f
+#define HAPTIC_AUDIO_NOISE_FLOOR		0.02f
+#define HAPTIC_AUDIO_AMPLITUDE_STEPS	20.f
+#define HAPTIC_AUDIO_FREQUENCY_STEP		10.f
+#define HAPTIC_AUDIO_FREQUENCY_MIN		40.f
+#define HAPTIC_AUDIO_FREQUENCY_MAX		320.f
+#define INPUT_RECORDING_MAGIC			0x52495653	// "SVIR"
+#define INPUT_RECORDING_VERSION			2
+#define MOCK_RUNTIME_PRESS_PERIOD		1.f
+#define MOCK_RUNTIME_PRESS_DUTY			0.25f
+#define MOCK_RUNTIME_MOTION_FREQUENCY	0.5f
+#define MOCK_RUNTIME_MAX_CURL_ANGLE		70.f
+#define MOCK_RUNTIME_IPD				0.064f
+#define BENCHMARK_FRAME_COUNT			300
+#define BENCHMARK_FRAME_SECONDS			(1.f / 90.f)
+#define BENCHMARK_SKELETON_ITERATIONS	10000
+#define BENCHMARK_SKELETON_TOLERANCE	0.0001f
+#define BENCHMARK_SKELETON_TIME_RATIO	1.1f	// How much slower than the scalar path the vectorized skeleton conversion may measure, for timer noise
+#define BENCHMARK_SCALING_TOLERANCE		2.f		// How much further than expected a path may scale from the smallest scenario to the largest
+#define BENCHMARK_SCALING_FLOOR			0.5		// Microseconds per call below which timings are too noisy to compare, so are compared as this
+#define CALL_COUNTER_MAX_METHODS		64
+#define RECONNECT_INTERVAL_MIN			1.0		// Seconds before SteamVR is probed again after a failed connection
+#define RECONNECT_INTERVAL_MAX			30.0	// Longest wait between probes, the wait doubles after each failure up to this
 
 // Manifest constants
 #define MAX_ACTION_SETS					25
@@ -54,8 +89,11 @@ using namespace vr;
 #define ACTION_MANIFEST_UE				"steamvr_actions.json"
 #define APP_MANIFEST_FILE				"steamvr_ue_editor_app.json"
 #define APP_MANIFEST_PREFIX				"application.generated.ue."
+#define ACTION_SETS_CONFIG_SECTION		"SteamVRInput.ActionSets"
+#define INPUT_CONFIG_SECTION			"SteamVRInput"
 
 // Action paths
+#define ACTION_SET_PREFIX				"/actions/"
 #define ACTION_SET						"/actions/main"
 #define ACTION_PATH_IN					"/actions/main/in"
 #define ACTION_PATH_CONTROLLER_LEFT		"/actions/main/in/controllerleft"
@@ -197,6 +235,70 @@ enum EActionType
 	Invalid
 };
 
+/** How an action event is read from SteamVR and sent to the engine, classified once when action events are built */
+enum EActionDispatchKind : uint8
+{
+	ActionDispatch_None,			// Not read per frame (e.g. boolean actions that back an axis)
+	ActionDispatch_Digital,
+	ActionDispatch_Analog1D,
+	ActionDispatch_Analog2D,
+	ActionDispatch_Pose,
+	ActionDispatch_Skeletal,
+	ActionDispatch_Vibration
+};
+
+/** OpenVR interfaces whose calls are counted by FSteamVRInputCallCounter */
+enum ESteamVRInterface : uint8
+{
+	VRInterface_System,
+	VRInterface_Input,
+	VRInterface_Compositor,
+	VRInterface_Count
+};
+
+/** Where the input device stands with SteamVR */
+enum ESteamVRConnectionState : uint8
+{
+	SteamVRConnection_Dormant,		// SteamVR is never used (-nohmd), only a mock runtime or replay can stand in for it
+	SteamVRConnection_Disconnected,	// SteamVR isn't running, it is probed again with exponential backoff
+	SteamVRConnection_Connected		// SteamVR is running and the handles are resolved, restarts are watched for
+};
+
+enum EHapticMixMode : uint8
+{
+	HapticMix_Max,					// The loudest haptic request of a hand plays
+	HapticMix_Sum					// The haptic requests of a hand add up, clamped to full amplitude
+};
+
+/** OpenVR calls whose results are kept in input recordings */
+enum EInputRecordCall : uint8
+{
+	InputRecord_ActionSetHandle,
+	InputRecord_ActionHandle,
+	InputRecord_InputSourceHandle,
+	InputRecord_UpdateActionState,
+	InputRecord_DigitalActionData,
+	InputRecord_AnalogActionData,
+	InputRecord_PoseActionDataRelativeToNow,
+	InputRecord_PoseActionDataForNextFrame,
+	InputRecord_SkeletalActionData,
+	InputRecord_BoneCount,
+	InputRecord_BoneHierarchy,
+	InputRecord_BoneName,
+	InputRecord_SkeletalReferenceTransforms,
+	InputRecord_SkeletalTrackingLevel,
+	InputRecord_SkeletalBoneData,
+	InputRecord_SkeletalSummaryData,
+	InputRecord_SkeletalBoneDataCompressed,
+	InputRecord_DecompressSkeletalBoneData,
+	InputRecord_ActionOrigins,
+	InputRecord_OriginLocalizedName,
+	InputRecord_OriginTrackedDeviceInfo,
+	InputRecord_ActionBindingInfo,
+	InputRecord_IsUsingLegacyInput,
+	InputRecord_TrackingSpace		// IVRCompositor::GetTrackingSpace, read once per frame
+};
+
 struct FSteamVRAxisKeyMapping 
 {
 	FInputAxisKeyMapping InputAxisKeyMapping;
@@ -303,6 +405,25 @@ struct FInputMapping
 	FInputMapping() {}
 };
 
+/**
+ * An additional action set declared in the project's game config, e.g.
+ * [SteamVRInput.ActionSets]
+ * +ActionSets=(Name="vehicle", Priority=10, Description="Vehicle Controls", Actions="Throttle,Steer,ExitVehicle")
+ * Listed input actions and axes are generated in this action set instead of main
+ */
+struct FSteamVRInputActionSetDefinition
+{
+	FName		Name;						// The short name of the action set (e.g. vehicle)
+	FString		Path;						// The full path of the action set (e.g. /actions/vehicle)
+	int32		Priority;					// The priority of this action set relative to other action sets
+	FString		Description;				// The localized description of this action set shown in the SteamVR bindings UI
+	TArray<FName> ActionNames;				// The project input actions and axes that belong to this action set
+
+	FSteamVRInputActionSetDefinition()
+		: Priority(0)
+	{}
+};
+
 struct FSteamVRInputActionSet
 {
 	int32		Priority;					// The priority of this action set relative to other action sets.	
@@ -314,6 +435,9 @@ struct FSteamVRInputActionSet
 	VRInputValueHandle_t RestrictedToDeviceHandle;	// Handle of a device path that this action set should be active for.  Use k_ulInvalidInputValueHandle to activate for all devices.
 	VRActionSetHandle_t SecondaryActionSetHandle;	// Secondary action set handle, if RestrictedToDeviceHandle is k_ulInvalidInputValueHandle, this is ignored
 
+	bool bIsActive = true;					// Whether this action set is fed to SteamVR and its actions are processed each frame
+	TArray<int32> DispatchIndices;			// Indices in the action dispatch list of the actions that belong to this action set
+
 	FSteamVRInputActionSet()
 	{}
 
@@ -335,6 +459,8 @@ struct FSteamVRInputAction
 	FName		KeyX;							// The UE Key in the X axis or float axis (e.g. Motion_Controller_Thumbstick_X)
 	FName		KeyY;							// The UE Key in the Y axis
 	FName		KeyZ;							// The UE Key in the Z axis
+	FName		TemporaryKeyX;					// The temporary UE Key digital and X axis events are sent to, resolved when action events are built
+	FName		TemporaryKeyY;					// The temporary UE Key Y axis events are sent to, resolved when action events are built
 	FVector		Value;							// The 1D, 2D, 3D (analog) input value of this action
 	FString		StringPath;						// The string value of this action (such as for Skeleton Paths where a bool or float axis is not appropriate)
 	bool		bState;							// The bool (digital) value of this action
@@ -342,6 +468,10 @@ struct FSteamVRInputAction
 
 	VRActionHandle_t Handle;					// The handle to the SteamVR main Action Set
 	VRInputValueHandle_t ActiveOrigin = 0;		// The input value handle of the origin of the latest input event
+	float		AnalogDeadband = ANALOG_DISPATCH_DEADBAND;	// Minimum change in an analog value before it is sent to the engine again
+	double		LastEventTime = 0.0;			// When SteamVR last reported a change for this action, in FPlatformTime::Seconds() time
+	double		LastPressedTime = 0.0;			// When SteamVR last reported this digital action as pressed, in FPlatformTime::Seconds() time
+	double		LastReleasedTime = 0.0;			// When SteamVR last reported this digital action as released, in FPlatformTime::Seconds() time
 	EVRInputError LastError;					// A cache for the last Error for operations against this action (could also be "No Error")
 
 	FString GetActionTypeName()
@@ -445,6 +575,227 @@ struct FSteamVRInputAction
 
 };
 
+struct FSteamVRActionDispatch
+{
+	VRActionHandle_t	Handle;			// The handle of the action in SteamVR
+	int32				ActionIndex;	// Index of the action in the action events list
+	EActionDispatchKind	Kind;			// How the action is read from SteamVR and sent to the engine
+
+	FSteamVRActionDispatch(VRActionHandle_t InHandle, int32 InActionIndex, EActionDispatchKind InKind)
+		: Handle(InHandle)
+		, ActionIndex(InActionIndex)
+		, Kind(InKind)
+	{}
+};
+
+struct FSteamVRDigitalActionEvent
+{
+	int32					ActionIndex = INDEX_NONE;	// Index of the action in the action events list
+	bool					bState = false;				// The new state of the action
+	VRInputValueHandle_t	ActiveOrigin = 0;			// The input value handle of the origin of the transition
+	double					Time = 0.0;					// When SteamVR saw the transition, in FPlatformTime::Seconds() time
+};
+
+struct FSteamVRPolledDigitalAction
+{
+	VRActionHandle_t			Handle = k_ulInvalidActionHandle;	// The SteamVR handle of the action
+	int32						ActionIndex = INDEX_NONE;			// Index of the action in the action events list
+	InputDigitalActionData_t	DigitalData;						// What SteamVR reported for the action in this poll
+	EVRInputError				InputError = VRInputError_NoData;	// The result of reading DigitalData
+};
+
+struct FSteamVRHapticFrameRequest
+{
+	float	Amplitude = 0.f;			// Mixed amplitude [0..1] of the requests made this frame
+	float	Frequency = 0.f;			// Frequency of the loudest request made this frame
+	float	LoudestAmplitude = 0.f;		// Amplitude of the loudest request made this frame
+	bool	bIsSet = false;				// Whether any request was made this frame, including requests to stop
+};
+
+struct FSteamVRHapticSegment
+{
+	float	Duration = 0.f;				// How long this segment plays, in seconds. 0 plays the shortest pulse, HAPTIC_MIN_PULSE_DURATION
+	float	StartFrequency = 1.f;		// Vibration frequency at the start of the segment
+	float	EndFrequency = 1.f;			// Vibration frequency at the end of the segment, ramped linearly from the start
+	float	StartAmplitude = 0.f;		// Vibration amplitude [0..1] at the start of the segment
+	float	EndAmplitude = 0.f;			// Vibration amplitude [0..1] at the end of the segment, ramped linearly from the start
+
+	FSteamVRHapticSegment() {}
+
+	FSteamVRHapticSegment(float InDuration, float InFrequency, float InAmplitude)
+		: Duration(InDuration)
+		, StartFrequency(InFrequency)
+		, EndFrequency(InFrequency)
+		, StartAmplitude(InAmplitude)
+		, EndAmplitude(InAmplitude)
+	{}
+
+	bool IsRamp() const
+	{
+		return StartFrequency != EndFrequency || StartAmplitude != EndAmplitude;
+	}
+};
+
+/** Counters of the analog events sent to, and held back from, the engine since the last reset */
+struct FSteamVRInputDispatchStats
+{
+	uint64 AnalogEventsSent = 0;			// Analog action values sent to the engine
+	uint64 AnalogEventsSuppressed = 0;		// Analog action values that didn't move beyond their deadband
+	uint64 CurlSplayEventsSent = 0;			// Finger curl and splay values sent to the engine
+	uint64 CurlSplayEventsSuppressed = 0;	// Finger curl and splay values that didn't move beyond the deadband
+};
+
+struct FSteamVRMotionSourceHandles
+{
+	VRActionHandle_t PoseHandle;		// The controller or tracker pose handle for this motion source
+	VRActionHandle_t SkeletalHandle;	// The skeletal action handle for this motion source, if any (used when the skeleton pose drives the controller)
+
+	FSteamVRMotionSourceHandles()
+		: PoseHandle(k_ulInvalidActionHandle)
+		, SkeletalHandle(k_ulInvalidActionHandle)
+	{}
+
+	FSteamVRMotionSourceHandles(VRActionHandle_t InPoseHandle, VRActionHandle_t InSkeletalHandle = k_ulInvalidActionHandle)
+		: PoseHandle(InPoseHandle)
+		, SkeletalHandle(InSkeletalHandle)
+	{}
+};
+
+/** What SteamVR answered to a call made while registering an action manifest */
+struct FSteamVRActionManifestResult
+{
+	EVRInputError InputError;			// The result of the call
+	FString		Description;			// What was being done, e.g. Setting main action set
+
+	FSteamVRActionManifestResult(EVRInputError InInputError, const FString& InDescription)
+		: InputError(InInputError)
+		, Description(InDescription)
+	{}
+};
+
+/**
+ * An action manifest on its way to SteamVR. Its actions are gathered on the game thread, it is written and registered
+ * with SteamVR on any thread, then its handles are applied to the input device on the game thread
+ */
+struct FSteamVRActionManifestBuild
+{
+	bool		bGenerateActions;				// Whether the action manifest file is written
+	bool		bGenerateBindings;				// Whether missing controller binding files are generated (editor only)
+	bool		bRegisterApp;					// Whether the action manifest is registered with SteamVR and its handles resolved
+	bool		bDeleteIfExists;				// Whether existing controller binding files are overwritten, which asks the user so is game thread only
+	bool		bRegisterManifestOnly;			// Whether only the action manifest is registered, without the editor application manifest
+
+	FString		ManifestPath;					// Where the action manifest is written
+	FString		ControllerBindingsPath;			// Where controller binding files are found and generated
+	TSharedPtr<FJsonObject> ActionManifestObject;	// The action manifest json, completed as the build goes on
+	TArray<FString> LocalizationFields;			// The localized names of the actions and action sets
+	TArray<FInputMapping> InputMappings;		// The project inputs and the actions they drive
+	TArray<FControllerType> ControllerTypes;	// Controller types supported by SteamVR, tagged with whether their bindings exist
+	TArray<FSteamVRInputAction> Actions;		// The actions of the manifest, with their handles once registered
+	TArray<FSteamVRInputActionSetDefinition> ActionSetDefinitions;	// The additional action sets, their handles are resolved along with the main action set
+
+	bool		bIsRegistered = false;			// Whether SteamVR was available to register the manifest and resolve the handles below
+	FString		AppKey;							// The key the editor application was identified to SteamVR with, if it was
+	TArray<FSteamVRActionManifestResult> Results;	// What SteamVR answered while registering, logged on the game thread once the build is applied
+	EVRInputError LastInputError = VRInputError_None;	// The last error SteamVR answered while registering, so repeated errors are only logged once
+	VRActionSetHandle_t MainActionSet = k_ulInvalidActionSetHandle;
+	TArray<FSteamVRInputActionSet> ActionSets;	// The main action set, then the additional action sets SteamVR knows
+	VRActionHandle_t SkeletalHandleLeft = k_ulInvalidActionHandle;
+	VRActionHandle_t SkeletalHandleRight = k_ulInvalidActionHandle;
+	bool		bIsSkeletalControllerLeftPresent = false;
+	bool		bIsSkeletalControllerRightPresent = false;
+	VRActionHandle_t VibrationLeft = k_ulInvalidActionHandle;
+	VRActionHandle_t VibrationRight = k_ulInvalidActionHandle;
+
+	FSteamVRActionManifestBuild(bool InGenerateActions, bool InGenerateBindings, bool InRegisterApp, bool InDeleteIfExists, bool InRegisterManifestOnly)
+		: bGenerateActions(InGenerateActions)
+		, bGenerateBindings(InGenerateBindings)
+		, bRegisterApp(InRegisterApp)
+		, bDeleteIfExists(InDeleteIfExists)
+		, bRegisterManifestOnly(InRegisterManifestOnly)
+		, ActionManifestObject(MakeShareable(new FJsonObject()))
+	{}
+};
+
+struct FSteamVRCachedPose
+{
+	InputPoseActionData_t PoseData;		// The pose data last read from SteamVR for this action
+	EVRInputError InputError;			// The result of the SteamVR Input call that produced PoseData
+	uint64 FrameNumber;					// The engine frame the pose was read in
+	float PredictedSecondsFromNow;		// The prediction used when the pose was read
+
+	FSteamVRCachedPose()
+		: PoseData()
+		, InputError(VRInputError_NoData)
+		, FrameNumber(MAX_uint64)
+		, PredictedSecondsFromNow(0.f)
+	{}
+};
+
+struct FSteamVRBoneConversion
+{
+	VectorRegister RotationColumns[4];		// UE4 rotation (x, y, z, w) contributed by each SteamVR orientation component (w, x, y, z)
+	VectorRegister TranslationColumns[4];	// UE4 translation contributed by each SteamVR position component (x, y, z, unused)
+};
+
+struct FSteamVRCachedSkeleton
+{
+	VRBoneTransform_t SteamVRBoneTransforms[STEAMVR_SKELETON_BONE_COUNT];	// Parent-space bones as read from SteamVR this frame
+	FTransform BoneTransforms[2][STEAMVR_SKELETON_BONE_COUNT];			// Bones converted to UE4 space, unmirrored [0] and mirrored [1]
+	bool bIsConverted[2];												// Whether BoneTransforms has been filled for the unmirrored [0] and mirrored [1] variants
+	EVRInputError InputError;											// The result of the SteamVR Input call that produced SteamVRBoneTransforms
+	uint64 FrameNumber;													// The engine frame the bones were read in
+
+	FSteamVRCachedSkeleton()
+		: InputError(VRInputError_NoData)
+		, FrameNumber(MAX_uint64)
+	{
+		bIsConverted[0] = false;
+		bIsConverted[1] = false;
+	}
+};
+
+struct FSteamVRActionStateSnapshot
+{
+	FName	Name;			// The SteamVR name of the action
+	bool	bState;			// The bool (digital) value of this action
+	FVector	Value;			// The 1D, 2D, 3D (analog) input value of this action
+};
+
+struct FSteamVRInputSnapshot
+{
+	uint64 FrameNumber;																			// The engine frame this snapshot was published in
+	int32 Requests;																				// The SnapshotRequests bits of the skeletal and pose data this snapshot carries
+	FTransform BoneTransforms[2][2][2][STEAMVR_SKELETON_BONE_COUNT];							// Skeletal bones, indexed by hand, motion range and mirroring
+	bool bHasBoneTransforms[2][2][2];															// Whether BoneTransforms holds valid data for a given hand, motion range and mirroring
+	VRSkeletalSummaryData_t SkeletalSummaryData[2][2];											// Finger curls and splays, indexed by hand and summary type
+	bool bHasSkeletalSummaryData[2][2];															// Whether SkeletalSummaryData holds valid data for a given hand and summary type
+	InputPoseActionData_t ControllerPoses[2];													// Controller poses of the left and right hands
+	bool bHasControllerPose[2];																	// Whether ControllerPoses holds valid data for a given hand
+	FSteamVRActionStateSnapshot ActionStates[INPUT_SNAPSHOT_MAX_ACTIONS];						// States of the actions, in ActionEvents order. Fixed so it never reallocates under a reader
+	int32 ActionStateCount;																		// The number of valid entries in ActionStates
+
+	FSteamVRInputSnapshot()
+		: FrameNumber(MAX_uint64)
+		, Requests(0)
+		, ActionStateCount(0)
+	{
+		FMemory::Memzero(bHasBoneTransforms);
+		FMemory::Memzero(bHasSkeletalSummaryData);
+		FMemory::Memzero(bHasControllerPose);
+	}
+};
+
+struct FSteamVRInputSnapshotBuffer
+{
+	volatile int32 Sequence;			// Odd while the game thread is writing Snapshot, even once it is complete
+	FSteamVRInputSnapshot Snapshot;		// The input values published for a frame
+
+	FSteamVRInputSnapshotBuffer()
+		: Sequence(0)
+	{}
+};
+
 struct FSteamVRInputState
 {
 	bool bIsAxis;
@@ -87,9 +87,22 @@ namespace SteamVRSkeleton
 	/** Returns the index of the parent bone of the given bone.  Returns -1 if the bone does not have a parent */
 	int32			GetParentIndex(int32 nBoneIndex);
 
+	/** Returns the parent index of every bone in the skeleton, in bone order */
+	const int32*	GetParentIndices();
+
 	/** Returns the number of children of the given bone */
 	int32			GetChildCount(int32 nBoneIndex);
 
 	/** Returns the index of the nth child of the given bone */
 	int32			GetChildIndex(int32 nBoneIndex, int32 nChildIndex);
+
+	/**
+	 * Accumulates local-space bone transforms into component space in a single parent-before-child sweep.
+	 * Every bone's parent index must be lower than its own index, with -1 marking a root bone
+	 * @param BoneTransformsLS - Local-space transform of each bone
+	 * @param ParentIndices - Parent index of each bone, as returned by GetParentIndices() of either hand skeleton
+	 * @param BoneCount - Number of bones in each of the arrays
+	 * @param OutBoneTransformsCS - Receives the component-space transform of each bone, may not alias BoneTransformsLS
+	 */
+	void			CalcComponentSpaceTransforms(const FTransform* BoneTransformsLS, const int32* ParentIndices, int32 BoneCount, FTransform* OutBoneTransformsCS);
 };
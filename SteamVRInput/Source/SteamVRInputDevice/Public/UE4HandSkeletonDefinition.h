@@ -72,6 +72,9 @@ namespace UE4HandSkeleton
 	/** Returns the index of the parent bone of the given bone.  Returns -1 if the bone does not have a parent */
 	int32			GetParentIndex(int32 nBoneIndex);
 
+	/** Returns the parent index of every bone in the skeleton, in bone order */
+	const int32*	GetParentIndices();
+
 	/** Returns the number of children of the given bone */
 	int32			GetChildCount(int32 nBoneIndex);
 
@@ -26,6 +26,7 @@ public class SteamVRInputDevice : ModuleRules
                 "CoreUObject",
                 "Engine",
                 "HeadMountedDisplay",
+                "RenderCore",
                 "SteamVR",
                 "SteamVRController",
                 "Json",